@@ -0,0 +1,182 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Telemetry collector, receiving the datagrams of master_me instances run with MASTER_ME_EXPORT=host:port
+// (see plugin/utils/TelemetryExporter.hpp) and printing the main meters of each one, once per second.
+//
+// Meant as a starting point and for checking what a fleet of instances sends, not as a monitoring system.
+// Instances are told apart by source address and instance id, and dropped after 5 seconds without datagrams.
+// Lost datagrams are counted from the gaps in sequence numbers.
+//
+// usage: collect [port]
+//   port    UDP port to listen on, on all interfaces (default 9710)
+
+#include "DistrhoPlugin.hpp"
+
+#include "DistrhoPluginInfo.h"
+#include "utils/TelemetryExporter.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <utility>
+
+USE_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const uint kNumMeters = kParameterCount - kParameter_peakmeter_in_l;
+static constexpr const double kInstanceTimeoutSeconds = 5.0;
+
+typedef std::chrono::steady_clock Clock;
+
+struct Instance {
+    float meters[kNumMeters] = {};
+    uint32_t sequence = 0;
+    uint32_t badInputSamples = 0;
+    uint64_t numReceived = 0;
+    uint64_t numLost = 0;
+    Clock::time_point lastSeen;
+};
+
+static float meter(const Instance& instance, const uint32_t index)
+{
+    return instance.meters[index - kParameter_peakmeter_in_l];
+}
+
+int main(int argc, char* argv[])
+{
+    const int port = argc > 1 ? std::atoi(argv[1]) : 9710;
+
+    if (port <= 0 || port > 0xffff)
+    {
+        std::fprintf(stderr, "usage: %s [port]\n", argv[0]);
+        return 1;
+    }
+
+    const int fd = ::socket(AF_INET6, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        std::perror("socket");
+        return 1;
+    }
+
+    // accept IPv4 too
+    const int no = 0;
+    ::setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no));
+
+    // datagrams come in bursts from many instances at once
+    const int bufferSize = 4 * 1024 * 1024;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+
+    // wake up at least every 100 ms, for printing
+    const timeval timeout = { 0, 100000 };
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_in6 addr = {};
+    addr.sin6_family = AF_INET6;
+    addr.sin6_addr = in6addr_any;
+    addr.sin6_port = htons(static_cast<uint16_t>(port));
+
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0)
+    {
+        std::perror("bind");
+        return 1;
+    }
+
+    std::fprintf(stderr, "listening on UDP port %d\n", port);
+
+    std::map<std::pair<std::string, uint32_t>, Instance> instances;
+    Clock::time_point lastPrint = Clock::now();
+    uint64_t numInvalid = 0;
+
+    for (;;)
+    {
+        union {
+            TelemetryExportHeader header;
+            uint8_t bytes[65536];
+        } datagram;
+
+        sockaddr_in6 from = {};
+        socklen_t fromSize = sizeof(from);
+        const ssize_t size = ::recvfrom(fd, datagram.bytes, sizeof(datagram.bytes), 0,
+                                        reinterpret_cast<sockaddr*>(&from), &fromSize);
+        const Clock::time_point now = Clock::now();
+
+        if (size >= static_cast<ssize_t>(sizeof(TelemetryExportHeader)))
+        {
+            const TelemetryExportHeader& header(datagram.header);
+            const size_t numValues = header.numMeters + header.numLufsIn + header.numLufsOut;
+
+            if (header.magic != kTelemetryExportMagic ||
+                header.version != kTelemetryExportVersion ||
+                header.numMeters != kNumMeters ||
+                static_cast<size_t>(size) != sizeof(header) + sizeof(float) * numValues)
+            {
+                ++numInvalid;
+            }
+            else
+            {
+                char host[INET6_ADDRSTRLEN] = {};
+                ::inet_ntop(AF_INET6, &from.sin6_addr, host, sizeof(host));
+
+                const std::string source = std::string(host) + "#" + std::to_string(ntohs(from.sin6_port));
+                Instance& instance(instances[std::make_pair(source, header.instanceId)]);
+
+                if (instance.numReceived != 0 && header.sequence - instance.sequence > 1)
+                    instance.numLost += header.sequence - instance.sequence - 1;
+
+                const float* const values = reinterpret_cast<const float*>(datagram.bytes + sizeof(header));
+                std::memcpy(instance.meters, values, sizeof(instance.meters));
+
+                instance.sequence = header.sequence;
+                instance.badInputSamples = header.badInputSamples;
+                instance.lastSeen = now;
+                ++instance.numReceived;
+            }
+        }
+
+        if (std::chrono::duration<double>(now - lastPrint).count() < 1.0)
+            continue;
+
+        lastPrint = now;
+
+        std::printf("\n%-40s %10s %9s %9s %9s %9s %9s %8s %8s\n",
+                    "instance", "id", "lufs in", "lufs out", "leveler", "limiter", "brickwall", "lost", "bad in");
+
+        for (auto it = instances.begin(); it != instances.end();)
+        {
+            const Instance& instance(it->second);
+
+            if (std::chrono::duration<double>(now - instance.lastSeen).count() > kInstanceTimeoutSeconds)
+            {
+                std::printf("%-40s %10x gone\n", it->first.first.c_str(), it->first.second);
+                it = instances.erase(it);
+                continue;
+            }
+
+            std::printf("%-40s %10x %9.1f %9.1f %9.1f %9.1f %9.1f %8llu %8u\n",
+                        it->first.first.c_str(), it->first.second,
+                        meter(instance, kParameter_lufs_in),
+                        meter(instance, kParameter_lufs_out),
+                        meter(instance, kParameter_leveler_gain),
+                        meter(instance, kParameter_limiter_gain_reduction),
+                        meter(instance, kParameter_brickwall_limit),
+                        static_cast<unsigned long long>(instance.numLost),
+                        instance.badInputSamples);
+            ++it;
+        }
+
+        if (numInvalid != 0)
+            std::printf("%llu invalid datagrams\n", static_cast<unsigned long long>(numInvalid));
+
+        std::fflush(stdout);
+    }
+
+    return 0;
+}
@@ -0,0 +1,261 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Accuracy check for the fast-math build (see plugin/dsp/FaustFastMath.hpp), failing if any gain is off by 0.01 dB or more.
+//
+// Two parts:
+//  - the approximated functions against libm, over the ranges the dsp uses them for, with errors converted to dB
+//  - the full master_me dsp, regular against fast-math, over a signal with loudness steps that keeps every
+//    compressor and the leveler busy; all dB meters (input/output levels and every gain reduction) and the output
+//    level (per block RMS) are compared at each block, cpu time of both is reported too
+//
+// The leveler brake meter is in percent, so it is only reported.
+//
+// usage: fastmathcheck [seconds] [buffer-size]
+
+#include "faust/gui/meta.h"
+#include "faust/gui/UI.h"
+#include "faust/dsp/dsp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// generated from master_me.dsp, regular and with `-fm plugin/dsp/FaustFastMath.hpp`
+#include "master_me_ref.h"
+#include "master_me_fm.h"
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const float kMaxErrorDb = 0.01f;
+
+// blocks quieter than this are not compared, their level is mostly dither from the limiter release
+static constexpr const float kMinLevelDb = -60.f;
+
+struct BargraphsUI : UI {
+    std::vector<std::string> labels;
+    std::vector<FAUSTFLOAT*> zones;
+    uint32_t numMscompMeters = 0;
+
+    void openTabBox(const char*) override {}
+    void openHorizontalBox(const char*) override {}
+    void openVerticalBox(const char*) override {}
+    void closeBox() override {}
+    void addButton(const char*, FAUSTFLOAT*) override {}
+    void addCheckButton(const char*, FAUSTFLOAT*) override {}
+    void addVerticalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addNumEntry(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addVerticalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addSoundfile(const char*, const char*, Soundfile**) override {}
+
+    void add(const char* const label, FAUSTFLOAT* const zone)
+    {
+        // mscomp meters have no label, name them by position
+        labels.push_back(std::strncmp(label, "0x", 2) == 0 ? "mscomp meter " + std::to_string(numMscompMeters++) : label);
+        zones.push_back(zone);
+    }
+};
+
+static bool report(const char* const name, const float error, const bool check = true)
+{
+    const bool ok = !check || error < kMaxErrorDb;
+    std::printf("  %-28s %10.6f%s\n", name, error, check ? (ok ? " dB" : " dB  FAILED") : " (not checked)");
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// function sweeps
+
+template <class Func, class Ref>
+static float maxError(const float start, const float end, const bool logarithmic, Func func, Ref ref, float (*toDb)(float, double))
+{
+    static constexpr const uint32_t kSteps = 1000000;
+    float error = 0.f;
+
+    for (uint32_t i = 0; i <= kSteps; ++i)
+    {
+        const double t = static_cast<double>(i) / kSteps;
+        const float x = logarithmic ? static_cast<float>(start * std::pow(static_cast<double>(end) / start, t))
+                                    : static_cast<float>(start + (end - start) * t);
+
+        error = std::max(error, toDb(func(x), ref(static_cast<double>(x))));
+    }
+
+    return error;
+}
+
+// difference of two values in dB
+static float absoluteDb(const float value, const double ref)
+{
+    return static_cast<float>(std::fabs(value - ref));
+}
+
+// difference of two values in log10 units, as dB after 20 * log10
+static float log10Db(const float value, const double ref)
+{
+    return static_cast<float>(20.0 * std::fabs(value - ref));
+}
+
+// difference of two gains in dB
+static float ratioDb(const float value, const double ref)
+{
+    return static_cast<float>(std::fabs(20.0 * std::log10(value / ref)));
+}
+
+static bool checkFunctions()
+{
+    bool ok = true;
+    std::printf("functions, max error:\n");
+
+    // ba.linear2db over the whole normal float range
+    ok &= report("log10f (linear2db)", maxError(1.17549435e-38f, 1e4f, true,
+                 [](float x) { return fast_log10f(x); }, [](double x) { return std::log10(x); }, log10Db));
+
+    // natural log, 10 * log10 in the lufs meters and leveler
+    ok &= report("logf (lufs)", maxError(1e-12f, 1e4f, true,
+                 [](float x) { return 4.34294462f * fast_logf(x); }, [](double x) { return 4.34294462 * std::log(x); }, absoluteDb));
+
+    // ba.db2linear from -140 to +40 dB
+    ok &= report("powf(10, x) (db2linear)", maxError(-7.f, 2.f, false,
+                 [](float x) { return fast_powf(10.f, x); }, [](double x) { return std::pow(10.0, x); }, ratioDb));
+
+    // generic pow, as used for the mscomp band frequencies
+    ok &= report("powf(x, 1/7)", maxError(1e-6f, 1e3f, true,
+                 [](float x) { return fast_powf(x, 1.f / 7.f); }, [](double x) { return std::pow(x, 1.0 / 7.0); }, ratioDb));
+
+    // filter and smoothing coefficients
+    ok &= report("expf", maxError(-87.f, 10.f, false,
+                 [](float x) { return fast_expf(x); }, [](double x) { return std::exp(x); }, ratioDb));
+
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// full dsp
+
+// deterministic stereo pinkish noise, changing level every 2 seconds
+struct SignalGenerator {
+    static constexpr const float kLevels[] = { -30.f, -12.f, -3.f, -40.f, -20.f, -6.f, 0.f, -45.f, -24.f, -9.f };
+
+    uint32_t seed = 1;
+    uint64_t frame = 0;
+    float lowL = 0.f, lowR = 0.f;
+    const double sampleRate;
+
+    explicit SignalGenerator(const double sr) : sampleRate(sr) {}
+
+    float noise() noexcept
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 9) / 4194304.f - 1.f;
+    }
+
+    void generate(float* const left, float* const right, const uint32_t frames) noexcept
+    {
+        for (uint32_t i = 0; i < frames; ++i, ++frame)
+        {
+            const uint32_t step = static_cast<uint32_t>(frame / static_cast<uint64_t>(2 * sampleRate));
+            const float gain = std::pow(10.f, kLevels[step % (sizeof(kLevels) / sizeof(kLevels[0]))] * 0.05f);
+
+            // one-pole lowpass mixed with white, more low end than white noise alone
+            const float nl = noise(), nr = noise();
+            lowL += 0.02f * (nl - lowL);
+            lowR += 0.02f * (0.5f * nl + 0.5f * nr - lowR);
+            left[i] = gain * (4.f * lowL + 0.25f * nl);
+            right[i] = gain * (4.f * lowR + 0.25f * nr);
+        }
+    }
+};
+
+static float levelDb(const float* const left, const float* const right, const uint32_t frames)
+{
+    double energy = 0.0;
+    for (uint32_t i = 0; i < frames; ++i)
+        energy += left[i] * left[i] + right[i] * right[i];
+
+    return static_cast<float>(10.0 * std::log10(std::max(1e-30, energy / (frames * 2))));
+}
+
+static bool checkDsp(const double sampleRate, const double seconds, const uint32_t bufferSize)
+{
+    master_me_ref* const ref = new master_me_ref;
+    master_me_fm* const fm = new master_me_fm;
+    BargraphsUI refUI, fmUI;
+
+    ref->init(static_cast<int>(sampleRate));
+    fm->init(static_cast<int>(sampleRate));
+    ref->buildUserInterface(&refUI);
+    fm->buildUserInterface(&fmUI);
+
+    const size_t numMeters = refUI.zones.size();
+    std::vector<float> meterErrors(numMeters, 0.f);
+    float outputError = 0.f;
+    double refSeconds = 0.0, fmSeconds = 0.0;
+
+    std::vector<float> inL(bufferSize), inR(bufferSize);
+    std::vector<float> refL(bufferSize), refR(bufferSize), fmL(bufferSize), fmR(bufferSize);
+    FAUSTFLOAT* inputs[2] = { inL.data(), inR.data() };
+    FAUSTFLOAT* refOutputs[2] = { refL.data(), refR.data() };
+    FAUSTFLOAT* fmOutputs[2] = { fmL.data(), fmR.data() };
+
+    SignalGenerator generator(sampleRate);
+    const uint64_t numFrames = static_cast<uint64_t>(seconds * sampleRate);
+
+    for (uint64_t frame = 0; frame < numFrames; frame += bufferSize)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+
+        const auto start = std::chrono::steady_clock::now();
+        ref->compute(bufferSize, inputs, refOutputs);
+        const auto middle = std::chrono::steady_clock::now();
+        fm->compute(bufferSize, inputs, fmOutputs);
+        const auto end = std::chrono::steady_clock::now();
+
+        refSeconds += std::chrono::duration<double>(middle - start).count();
+        fmSeconds += std::chrono::duration<double>(end - middle).count();
+
+        for (size_t i = 0; i < numMeters; ++i)
+            meterErrors[i] = std::max(meterErrors[i], std::fabs(*refUI.zones[i] - *fmUI.zones[i]));
+
+        const float refLevel = levelDb(refL.data(), refR.data(), bufferSize);
+
+        if (refLevel > kMinLevelDb)
+            outputError = std::max(outputError, std::fabs(refLevel - levelDb(fmL.data(), fmR.data(), bufferSize)));
+    }
+
+    std::printf("dsp at %.0f Hz, cpu %.3f s regular, %.3f s fast-math (%.2fx), max error:\n",
+                sampleRate, refSeconds, fmSeconds, refSeconds / fmSeconds);
+
+    bool ok = report("output level", outputError);
+
+    for (size_t i = 0; i < numMeters; ++i)
+        ok &= report(refUI.labels[i].c_str(), meterErrors[i], refUI.labels[i] != "leveler brake");
+
+    delete ref;
+    delete fm;
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 60.0;
+    const uint32_t bufferSize = argc > 2 ? std::atoi(argv[2]) : 512;
+
+    bool ok = checkFunctions();
+
+    for (const double sampleRate : { 44100.0, 48000.0, 96000.0 })
+        ok &= checkDsp(sampleRate, seconds, bufferSize);
+
+    std::printf(ok ? "fast-math accuracy ok\n" : "fast-math accuracy check FAILED\n");
+    return ok ? 0 : 1;
+}
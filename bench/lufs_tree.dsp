@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// The faust tree based (ba.slidingSump) short-term loudness meter from lufs_meter.dsp,
+// without tone generator, used as reference in lufsbench.cpp
+
+lm = library("lufs_meter.dsp");
+
+process = lm.lufs_meter;
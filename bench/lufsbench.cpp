@@ -0,0 +1,243 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// A/B bench for the short-term (3s) loudness meters:
+//  - "tree", the faust ba.slidingSump based meter (bench/lufs_tree.dsp)
+//  - "running", plugin LoudnessMeter with a plain running sum
+//  - "compensated", plugin LoudnessMeter with the compensated running sum
+//  - "block", plugin R128LoudnessMeter short-term value, updated every 100ms (used in the plugin)
+//
+// The signal is loud noise for a while, followed by a long very quiet tail.
+// This is the worst-case for running sums, as any drift accumulated during the loud part shows up in the quiet one.
+// Errors are measured against an exact re-summation of the K-weighted window, once per second.
+//
+// usage: lufsbench [loud-seconds] [sample-rate] [buffer-size]
+
+#include "faust/gui/meta.h"
+#include "faust/gui/UI.h"
+#include "faust/dsp/dsp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// generated from bench/lufs_tree.dsp
+#include "lufs_tree.h"
+
+#include "dsp/R128LoudnessMeter.hpp"
+
+using namespace DISTRHO;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+struct BargraphUI : UI {
+    FAUSTFLOAT* zone = nullptr;
+
+    void openTabBox(const char*) override {}
+    void openHorizontalBox(const char*) override {}
+    void openVerticalBox(const char*) override {}
+    void closeBox() override {}
+    void addButton(const char*, FAUSTFLOAT*) override {}
+    void addCheckButton(const char*, FAUSTFLOAT*) override {}
+    void addVerticalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addNumEntry(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalBargraph(const char*, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { zone = z; }
+    void addVerticalBargraph(const char*, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { zone = z; }
+    void addSoundfile(const char*, const char*, Soundfile**) override {}
+};
+
+// deterministic stereo noise, loud first and then very quiet
+struct SignalGenerator {
+    uint32_t seed = 1;
+    uint64_t frame = 0;
+    uint64_t loudFrames;
+
+    explicit SignalGenerator(const uint64_t loud) : loudFrames(loud) {}
+
+    void generate(float* const left, float* const right, const uint32_t frames)
+    {
+        for (uint32_t i = 0; i < frames; ++i, ++frame)
+        {
+            const float gain = frame < loudFrames ? 0.5f : 0.00005f;
+            seed = seed * 1664525u + 1013904223u;
+            left[i] = gain * (static_cast<float>(seed >> 9) / 4194304.f - 1.f);
+            seed = seed * 1664525u + 1013904223u;
+            right[i] = gain * (static_cast<float>(seed >> 9) / 4194304.f - 1.f);
+        }
+    }
+};
+
+// exact loudness of the last window, from the same K-weighted energies as LoudnessMeter
+struct ReferenceMeter {
+    KWeightingFilter kfilter[2];
+    std::vector<float> energies;
+    uint32_t pos = 0;
+
+    ReferenceMeter(const double sampleRate)
+        : energies(std::lrint(3.0 * sampleRate), 0.f)
+    {
+        for (int c = 0; c < 2; ++c)
+        {
+            kfilter[c].setSampleRate(sampleRate);
+            kfilter[c].reset();
+        }
+    }
+
+    void process(const float* const left, const float* const right, const uint32_t frames)
+    {
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            const float l = kfilter[0].process(left[i]);
+            const float r = kfilter[1].process(right[i]);
+            energies[pos] = l * l + r * r;
+
+            if (++pos == energies.size())
+                pos = 0;
+        }
+    }
+
+    float getLoudness() const
+    {
+        long double sum = 0.0;
+        for (const float energy : energies)
+            sum += energy;
+        return 10.f * std::log10(std::max(1e-12, static_cast<double>(sum / energies.size()))) - 0.691f;
+    }
+};
+
+struct Result {
+    double seconds = 0.0;
+    float maxErrorLoud = 0.f;
+    float maxErrorQuiet = 0.f;
+};
+
+template <class Meter>
+static Result run(Meter& meter, const double sampleRate, const uint64_t loudFrames, const uint32_t bufferSize)
+{
+    const uint64_t totalFrames = loudFrames + static_cast<uint64_t>(10 * sampleRate);
+    const uint64_t checkInterval = static_cast<uint64_t>(sampleRate);
+
+    SignalGenerator gen(loudFrames);
+    ReferenceMeter ref(sampleRate);
+    std::vector<float> left(bufferSize), right(bufferSize);
+    Result res;
+
+    for (uint64_t frame = 0, nextCheck = checkInterval; frame < totalFrames; frame += bufferSize)
+    {
+        gen.generate(left.data(), right.data(), bufferSize);
+        ref.process(left.data(), right.data(), bufferSize);
+
+        const auto start = std::chrono::steady_clock::now();
+        const float value = meter.process(left.data(), right.data(), bufferSize);
+        res.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (frame + bufferSize < nextCheck)
+            continue;
+
+        nextCheck += checkInterval;
+
+        // skip the first window and the transition from loud to quiet
+        if (frame < 3 * checkInterval || (frame >= loudFrames && frame < loudFrames + 3 * checkInterval))
+            continue;
+
+        const float error = std::fabs(value - ref.getLoudness());
+
+        if (frame < loudFrames)
+            res.maxErrorLoud = std::max(res.maxErrorLoud, error);
+        else
+            res.maxErrorQuiet = std::max(res.maxErrorQuiet, error);
+    }
+
+    return res;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+struct TreeMeter {
+    lufs_tree dsp;
+    BargraphUI ui;
+    std::vector<float> outL, outR;
+
+    TreeMeter(const double sampleRate, const uint32_t bufferSize)
+        : outL(bufferSize), outR(bufferSize)
+    {
+        dsp.init(static_cast<int>(sampleRate));
+        dsp.buildUserInterface(&ui);
+    }
+
+    float process(float* const left, float* const right, const uint32_t frames)
+    {
+        FAUSTFLOAT* inputs[2] = { left, right };
+        FAUSTFLOAT* outputs[2] = { outL.data(), outR.data() };
+        dsp.compute(frames, inputs, outputs);
+        return *ui.zone;
+    }
+};
+
+template <bool compensated>
+struct PluginMeter {
+    LoudnessMeterBase<compensated> meter;
+
+    PluginMeter(const double sampleRate)
+        : meter(sampleRate, 3.f) {}
+
+    float process(const float* const left, const float* const right, const uint32_t frames)
+    {
+        meter.process(left, right, frames);
+        return meter.getLoudness();
+    }
+};
+
+struct BlockMeter {
+    R128LoudnessMeter meter;
+
+    BlockMeter(const double sampleRate)
+        : meter(sampleRate) {}
+
+    float process(const float* const left, const float* const right, const uint32_t frames)
+    {
+        meter.process(left, right, frames);
+        return meter.getShortTermLoudness();
+    }
+};
+
+static void print(const char* const name, const Result& res, const double audioSeconds)
+{
+    std::printf("%-12s %8.3f s cpu %8.1fx realtime   max error loud %.6f dB, quiet %.6f dB\n",
+                name, res.seconds, audioSeconds / res.seconds, res.maxErrorLoud, res.maxErrorQuiet);
+}
+
+int main(int argc, char* argv[])
+{
+    const double loudSeconds = argc > 1 ? std::atof(argv[1]) : 600.0;
+    const double sampleRate = argc > 2 ? std::atof(argv[2]) : 48000.0;
+    const uint32_t bufferSize = argc > 3 ? std::atoi(argv[3]) : 512;
+
+    const uint64_t loudFrames = static_cast<uint64_t>(loudSeconds * sampleRate);
+    const double audioSeconds = loudSeconds + 10.0;
+
+    std::printf("%.0f s of loud noise + 10 s quiet tail, %.0f Hz, buffer size %u\n", loudSeconds, sampleRate, bufferSize);
+
+    {
+        TreeMeter* const meter = new TreeMeter(sampleRate, bufferSize);
+        print("tree", run(*meter, sampleRate, loudFrames, bufferSize), audioSeconds);
+        delete meter;
+    }
+    {
+        PluginMeter<false> meter(sampleRate);
+        print("running", run(meter, sampleRate, loudFrames, bufferSize), audioSeconds);
+    }
+    {
+        PluginMeter<true> meter(sampleRate);
+        print("compensated", run(meter, sampleRate, loudFrames, bufferSize), audioSeconds);
+    }
+    {
+        BlockMeter meter(sampleRate);
+        print("block", run(meter, sampleRate, loudFrames, bufferSize), audioSeconds);
+    }
+
+    return 0;
+}
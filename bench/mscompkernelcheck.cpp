@@ -0,0 +1,165 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Check of the SoA mscomp gain kernel (see plugin/dsp/MscompGainKernel.hpp), failing if any linked gain is off
+// by 0.0001 dB or more from the scalar code it replaces.
+//
+// The reference is the faust generated gain computer code of pregen/Plugin.cpp, written once for all 16 lanes,
+// run over levels with loudness steps and band parameters spread over their ranges, so every knee region,
+// attack and release is hit. Without -ffast-math both give the same bits, with it compilers may reorder the
+// scalar code, so a tolerance is used. CPU time of both is reported too.
+//
+// usage: mscompkernelcheck [seconds]
+
+#include "dsp/MscompGainKernel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const float kMaxErrorDb = 0.0001f;
+static constexpr const uint32_t kSampleRate = 48000;
+
+static inline float faustpower2(const float x) noexcept
+{
+    return x * x;
+}
+
+struct BandParameters {
+    float threshold, kneeHalf, kneeLow, kneeHigh, kneeScale, strength, releasePole, attackPole, link;
+};
+
+// the per-lane statements of the faust code, in the same order
+struct ScalarGainComputers {
+    BandParameters bands[MscompGainKernel::kNumBands];
+    float gains[MscompGainKernel::kNumLanes] = {};
+
+    void process(const float* const levels, float* const linkedGains) noexcept
+    {
+        for (uint32_t l = 0; l < MscompGainKernel::kNumLanes; ++l)
+        {
+            const BandParameters& p(bands[l % MscompGainKernel::kNumBands]);
+            const float level = mscomp_linear2db(levels[l]);
+            const int region = (level > p.kneeLow) + (level > p.kneeHigh);
+            const float over = level - p.threshold;
+            const float then1 = over;
+            const float else1 = p.kneeScale * faustpower2(p.kneeHalf + over);
+            const float then2 = region == 1 ? else1 : then1;
+            const float gain = 0.0f - p.strength * std::max<float>(0.0f, region == 0 ? 0.0f : then2);
+            const float pole = gain > gains[l] ? p.releasePole : p.attackPole;
+            gains[l] = gain * (1.0f - pole) + gains[l] * pole;
+        }
+
+        for (uint32_t b = 0; b < MscompGainKernel::kNumBands; ++b)
+        {
+            const float first = gains[b];
+            const float second = gains[MscompGainKernel::kNumBands + b];
+            const float lowest = std::min<float>(first, second);
+            linkedGains[b] = first + bands[b].link * (lowest - first);
+            linkedGains[MscompGainKernel::kNumBands + b] = second + bands[b].link * (lowest - second);
+        }
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const uint32_t seconds = argc > 1 ? std::max(1, std::atoi(argv[1])) : 60;
+    const uint32_t numSamples = seconds * kSampleRate;
+
+    // parameters converted like the faust dsp does it, from values over the ranges of the plugin controls
+    ScalarGainComputers scalar;
+    MscompGainKernel kernel;
+    kernel.reset();
+
+    for (uint32_t b = 0; b < MscompGainKernel::kNumBands; ++b)
+    {
+        const float threshold = -40.f + 5.f * b;
+        const float knee = 1.f + 3.f * b;
+        const float attack = 0.0001f * (1 + b * 7);
+        const float release = 0.01f * (1 + b * 13);
+
+        BandParameters& p(scalar.bands[b]);
+        p.threshold = threshold;
+        p.kneeHalf = knee / 2.f;
+        p.kneeLow = threshold - knee / 2.f;
+        p.kneeHigh = threshold + knee / 2.f;
+        p.kneeScale = 0.5f / std::max<float>(1.1920929e-07f, knee);
+        p.strength = 0.1f + 0.25f * (b % 4);
+        p.releasePole = std::exp(-1.f / (kSampleRate * release));
+        p.attackPole = std::exp(-1.f / (kSampleRate * attack));
+        p.link = b / 7.f;
+
+        kernel.setBand(b, p.threshold, p.kneeHalf, p.kneeLow, p.kneeHigh, p.kneeScale, p.strength,
+                       p.releasePole, p.attackPole, p.link);
+    }
+
+    // band levels, with steps of 5 seconds from -80 to +6 dB, and each lane on its own noise
+    std::vector<float> levels(numSamples * MscompGainKernel::kNumLanes);
+    {
+        std::mt19937 rng(1);
+        std::normal_distribution<float> noise(0.f, 1.f);
+        std::uniform_real_distribution<float> step(-80.f, 6.f);
+        float stepGain = 1.f;
+
+        for (uint32_t i = 0; i < numSamples; ++i)
+        {
+            if (i % (kSampleRate * 5) == 0)
+                stepGain = std::pow(10.f, step(rng) / 20.f);
+
+            for (uint32_t l = 0; l < MscompGainKernel::kNumLanes; ++l)
+                levels[i * MscompGainKernel::kNumLanes + l] = std::fabs(stepGain * (l % 3 + 1) * noise(rng));
+        }
+    }
+
+    std::vector<float> scalarGains(numSamples * MscompGainKernel::kNumLanes);
+    std::vector<float> kernelGains(numSamples * MscompGainKernel::kNumLanes);
+    alignas(32) float laneLevels[MscompGainKernel::kNumLanes];
+    alignas(32) float laneGains[MscompGainKernel::kNumLanes];
+
+    const auto scalarStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numSamples; ++i)
+        scalar.process(&levels[i * MscompGainKernel::kNumLanes], &scalarGains[i * MscompGainKernel::kNumLanes]);
+    const auto scalarEnd = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < numSamples; ++i)
+    {
+        std::copy_n(&levels[i * MscompGainKernel::kNumLanes], MscompGainKernel::kNumLanes, laneLevels);
+        kernel.process(laneLevels, laneGains);
+        std::copy_n(laneGains, MscompGainKernel::kNumLanes, &kernelGains[i * MscompGainKernel::kNumLanes]);
+    }
+    const auto kernelEnd = std::chrono::steady_clock::now();
+
+    float maxError = 0.f;
+    uint32_t numDifferent = 0;
+    for (size_t i = 0; i < scalarGains.size(); ++i)
+    {
+        if (scalarGains[i] == kernelGains[i])
+            continue;
+        ++numDifferent;
+        maxError = std::max(maxError, std::fabs(scalarGains[i] - kernelGains[i]));
+    }
+
+    const double scalarTime = std::chrono::duration<double, std::nano>(scalarEnd - scalarStart).count();
+    const double kernelTime = std::chrono::duration<double, std::nano>(kernelEnd - scalarEnd).count();
+
+    std::printf("%u lanes of %u vector width, %u seconds at %u Hz\n",
+                MscompGainKernel::kNumLanes, MscompSimd::kWidth, seconds, kSampleRate);
+    std::printf("scalar %.1f ns/sample, kernel %.1f ns/sample\n", scalarTime / numSamples, kernelTime / numSamples);
+    std::printf("%u of %zu gains differ, max error %g dB\n", numDifferent, scalarGains.size(), maxError);
+
+    if (maxError >= kMaxErrorDb)
+    {
+        std::printf("FAILED: error of %g dB or more\n", kMaxErrorDb);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,335 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Check of the pipelined build stages (see pipeline/*.dsp) against the full master_me dsp, failing on errors of 0.01 dB or more.
+//
+// Two parts:
+//  - front.dsp followed by back.dsp against master_me.dsp, over a signal with loudness steps that keeps every
+//    compressor and the leveler busy; the output level (per block RMS) and every dB meter of the stages are compared
+//    at each block against the same meter of the full dsp
+//  - the handover done when switching pipelined processing on: stages with stale state from a different signal run
+//    alongside the full dsp until their leveler gain matches, as in MasterMePlugin::updatePipelineHandover,
+//    the time that takes is reported and the output level is compared afterwards
+//
+// usage: pipelinecheck [seconds] [buffer-size]
+
+#include "faust/gui/meta.h"
+#include "faust/gui/UI.h"
+#include "faust/dsp/dsp.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// generated from master_me.dsp and pipeline/*.dsp
+#include "master_me_full.h"
+#include "pipeline_front.h"
+#include "pipeline_back.h"
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const float kMaxErrorDb = 0.01f;
+
+// blocks quieter than this are not compared, their level is mostly dither from the limiter release
+static constexpr const float kMinLevelDb = -60.f;
+
+// same as in MasterMePlugin.cpp
+static constexpr const float kPipelineHandoverMinSeconds = 3.f;
+static constexpr const float kPipelineHandoverMaxSeconds = 60.f;
+static constexpr const float kPipelineHandoverMaxGainDifferenceDb = 0.05f;
+
+struct BargraphsUI : UI {
+    std::vector<std::string> labels;
+    std::vector<FAUSTFLOAT*> zones;
+    uint32_t numMscompMeters = 0;
+
+    void openTabBox(const char*) override {}
+    void openHorizontalBox(const char*) override {}
+    void openVerticalBox(const char*) override {}
+    void closeBox() override {}
+    void addButton(const char*, FAUSTFLOAT*) override {}
+    void addCheckButton(const char*, FAUSTFLOAT*) override {}
+    void addVerticalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addNumEntry(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addVerticalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addSoundfile(const char*, const char*, Soundfile**) override {}
+
+    void add(const char* const label, FAUSTFLOAT* const zone)
+    {
+        // mscomp meters have no label, name them by position
+        labels.push_back(std::strncmp(label, "0x", 2) == 0 ? "mscomp meter " + std::to_string(numMscompMeters++) : label);
+        zones.push_back(zone);
+    }
+
+    FAUSTFLOAT* find(const std::string& label) const
+    {
+        for (size_t i = 0; i < labels.size(); ++i)
+            if (labels[i] == label)
+                return zones[i];
+
+        return nullptr;
+    }
+};
+
+static bool report(const char* const name, const float error, const bool check = true)
+{
+    const bool ok = !check || error < kMaxErrorDb;
+    std::printf("  %-28s %10.6f%s\n", name, error, check ? (ok ? " dB" : " dB  FAILED") : " (not checked)");
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// deterministic stereo pinkish noise, changing level every 2 seconds, same as in fastmathcheck.cpp
+struct SignalGenerator {
+    static constexpr const float kLevels[] = { -30.f, -12.f, -3.f, -40.f, -20.f, -6.f, 0.f, -45.f, -24.f, -9.f };
+
+    uint32_t seed;
+    uint64_t frame = 0;
+    float lowL = 0.f, lowR = 0.f;
+    const double sampleRate;
+
+    SignalGenerator(const double sr, const uint32_t s = 1) : seed(s), sampleRate(sr) {}
+
+    float noise() noexcept
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 9) / 4194304.f - 1.f;
+    }
+
+    void generate(float* const left, float* const right, const uint32_t frames, const float offsetDb = 0.f) noexcept
+    {
+        for (uint32_t i = 0; i < frames; ++i, ++frame)
+        {
+            const uint32_t step = static_cast<uint32_t>(frame / static_cast<uint64_t>(2 * sampleRate));
+            const float db = kLevels[step % (sizeof(kLevels) / sizeof(kLevels[0]))] + offsetDb;
+            const float gain = std::pow(10.f, db * 0.05f);
+
+            // one-pole lowpass mixed with white, more low end than white noise alone
+            const float nl = noise(), nr = noise();
+            lowL += 0.02f * (nl - lowL);
+            lowR += 0.02f * (0.5f * nl + 0.5f * nr - lowR);
+            left[i] = gain * (4.f * lowL + 0.25f * nl);
+            right[i] = gain * (4.f * lowR + 0.25f * nr);
+        }
+    }
+};
+
+static float levelDb(const float* const left, const float* const right, const uint32_t frames)
+{
+    double energy = 0.0;
+    for (uint32_t i = 0; i < frames; ++i)
+        energy += left[i] * left[i] + right[i] * right[i];
+
+    return static_cast<float>(10.0 * std::log10(std::max(1e-30, energy / (frames * 2))));
+}
+
+// both stages and the buffers between them, run one after the other without the plugin fifos
+struct Stages {
+    pipeline_front front;
+    pipeline_back back;
+    BargraphsUI frontUI, backUI;
+    std::vector<float> buffers[4];
+
+    Stages(const int sampleRate, const uint32_t bufferSize)
+    {
+        front.init(sampleRate);
+        back.init(sampleRate);
+        front.buildUserInterface(&frontUI);
+        back.buildUserInterface(&backUI);
+
+        for (std::vector<float>& buffer : buffers)
+            buffer.resize(bufferSize);
+    }
+
+    void compute(const uint32_t frames, FAUSTFLOAT** const inputs, FAUSTFLOAT** const outputs)
+    {
+        FAUSTFLOAT* between[4] = { buffers[0].data(), buffers[1].data(), buffers[2].data(), buffers[3].data() };
+        front.compute(frames, inputs, between);
+        back.compute(frames, between, outputs);
+    }
+
+    FAUSTFLOAT* find(const std::string& label) const
+    {
+        if (FAUSTFLOAT* const zone = frontUI.find(label))
+            return zone;
+        return backUI.find(label);
+    }
+};
+
+static bool checkStages(const double sampleRate, const double seconds, const uint32_t bufferSize)
+{
+    master_me_full* const full = new master_me_full;
+    Stages* const stages = new Stages(static_cast<int>(sampleRate), bufferSize);
+    BargraphsUI fullUI;
+
+    full->init(static_cast<int>(sampleRate));
+    full->buildUserInterface(&fullUI);
+
+    // every meter is in one of the stages, a missing one is an error in pipeline/*.dsp
+    std::vector<FAUSTFLOAT*> stageZones;
+    bool ok = true;
+
+    for (const std::string& label : fullUI.labels)
+    {
+        stageZones.push_back(stages->find(label));
+
+        if (stageZones.back() == nullptr)
+        {
+            std::printf("  meter \"%s\" is in neither stage  FAILED\n", label.c_str());
+            ok = false;
+        }
+    }
+
+    std::vector<float> meterErrors(fullUI.zones.size(), 0.f);
+    float outputError = 0.f;
+
+    std::vector<float> inL(bufferSize), inR(bufferSize);
+    std::vector<float> fullL(bufferSize), fullR(bufferSize), stagesL(bufferSize), stagesR(bufferSize);
+    FAUSTFLOAT* inputs[2] = { inL.data(), inR.data() };
+    FAUSTFLOAT* fullOutputs[2] = { fullL.data(), fullR.data() };
+    FAUSTFLOAT* stagesOutputs[2] = { stagesL.data(), stagesR.data() };
+
+    SignalGenerator generator(sampleRate);
+    const uint64_t numFrames = static_cast<uint64_t>(seconds * sampleRate);
+
+    for (uint64_t frame = 0; frame < numFrames; frame += bufferSize)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+
+        full->compute(bufferSize, inputs, fullOutputs);
+        stages->compute(bufferSize, inputs, stagesOutputs);
+
+        for (size_t i = 0; i < stageZones.size(); ++i)
+            if (stageZones[i] != nullptr)
+                meterErrors[i] = std::max(meterErrors[i], std::fabs(*fullUI.zones[i] - *stageZones[i]));
+
+        const float fullLevel = levelDb(fullL.data(), fullR.data(), bufferSize);
+
+        if (fullLevel > kMinLevelDb)
+            outputError = std::max(outputError, std::fabs(fullLevel - levelDb(stagesL.data(), stagesR.data(), bufferSize)));
+    }
+
+    std::printf("stages at %.0f Hz, max error:\n", sampleRate);
+
+    ok &= report("output level", outputError);
+
+    for (size_t i = 0; i < fullUI.labels.size(); ++i)
+        ok &= report(fullUI.labels[i].c_str(), meterErrors[i], fullUI.labels[i] != "leveler brake");
+
+    delete full;
+    delete stages;
+    return ok;
+}
+
+static bool checkHandover(const double sampleRate, const uint32_t bufferSize)
+{
+    master_me_full* const full = new master_me_full;
+    Stages* const stages = new Stages(static_cast<int>(sampleRate), bufferSize);
+    BargraphsUI fullUI;
+
+    full->init(static_cast<int>(sampleRate));
+    full->buildUserInterface(&fullUI);
+
+    FAUSTFLOAT* const fullGain = fullUI.find("leveler gain");
+    FAUSTFLOAT* const stagesGain = stages->find("leveler gain");
+
+    if (fullGain == nullptr || stagesGain == nullptr)
+    {
+        std::printf("handover: no leveler gain meter  FAILED\n");
+        return false;
+    }
+
+    std::vector<float> inL(bufferSize), inR(bufferSize);
+    std::vector<float> fullL(bufferSize), fullR(bufferSize), stagesL(bufferSize), stagesR(bufferSize);
+    FAUSTFLOAT* inputs[2] = { inL.data(), inR.data() };
+    FAUSTFLOAT* fullOutputs[2] = { fullL.data(), fullR.data() };
+    FAUSTFLOAT* stagesOutputs[2] = { stagesL.data(), stagesR.data() };
+
+    // stale stage state, as left from an earlier time with pipelined processing, 12 dB quieter and another signal
+    SignalGenerator staleGenerator(sampleRate, 7);
+    for (uint64_t frame = 0; frame < static_cast<uint64_t>(30 * sampleRate); frame += bufferSize)
+    {
+        staleGenerator.generate(inL.data(), inR.data(), bufferSize, -12.f);
+        stages->compute(bufferSize, inputs, stagesOutputs);
+    }
+
+    SignalGenerator generator(sampleRate);
+    for (uint64_t frame = 0; frame < static_cast<uint64_t>(30 * sampleRate); frame += bufferSize)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+        full->compute(bufferSize, inputs, fullOutputs);
+    }
+
+    const float initialDifference = std::fabs(*fullGain - *stagesGain);
+
+    // pipelined processing switched on, the stages run alongside until in sync
+    uint64_t handoverFrames = 0;
+
+    for (;;)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+        full->compute(bufferSize, inputs, fullOutputs);
+        stages->compute(bufferSize, inputs, stagesOutputs);
+        handoverFrames += bufferSize;
+
+        if (handoverFrames < kPipelineHandoverMinSeconds * sampleRate)
+            continue;
+        if (std::fabs(*fullGain - *stagesGain) > kPipelineHandoverMaxGainDifferenceDb &&
+            handoverFrames < kPipelineHandoverMaxSeconds * sampleRate)
+            continue;
+        break;
+    }
+
+    // the stages take over, the output level should now follow the full dsp closely
+    float outputError = 0.f;
+
+    for (uint64_t frame = 0; frame < static_cast<uint64_t>(10 * sampleRate); frame += bufferSize)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+        full->compute(bufferSize, inputs, fullOutputs);
+        stages->compute(bufferSize, inputs, stagesOutputs);
+
+        const float fullLevel = levelDb(fullL.data(), fullR.data(), bufferSize);
+
+        if (fullLevel > kMinLevelDb)
+            outputError = std::max(outputError, std::fabs(fullLevel - levelDb(stagesL.data(), stagesR.data(), bufferSize)));
+    }
+
+    std::printf("handover at %.0f Hz, leveler gain %.2f dB apart, in sync after %.2f s, then max error:\n",
+                sampleRate, initialDifference, handoverFrames / sampleRate);
+
+    // one block of difference in the leveler gain is still allowed for
+    const bool ok = outputError < kPipelineHandoverMaxGainDifferenceDb + kMaxErrorDb;
+    std::printf("  %-28s %10.6f%s\n", "output level", outputError, ok ? " dB" : " dB  FAILED");
+
+    delete full;
+    delete stages;
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 60.0;
+    const uint32_t bufferSize = argc > 2 ? std::atoi(argv[2]) : 512;
+
+    bool ok = true;
+
+    for (const double sampleRate : { 44100.0, 48000.0, 96000.0 })
+    {
+        ok &= checkStages(sampleRate, seconds, bufferSize);
+        ok &= checkHandover(sampleRate, bufferSize);
+    }
+
+    std::printf(ok ? "pipeline stages ok\n" : "pipeline stages check FAILED\n");
+    return ok ? 0 : 1;
+}
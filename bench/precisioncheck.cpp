@@ -0,0 +1,234 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Accuracy check of the single precision build against faust's `-double`, failing if any gain is off by 0.01 dB or more.
+//
+// The plugin runs the faust code in single precision, which vectorizes twice as wide as double.
+// Recursions that float cannot resolve are written to not need double instead (see precise_lp1 in master_me.dsp),
+// this check finds out which ones those are: every stage from bench/stages and the full chain are compiled both ways
+// and run side by side, over a signal with loudness steps that keeps every compressor and the leveler busy.
+// All dB meters and the output level (per block RMS) are compared at each block, cpu time of both is reported too.
+//
+// The leveler brake meter is in percent, so it is only reported.
+// So are the peak meters, which fall by a fixed step per sample; float rounds each step, so the fall ends up a few
+// hundredths of a dB different in length, which is not audible and cannot be seen on the meters.
+//
+// usage: precisioncheck [seconds] [buffer-size]
+
+#include "faust/gui/meta.h"
+#include "faust/gui/UI.h"
+#include "faust/dsp/dsp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// generated from bench/stages/*.dsp and master_me.dsp, regular and with `-double`
+#include "stage_pre_single.h"
+#include "stage_pre_double.h"
+#include "stage_gate_single.h"
+#include "stage_gate_double.h"
+#include "stage_eq_single.h"
+#include "stage_eq_double.h"
+#include "stage_leveler_single.h"
+#include "stage_leveler_double.h"
+#include "stage_kneecomp_single.h"
+#include "stage_kneecomp_double.h"
+#include "stage_mscomp_single.h"
+#include "stage_mscomp_double.h"
+#include "stage_limiter_single.h"
+#include "stage_limiter_double.h"
+#include "stage_brickwall_single.h"
+#include "stage_brickwall_double.h"
+#include "master_me_single.h"
+#include "master_me_double.h"
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const float kMaxErrorDb = 0.01f;
+
+// blocks quieter than this are not compared, their level is mostly dither from the limiter release
+static constexpr const float kMinLevelDb = -60.f;
+
+// neither is the first block after each loudness step, where every compressor starts releasing at once
+// and the output level mostly depends on the exact sample each of them lets go
+static constexpr const uint32_t kStepSeconds = 2;
+
+struct BargraphsUI : UI {
+    std::vector<std::string> labels;
+    std::vector<FAUSTFLOAT*> zones;
+    uint32_t numMscompMeters = 0;
+
+    void openTabBox(const char*) override {}
+    void openHorizontalBox(const char*) override {}
+    void openVerticalBox(const char*) override {}
+    void closeBox() override {}
+    void addButton(const char*, FAUSTFLOAT*) override {}
+    void addCheckButton(const char*, FAUSTFLOAT*) override {}
+    void addVerticalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalSlider(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addNumEntry(const char*, FAUSTFLOAT*, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT, FAUSTFLOAT) override {}
+    void addHorizontalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addVerticalBargraph(const char* l, FAUSTFLOAT* z, FAUSTFLOAT, FAUSTFLOAT) override { add(l, z); }
+    void addSoundfile(const char*, const char*, Soundfile**) override {}
+
+    void add(const char* const label, FAUSTFLOAT* const zone)
+    {
+        // mscomp meters have no label, name them by position
+        labels.push_back(std::strncmp(label, "0x", 2) == 0 ? "mscomp meter " + std::to_string(numMscompMeters++) : label);
+        zones.push_back(zone);
+    }
+};
+
+static bool isChecked(const std::string& label)
+{
+    return label != "leveler brake" && label != "in L" && label != "in R" && label != "out L" && label != "out R";
+}
+
+static bool report(const char* const name, const float error, const bool check = true)
+{
+    const bool ok = !check || error < kMaxErrorDb;
+    std::printf("    %-26s %10.6f%s\n", name, error, check ? (ok ? " dB" : " dB  FAILED") : " (not checked)");
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// deterministic stereo pinkish noise, changing level every kStepSeconds
+struct SignalGenerator {
+    static constexpr const float kLevels[] = { -30.f, -12.f, -3.f, -40.f, -20.f, -6.f, 0.f, -45.f, -24.f, -9.f };
+
+    uint32_t seed = 1;
+    uint64_t frame = 0;
+    float lowL = 0.f, lowR = 0.f;
+    const double sampleRate;
+
+    explicit SignalGenerator(const double sr) : sampleRate(sr) {}
+
+    float noise() noexcept
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 9) / 4194304.f - 1.f;
+    }
+
+    void generate(float* const left, float* const right, const uint32_t frames) noexcept
+    {
+        for (uint32_t i = 0; i < frames; ++i, ++frame)
+        {
+            const uint32_t step = static_cast<uint32_t>(frame / static_cast<uint64_t>(kStepSeconds * sampleRate));
+            const float gain = std::pow(10.f, kLevels[step % (sizeof(kLevels) / sizeof(kLevels[0]))] * 0.05f);
+
+            // one-pole lowpass mixed with white, more low end than white noise alone
+            const float nl = noise(), nr = noise();
+            lowL += 0.02f * (nl - lowL);
+            lowR += 0.02f * (0.5f * nl + 0.5f * nr - lowR);
+            left[i] = gain * (4.f * lowL + 0.25f * nl);
+            right[i] = gain * (4.f * lowR + 0.25f * nr);
+        }
+    }
+};
+
+static float levelDb(const float* const left, const float* const right, const uint32_t frames)
+{
+    double energy = 0.0;
+    for (uint32_t i = 0; i < frames; ++i)
+        energy += left[i] * left[i] + right[i] * right[i];
+
+    return static_cast<float>(10.0 * std::log10(std::max(1e-30, energy / (frames * 2))));
+}
+
+template <class Single, class Double>
+static bool checkDsp(const char* const name, const double sampleRate, const double seconds, const uint32_t bufferSize)
+{
+    Single* const single = new Single;
+    Double* const dbl = new Double;
+    BargraphsUI singleUI, doubleUI;
+
+    single->init(static_cast<int>(sampleRate));
+    dbl->init(static_cast<int>(sampleRate));
+    single->buildUserInterface(&singleUI);
+    dbl->buildUserInterface(&doubleUI);
+
+    const size_t numMeters = singleUI.zones.size();
+    std::vector<float> meterErrors(numMeters, 0.f);
+    float outputError = 0.f;
+    double singleSeconds = 0.0, doubleSeconds = 0.0;
+
+    std::vector<float> inL(bufferSize), inR(bufferSize);
+    std::vector<float> singleL(bufferSize), singleR(bufferSize), doubleL(bufferSize), doubleR(bufferSize);
+    FAUSTFLOAT* inputs[2] = { inL.data(), inR.data() };
+    FAUSTFLOAT* singleOutputs[2] = { singleL.data(), singleR.data() };
+    FAUSTFLOAT* doubleOutputs[2] = { doubleL.data(), doubleR.data() };
+
+    SignalGenerator generator(sampleRate);
+    const uint64_t numFrames = static_cast<uint64_t>(seconds * sampleRate);
+    const uint64_t stepFrames = static_cast<uint64_t>(kStepSeconds * sampleRate);
+
+    for (uint64_t frame = 0; frame < numFrames; frame += bufferSize)
+    {
+        generator.generate(inL.data(), inR.data(), bufferSize);
+
+        const auto start = std::chrono::steady_clock::now();
+        single->compute(bufferSize, inputs, singleOutputs);
+        const auto middle = std::chrono::steady_clock::now();
+        dbl->compute(bufferSize, inputs, doubleOutputs);
+        const auto end = std::chrono::steady_clock::now();
+
+        singleSeconds += std::chrono::duration<double>(middle - start).count();
+        doubleSeconds += std::chrono::duration<double>(end - middle).count();
+
+        for (size_t i = 0; i < numMeters; ++i)
+            meterErrors[i] = std::max(meterErrors[i], std::fabs(*singleUI.zones[i] - *doubleUI.zones[i]));
+
+        const float doubleLevel = levelDb(doubleL.data(), doubleR.data(), bufferSize);
+
+        if (doubleLevel > kMinLevelDb && frame % stepFrames >= bufferSize)
+            outputError = std::max(outputError, std::fabs(doubleLevel - levelDb(singleL.data(), singleR.data(), bufferSize)));
+    }
+
+    std::printf("  %s, cpu %.3f s single, %.3f s double (%.2fx), max error:\n",
+                name, singleSeconds, doubleSeconds, doubleSeconds / singleSeconds);
+
+    bool ok = report("output level", outputError);
+
+    for (size_t i = 0; i < numMeters; ++i)
+        ok &= report(singleUI.labels[i].c_str(), meterErrors[i], isChecked(singleUI.labels[i]));
+
+    delete single;
+    delete dbl;
+    return ok;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 30.0;
+    const uint32_t bufferSize = argc > 2 ? std::atoi(argv[2]) : 512;
+
+    bool ok = true;
+
+    // slow recursions lose the most resolution at high sample rates, where their poles get closest to 1
+    for (const double sampleRate : { 44100.0, 48000.0, 96000.0, 192000.0 })
+    {
+        std::printf("dsp at %.0f Hz:\n", sampleRate);
+        ok &= checkDsp<stage_pre_single, stage_pre_double>("pre", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_gate_single, stage_gate_double>("gate", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_eq_single, stage_eq_double>("eq", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_leveler_single, stage_leveler_double>("leveler", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_kneecomp_single, stage_kneecomp_double>("kneecomp", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_mscomp_single, stage_mscomp_double>("mscomp", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_limiter_single, stage_limiter_double>("limiter", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<stage_brickwall_single, stage_brickwall_double>("brickwall", sampleRate, seconds, bufferSize);
+        ok &= checkDsp<master_me_single, master_me_double>("full", sampleRate, seconds, bufferSize);
+    }
+
+    std::printf(ok ? "single precision accuracy ok\n" : "single precision accuracy check FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,855 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Offline renderer, processing audio files with the faust dsp as fast as possible (no host, no realtime constraints).
+//
+// Uses the same mydsp from pregen/Plugin.cpp as the plugin, driven directly, one instance per worker thread.
+// Input WAV files are memory-mapped and streamed in large blocks, other formats (FLAC, etc) need libsndfile.
+// Parameters come from one of the easy presets, optionally followed by a state file, which is either
+// an LV2 preset/state .ttl file or a plain text file with one "symbol value" pair per line.
+//
+// Notes:
+//  - only the faust dsp is used, the plugin side extras (true-peak/lookahead brickwall) are not included,
+//    except for the lookahead leveler with -a, which replaces the faust leveler
+//  - output has the same length as the input and is aligned to it, mono files are processed as dual-mono
+//
+// usage: render [options] input-file...
+//   -p <preset>   easy preset, by index or name (default 0, see -l)
+//   -s <file>     state file to apply after the preset
+//   -o <path>     output directory, or output file if there is a single input (default: next to each input)
+//   -b <bits>     output bits, 16 or 24 (dithered) or 32 (float, default)
+//   -j <threads>  number of files to process in parallel (default: number of cpus)
+//   -a <seconds>  analyze loudness ahead of the audio, using the lookahead leveler (1 to 10 seconds)
+//   -l            list presets and exit
+
+#include "DistrhoPlugin.hpp"
+#include "extra/ScopedDenormalDisable.hpp"
+
+// faustpp generated plugin template, only mydsp is used
+#include "DistrhoPluginInfo.h"
+#include "Plugin.cpp"
+
+#include "dsp/LookaheadLeveler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#define strcasecmp _stricmp
+#else
+#include <fcntl.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SNDFILE
+#include <sndfile.h>
+#endif
+
+using namespace DISTRHO;
+
+// frames per compute call
+static constexpr const uint32_t kBlockSize = 8192;
+
+// all input parameters are stored in presets
+static constexpr const uint32_t kNumInputParameters = ARRAY_SIZE(kEasyPresets[0].values);
+
+// --------------------------------------------------------------------------------------------------------------------
+// parameters
+
+struct ParameterValue {
+    uint32_t index;
+    float value;
+};
+
+static bool findParameter(const char* const symbol, uint32_t& index)
+{
+    for (uint32_t i = 0; i < kNumInputParameters; ++i)
+    {
+        if (std::strcmp(kParameterSymbols[i], symbol) == 0)
+        {
+            index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool addParameter(std::vector<ParameterValue>& params, const char* const symbol, const float value)
+{
+    uint32_t index;
+    if (! findParameter(symbol, index))
+    {
+        std::fprintf(stderr, "warning: unknown parameter '%s', ignored\n", symbol);
+        return false;
+    }
+
+    // later values override earlier ones, so a state file can be applied over a preset
+    params.push_back({ index, std::max(kParameterRanges[index].min, std::min(kParameterRanges[index].max, value)) });
+    return true;
+}
+
+static bool loadPreset(std::vector<ParameterValue>& params, const char* const arg)
+{
+    char* end = nullptr;
+    const long number = std::strtol(arg, &end, 10);
+    uint32_t preset = ARRAY_SIZE(kEasyPresets);
+
+    if (end != arg && *end == '\0')
+    {
+        if (number >= 0 && number < static_cast<long>(ARRAY_SIZE(kEasyPresets)))
+            preset = static_cast<uint32_t>(number);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < ARRAY_SIZE(kEasyPresets); ++i)
+        {
+            if (strcasecmp(kEasyPresets[i].name, arg) == 0)
+            {
+                preset = i;
+                break;
+            }
+        }
+    }
+
+    if (preset == ARRAY_SIZE(kEasyPresets))
+    {
+        std::fprintf(stderr, "error: unknown preset '%s', use -l to list them\n", arg);
+        return false;
+    }
+
+    // same as MasterMePlugin::loadProgram, skipping global bypass
+    for (uint32_t i = 1; i < kNumInputParameters; ++i)
+        params.push_back({ i, kEasyPresets[preset].values[i] });
+
+    return true;
+}
+
+// LV2 ttl, looking for 'lv2:symbol "name"' followed by 'pset:value number'; or plain "symbol value" lines
+static bool loadStateFile(std::vector<ParameterValue>& params, const char* const filename)
+{
+    FILE* const f = std::fopen(filename, "rb");
+    if (f == nullptr)
+    {
+        std::fprintf(stderr, "error: cannot open state file '%s'\n", filename);
+        return false;
+    }
+
+    std::string text;
+    char buf[4096];
+    for (size_t r; (r = std::fread(buf, 1, sizeof(buf), f)) != 0;)
+        text.append(buf, r);
+    std::fclose(f);
+
+    if (text.find("lv2:symbol") != std::string::npos)
+    {
+        for (size_t pos = 0; (pos = text.find("lv2:symbol", pos)) != std::string::npos;)
+        {
+            const size_t start = text.find('"', pos);
+            const size_t end = start != std::string::npos ? text.find('"', start + 1) : std::string::npos;
+            const size_t valuepos = end != std::string::npos ? text.find("pset:value", end) : std::string::npos;
+            if (valuepos == std::string::npos)
+                break;
+
+            // value must belong to the same port, before any next symbol
+            const size_t nextpos = text.find("lv2:symbol", end);
+            if (nextpos == std::string::npos || valuepos < nextpos)
+                addParameter(params, text.substr(start + 1, end - start - 1).c_str(),
+                             std::strtof(text.c_str() + valuepos + 10, nullptr));
+
+            pos = end;
+        }
+    }
+    else
+    {
+        for (size_t pos = 0; pos < text.size();)
+        {
+            size_t end = text.find('\n', pos);
+            if (end == std::string::npos)
+                end = text.size();
+
+            const std::string line = text.substr(pos, end - pos);
+            pos = end + 1;
+
+            char symbol[64];
+            float value;
+            if (line.empty() || line[0] == '#' || std::sscanf(line.c_str(), "%63s %f", symbol, &value) != 2)
+                continue;
+
+            addParameter(params, symbol, value);
+        }
+    }
+
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// audio file input
+
+struct AudioReader {
+    uint32_t channels = 0;
+    uint32_t sampleRate = 0;
+    uint64_t frames = 0;
+
+    virtual ~AudioReader() {}
+
+    // read and deinterleave up to kBlockSize frames, returning the amount read
+    virtual uint32_t read(float* left, float* right, uint32_t frames) = 0;
+};
+
+static inline uint16_t readLE16(const uint8_t* const p) noexcept
+{
+    return static_cast<uint16_t>(p[0] | p[1] << 8);
+}
+
+static inline uint32_t readLE32(const uint8_t* const p) noexcept
+{
+    return static_cast<uint32_t>(p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24);
+}
+
+// memory-mapped WAV file, PCM 16/24/32 bits or 32 bits float
+class WavReader : public AudioReader
+{
+public:
+    ~WavReader() override
+    {
+       #ifdef _WIN32
+        delete[] mapped;
+       #else
+        if (mapped != nullptr)
+            munmap(mapped, mappedSize);
+       #endif
+    }
+
+    bool open(const char* const filename)
+    {
+       #ifdef _WIN32
+        // no mapping here, just read it all
+        FILE* const f = std::fopen(filename, "rb");
+        if (f == nullptr)
+            return false;
+
+        std::fseek(f, 0, SEEK_END);
+        mappedSize = static_cast<size_t>(std::ftell(f));
+        std::fseek(f, 0, SEEK_SET);
+        mapped = new uint8_t[mappedSize];
+        const bool ok = std::fread(mapped, 1, mappedSize, f) == mappedSize;
+        std::fclose(f);
+        if (! ok)
+            return false;
+       #else
+        const int fd = ::open(filename, O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < 44)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        mappedSize = static_cast<size_t>(st.st_size);
+        void* const ptr = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (ptr == MAP_FAILED)
+            return false;
+
+        mapped = static_cast<uint8_t*>(ptr);
+        madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+       #endif
+
+        return parse();
+    }
+
+    uint32_t read(float* const left, float* const right, uint32_t numFrames) override
+    {
+        numFrames = static_cast<uint32_t>(std::min<uint64_t>(numFrames, frames - position));
+
+        const uint32_t frameSize = bytesPerSample * channels;
+        const uint8_t* p = data + position * frameSize;
+
+        for (uint32_t i = 0; i < numFrames; ++i, p += frameSize)
+        {
+            left[i] = sample(p);
+            right[i] = channels > 1 ? sample(p + bytesPerSample) : left[i];
+        }
+
+        position += numFrames;
+        return numFrames;
+    }
+
+private:
+    uint8_t* mapped = nullptr;
+    size_t mappedSize = 0;
+    const uint8_t* data = nullptr;
+    uint64_t position = 0;
+    uint32_t bytesPerSample = 0;
+    bool isFloat = false;
+
+    bool parse()
+    {
+        if (std::memcmp(mapped, "RIFF", 4) != 0 || std::memcmp(mapped + 8, "WAVE", 4) != 0)
+            return false;
+
+        bool hasFormat = false;
+
+        for (size_t pos = 12; pos + 8 <= mappedSize;)
+        {
+            const uint8_t* const chunk = mapped + pos;
+            const uint32_t chunkSize = readLE32(chunk + 4);
+
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16 && pos + 8 + chunkSize <= mappedSize)
+            {
+                uint16_t format = readLE16(chunk + 8);
+
+                // WAVE_FORMAT_EXTENSIBLE, actual format is in the sub-format GUID
+                if (format == 0xfffe && chunkSize >= 40)
+                    format = readLE16(chunk + 32);
+
+                channels = readLE16(chunk + 10);
+                sampleRate = readLE32(chunk + 12);
+                bytesPerSample = readLE16(chunk + 22) / 8;
+                isFloat = format == 3;
+                hasFormat = (format == 1 && bytesPerSample >= 2 && bytesPerSample <= 4) ||
+                            (format == 3 && bytesPerSample == 4);
+            }
+            else if (std::memcmp(chunk, "data", 4) == 0 && hasFormat)
+            {
+                if (channels < 1 || channels > 2 || sampleRate == 0)
+                    return false;
+
+                data = chunk + 8;
+
+                // streamed or truncated files, use whatever is there
+                frames = std::min<uint64_t>(chunkSize, mappedSize - pos - 8) / (bytesPerSample * channels);
+                return true;
+            }
+
+            pos += 8 + chunkSize + (chunkSize & 1);
+        }
+
+        return false;
+    }
+
+    inline float sample(const uint8_t* const p) const noexcept
+    {
+        switch (bytesPerSample)
+        {
+        case 2:
+            return static_cast<int16_t>(readLE16(p)) * (1.f / 32768.f);
+        case 3:
+            return static_cast<int32_t>(static_cast<uint32_t>(p[0] << 8 | p[1] << 16 | p[2] << 24)) * (1.f / 2147483648.f);
+        default:
+            if (isFloat)
+            {
+                const uint32_t bits = readLE32(p);
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+            return static_cast<int32_t>(readLE32(p)) * (1.f / 2147483648.f);
+        }
+    }
+};
+
+#ifdef HAVE_SNDFILE
+class SndfileReader : public AudioReader
+{
+public:
+    ~SndfileReader() override
+    {
+        if (file != nullptr)
+            sf_close(file);
+    }
+
+    bool open(const char* const filename)
+    {
+        SF_INFO info = {};
+        file = sf_open(filename, SFM_READ, &info);
+
+        if (file == nullptr || info.channels < 1 || info.channels > 2)
+            return false;
+
+        channels = info.channels;
+        sampleRate = info.samplerate;
+        frames = info.frames;
+        return true;
+    }
+
+    uint32_t read(float* const left, float* const right, const uint32_t numFrames) override
+    {
+        const uint32_t r = static_cast<uint32_t>(sf_readf_float(file, interleaved, std::min(numFrames, kBlockSize)));
+
+        for (uint32_t i = 0; i < r; ++i)
+        {
+            left[i] = interleaved[i * channels];
+            right[i] = interleaved[i * channels + channels - 1];
+        }
+
+        return r;
+    }
+
+private:
+    SNDFILE* file = nullptr;
+    float interleaved[kBlockSize * 2];
+};
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------
+// audio file output
+
+struct AudioWriter {
+    virtual ~AudioWriter() {}
+    virtual bool write(const float* left, const float* right, uint32_t frames) = 0;
+};
+
+class WavWriter : public AudioWriter
+{
+public:
+    WavWriter(const uint32_t outputBits, const uint32_t seed) noexcept
+        : bits(outputBits),
+          ditherSeed(seed) {}
+
+    ~WavWriter() override
+    {
+        if (file != nullptr)
+            std::fclose(file);
+    }
+
+    bool open(const char* const filename, const uint32_t channelCount, const uint32_t sampleRate, const uint64_t frames)
+    {
+        channels = channelCount;
+
+        const uint32_t bytesPerSample = bits / 8;
+        const uint64_t dataSize = frames * channels * bytesPerSample;
+        if (dataSize > 0xffffffffULL - 36)
+            return false;
+
+        file = std::fopen(filename, "wb");
+        if (file == nullptr)
+            return false;
+
+        uint8_t header[44];
+        std::memcpy(header, "RIFF", 4);
+        writeLE32(header + 4, static_cast<uint32_t>(36 + dataSize));
+        std::memcpy(header + 8, "WAVEfmt ", 8);
+        writeLE32(header + 16, 16);
+        writeLE16(header + 20, bits == 32 ? 3 : 1);
+        writeLE16(header + 22, channels);
+        writeLE32(header + 24, sampleRate);
+        writeLE32(header + 28, sampleRate * channels * bytesPerSample);
+        writeLE16(header + 32, channels * bytesPerSample);
+        writeLE16(header + 34, bits);
+        std::memcpy(header + 36, "data", 4);
+        writeLE32(header + 40, static_cast<uint32_t>(dataSize));
+
+        return std::fwrite(header, 1, sizeof(header), file) == sizeof(header);
+    }
+
+    bool write(const float* const left, const float* const right, const uint32_t frames) override
+    {
+        const uint32_t bytesPerSample = bits / 8;
+        uint8_t* p = buffer;
+
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            p = encode(p, left[i]);
+            if (channels > 1)
+                p = encode(p, right[i]);
+        }
+
+        const size_t size = static_cast<size_t>(frames) * channels * bytesPerSample;
+        return std::fwrite(buffer, 1, size, file) == size;
+    }
+
+private:
+    FILE* file = nullptr;
+    const uint32_t bits;
+    uint32_t channels = 0;
+    uint32_t ditherSeed;
+    uint8_t buffer[kBlockSize * 2 * 4];
+
+    static inline void writeLE16(uint8_t* const p, const uint32_t v) noexcept
+    {
+        p[0] = v & 0xff;
+        p[1] = (v >> 8) & 0xff;
+    }
+
+    static inline void writeLE32(uint8_t* const p, const uint32_t v) noexcept
+    {
+        writeLE16(p, v & 0xffff);
+        writeLE16(p + 2, v >> 16);
+    }
+
+    // triangular dither, 1 LSB peak
+    inline float dither() noexcept
+    {
+        ditherSeed = ditherSeed * 1664525u + 1013904223u;
+        const float a = static_cast<float>(ditherSeed >> 8) * (1.f / 16777216.f);
+        ditherSeed = ditherSeed * 1664525u + 1013904223u;
+        const float b = static_cast<float>(ditherSeed >> 8) * (1.f / 16777216.f);
+        return a - b;
+    }
+
+    inline uint8_t* encode(uint8_t* const p, const float value) noexcept
+    {
+        if (bits == 32)
+        {
+            uint32_t v;
+            std::memcpy(&v, &value, sizeof(v));
+            writeLE32(p, v);
+            return p + 4;
+        }
+
+        const float scale = bits == 16 ? 32768.f : 8388608.f;
+        const float v = std::max(-scale, std::min(scale - 1.f, std::nearbyint(value * scale + dither())));
+        const uint32_t iv = static_cast<uint32_t>(static_cast<int32_t>(v));
+
+        writeLE16(p, iv & 0xffff);
+        if (bits == 16)
+            return p + 2;
+
+        p[2] = (iv >> 16) & 0xff;
+        return p + 3;
+    }
+};
+
+#ifdef HAVE_SNDFILE
+class SndfileWriter : public AudioWriter
+{
+public:
+    ~SndfileWriter() override
+    {
+        if (file != nullptr)
+            sf_close(file);
+    }
+
+    bool open(const char* const filename, const uint32_t channelCount, const uint32_t sampleRate, const uint32_t bits)
+    {
+        SF_INFO info = {};
+        info.channels = channels = channelCount;
+        info.samplerate = sampleRate;
+        info.format = sf_format_from_filename(filename, bits);
+        file = sf_open(filename, SFM_WRITE, &info);
+
+        if (file != nullptr && bits != 32)
+            sf_command(file, SFC_SET_DITHER_ON_WRITE, nullptr, SF_TRUE);
+
+        return file != nullptr;
+    }
+
+    bool write(const float* const left, const float* const right, const uint32_t frames) override
+    {
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            interleaved[i * channels] = left[i];
+            if (channels > 1)
+                interleaved[i * channels + 1] = right[i];
+        }
+
+        return sf_writef_float(file, interleaved, frames) == frames;
+    }
+
+private:
+    SNDFILE* file = nullptr;
+    uint32_t channels = 0;
+    float interleaved[kBlockSize * 2];
+
+    // major format from the file extension, FLAC does not support float
+    static int sf_format_from_filename(const char* const filename, const uint32_t bits)
+    {
+        const char* const ext = std::strrchr(filename, '.');
+
+        if (ext != nullptr && strcasecmp(ext, ".flac") == 0)
+            return SF_FORMAT_FLAC | (bits == 16 ? SF_FORMAT_PCM_16 : SF_FORMAT_PCM_24);
+        if (ext != nullptr && strcasecmp(ext, ".ogg") == 0)
+            return SF_FORMAT_OGG | SF_FORMAT_VORBIS;
+
+        return SF_FORMAT_WAV | (bits == 16 ? SF_FORMAT_PCM_16 : bits == 24 ? SF_FORMAT_PCM_24 : SF_FORMAT_FLOAT);
+    }
+};
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------
+// rendering
+
+struct Options {
+    std::vector<ParameterValue> params;
+    std::string output;
+    bool outputIsDir = false;
+    uint32_t bits = 32;
+    uint32_t threads = 0;
+    float lookahead = 0.f;
+};
+
+static bool isWavFilename(const std::string& filename)
+{
+    return filename.size() > 4 && strcasecmp(filename.c_str() + filename.size() - 4, ".wav") == 0;
+}
+
+static std::string getOutputFilename(const Options& opts, const std::string& input)
+{
+    if (! opts.output.empty() && ! opts.outputIsDir)
+        return opts.output;
+
+    const size_t slash = input.find_last_of("/\\");
+    const size_t dot = input.find_last_of('.');
+    const bool hasExt = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+    const std::string ext = hasExt ? input.substr(dot) : ".wav";
+    std::string base = input.substr(0, hasExt ? dot : std::string::npos);
+
+    if (opts.outputIsDir)
+        base = opts.output + "/" + (slash != std::string::npos ? base.substr(slash + 1) : base);
+
+    return base + "-master_me" + ext;
+}
+
+static bool render(mydsp* const dsp, const Options& opts, const std::string& input, const uint32_t seed,
+                   std::mutex& printMutex)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const std::string output = getOutputFilename(opts, input);
+
+    std::unique_ptr<AudioReader> reader;
+    std::unique_ptr<AudioWriter> writer;
+
+    if (isWavFilename(input))
+    {
+        WavReader* const wav = new WavReader;
+        reader.reset(wav);
+        if (! wav->open(input.c_str()))
+            reader.reset();
+    }
+   #ifdef HAVE_SNDFILE
+    else
+    {
+        SndfileReader* const snd = new SndfileReader;
+        reader.reset(snd);
+        if (! snd->open(input.c_str()))
+            reader.reset();
+    }
+   #endif
+
+    if (reader == nullptr)
+    {
+        const std::lock_guard<std::mutex> clg(printMutex);
+        std::fprintf(stderr, "error: cannot read '%s'\n", input.c_str());
+        return false;
+    }
+
+    if (isWavFilename(output))
+    {
+        WavWriter* const wav = new WavWriter(opts.bits, seed);
+        writer.reset(wav);
+        if (! wav->open(output.c_str(), reader->channels, reader->sampleRate, reader->frames))
+            writer.reset();
+    }
+   #ifdef HAVE_SNDFILE
+    else
+    {
+        SndfileWriter* const snd = new SndfileWriter;
+        writer.reset(snd);
+        if (! snd->open(output.c_str(), reader->channels, reader->sampleRate, opts.bits))
+            writer.reset();
+    }
+   #endif
+
+    if (writer == nullptr)
+    {
+        const std::lock_guard<std::mutex> clg(printMutex);
+        std::fprintf(stderr, "error: cannot write '%s'\n", output.c_str());
+        return false;
+    }
+
+    // fresh state for every file
+    dsp->init(static_cast<int>(reader->sampleRate));
+
+    for (const ParameterValue& param : opts.params)
+        *getFaustParameterZone(dsp, param.index) = param.value;
+
+    // lookahead leveler goes before faust, replacing its leveler, same as in the plugin
+    std::unique_ptr<LookaheadLeveler> leveler;
+
+    if (opts.lookahead > 0.f)
+    {
+        const auto getValue = [dsp](const uint32_t index) { return *getFaustParameterZone(dsp, index); };
+
+        leveler.reset(new LookaheadLeveler(reader->sampleRate));
+        leveler->setLookahead(opts.lookahead);
+        leveler->setBypass(getValue(kParameter_global_bypass) > 0.5f || getValue(kParameter_leveler_bypass) > 0.5f);
+        leveler->setInputGain(getValue(kParameter_in_gain));
+        leveler->setParameters(getValue(kParameter_target),
+                               getValue(kParameter_leveler_speed),
+                               getValue(kParameter_leveler_brake_threshold),
+                               getValue(kParameter_leveler_max_plus),
+                               getValue(kParameter_leveler_max_minus));
+
+        *getFaustParameterZone(dsp, kParameter_leveler_bypass) = 1.f;
+    }
+
+    std::vector<float> buffers[4];
+    for (std::vector<float>& buffer : buffers)
+        buffer.resize(kBlockSize);
+
+    float* inputs[2] = { buffers[0].data(), buffers[1].data() };
+    float* outputs[2] = { buffers[2].data(), buffers[3].data() };
+
+    // the first latency frames are dropped from the output, and as many silent frames are processed at the end
+    uint32_t skipFrames = leveler != nullptr ? leveler->getLatency() : 0;
+    uint32_t flushFrames = skipFrames;
+
+    for (uint32_t frames;;)
+    {
+        if ((frames = reader->read(inputs[0], inputs[1], kBlockSize)) == 0)
+        {
+            if (flushFrames == 0)
+                break;
+
+            frames = std::min(flushFrames, kBlockSize);
+            flushFrames -= frames;
+            std::memset(inputs[0], 0, sizeof(float) * frames);
+            std::memset(inputs[1], 0, sizeof(float) * frames);
+        }
+
+        if (leveler != nullptr)
+            leveler->process(inputs[0], inputs[1], frames);
+
+        dsp->compute(static_cast<int>(frames), inputs, outputs);
+
+        const uint32_t skipped = std::min(skipFrames, frames);
+        skipFrames -= skipped;
+
+        if (skipped != frames && ! writer->write(outputs[0] + skipped, outputs[1] + skipped, frames - skipped))
+        {
+            const std::lock_guard<std::mutex> clg(printMutex);
+            std::fprintf(stderr, "error: failed writing to '%s'\n", output.c_str());
+            return false;
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double duration = static_cast<double>(reader->frames) / reader->sampleRate;
+
+    const std::lock_guard<std::mutex> clg(printMutex);
+    std::printf("%s -> %s, %.1f s in %.2f s (%.0fx realtime)\n",
+                input.c_str(), output.c_str(), duration, seconds, duration / std::max(1e-9, seconds));
+    return true;
+}
+
+static void usage(const char* const argv0)
+{
+    std::fprintf(stderr,
+                 "usage: %s [options] input-file...\n"
+                 "  -p <preset>   easy preset, by index or name (default 0, see -l)\n"
+                 "  -s <file>     state file to apply after the preset (LV2 .ttl or \"symbol value\" lines)\n"
+                 "  -o <path>     output directory, or output file if there is a single input\n"
+                 "  -b <bits>     output bits, 16 or 24 (dithered) or 32 (float, default)\n"
+                 "  -j <threads>  number of files to process in parallel (default: number of cpus)\n"
+                 "  -a <seconds>  analyze loudness ahead of the audio, using the lookahead leveler (1 to 10 seconds)\n"
+                 "  -l            list presets and exit\n",
+                 argv0);
+}
+
+int main(int argc, char* argv[])
+{
+    Options opts;
+    const char* preset = "0";
+    const char* stateFile = nullptr;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "-p") == 0 && hasValue)
+            preset = argv[++i];
+        else if (std::strcmp(argv[i], "-s") == 0 && hasValue)
+            stateFile = argv[++i];
+        else if (std::strcmp(argv[i], "-o") == 0 && hasValue)
+            opts.output = argv[++i];
+        else if (std::strcmp(argv[i], "-b") == 0 && hasValue)
+            opts.bits = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-j") == 0 && hasValue)
+            opts.threads = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-a") == 0 && hasValue)
+            opts.lookahead = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "-l") == 0)
+        {
+            for (uint32_t p = 0; p < ARRAY_SIZE(kEasyPresets); ++p)
+                std::printf("%u: %s\n", p, kEasyPresets[p].name);
+            return 0;
+        }
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        else
+            inputs.push_back(argv[i]);
+    }
+
+    if (inputs.empty() || (opts.bits != 16 && opts.bits != 24 && opts.bits != 32) ||
+        (opts.lookahead != 0.f && (opts.lookahead < 1.f || opts.lookahead > LookaheadLeveler::kMaxLookaheadSeconds)))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (! loadPreset(opts.params, preset))
+        return 1;
+    if (stateFile != nullptr && ! loadStateFile(opts.params, stateFile))
+        return 1;
+
+    if (! opts.output.empty())
+    {
+        struct stat st;
+        opts.outputIsDir = stat(opts.output.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+
+        if (! opts.outputIsDir && inputs.size() > 1)
+        {
+            std::fprintf(stderr, "error: output must be an existing directory when using multiple inputs\n");
+            return 1;
+        }
+    }
+
+    if (opts.threads == 0)
+        opts.threads = std::max(1u, std::thread::hardware_concurrency());
+    opts.threads = std::min<uint32_t>(opts.threads, inputs.size());
+
+    // each worker takes the next file in the list, reusing its own dsp instance
+    std::atomic<size_t> nextInput(0);
+    std::atomic<bool> failed(false);
+    std::mutex printMutex;
+    std::vector<std::thread> workers;
+
+    for (uint32_t t = 0; t < opts.threads; ++t)
+    {
+        workers.emplace_back([&] {
+            const ScopedDenormalDisable sdd;
+            std::unique_ptr<mydsp> dsp(new mydsp);
+
+            for (size_t i; (i = nextInput++) < inputs.size();)
+                if (! render(dsp.get(), opts, inputs[i], static_cast<uint32_t>(i + 1), printMutex))
+                    failed = true;
+
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// A/B check of the cached-coefficient mscomp shelving cascade (see plugin/dsp/ShelfCascade.hpp),
+// against the statements of the faust generated one in pregen/Plugin.cpp, which recompute every gain term
+// for every sample. Fails if any output sample differs by 1e-5 (-100 dBFS) or more.
+//
+// Two kinds of band gains are run, as the mscomp gives them:
+//  - moving, with every band gain changing on every sample, as while compressing
+//  - steady, with band gains stepping every half second, as in between
+// Without -ffast-math both give the same bits, with it compilers may reorder the scalar code.
+// CPU time of both is reported for each.
+//
+// usage: shelfcascadecheck [seconds]
+
+#include "dsp/ShelfCascade.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using DISTRHO_NAMESPACE::ShelfCascade;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const float kMaxError = 1e-5f;
+static constexpr const uint32_t kSampleRate = 48000;
+static constexpr const float kLowCrossover = 60.f;
+static constexpr const float kHighCrossover = 8000.f;
+
+static inline float faustpower2(const float x) noexcept
+{
+    return x * x;
+}
+
+// the faust generated code, one channel, everything computed per sample
+struct FaustShelfCascade {
+    float edges[ShelfCascade::kNumEdges];
+    float ic1[14][3] = {};
+    float ic2[14][3] = {};
+
+    FaustShelfCascade()
+    {
+        const float piOverSampleRate = 3.14159274f / float(kSampleRate);
+        const float ratio = std::pow(kHighCrossover / kLowCrossover, 0.166666672f);
+        float power = ratio;
+
+        edges[0] = std::tan(piOverSampleRate * kLowCrossover);
+        for (uint32_t e = 1; e < ShelfCascade::kNumEdges; ++e, power *= ratio)
+            edges[e] = std::tan(piOverSampleRate * kLowCrossover * power);
+    }
+
+    float ls3(const uint32_t group, const float g, const float a, float x) noexcept
+    {
+        static constexpr const float k[3] = { 2.0f, 1.41442716f, 0.5f };
+        const float s = std::sqrt(a);
+
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float v = ic1[group][i] + g * (x - ic2[group][i]) / s;
+            const float gs = g / s;
+            const float d = g * (gs + k[i]) / s + 1.0f;
+            const float v1 = v / d;
+            ic1[group][i] = 2.0f * v1 - ic1[group][i];
+            const float v2 = ic2[group][i] + g * v / (s * d);
+            ic2[group][i] = 2.0f * v2 - ic2[group][i];
+            x = x + k[i] * v1 * (a + -1.0f) + v2 * (faustpower2(a) + -1.0f);
+        }
+
+        return x;
+    }
+
+    float hs3(const uint32_t group, const float g, const float a, float x) noexcept
+    {
+        static constexpr const float k[3] = { 2.0f, 1.41442716f, 0.5f };
+        const float s = std::sqrt(a);
+
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const float v = ic1[group][i] + g * s * (x - ic2[group][i]);
+            const float gs = g * s;
+            const float d = g * s * (gs + k[i]) + 1.0f;
+            const float v1 = v / d;
+            ic1[group][i] = 2.0f * v1 - ic1[group][i];
+            const float v2 = ic2[group][i] + g * (s * v) / d;
+            ic2[group][i] = 2.0f * v2 - ic2[group][i];
+            x = a * (x * a + k[i] * v1 * (1.0f - a)) + v2 * (1.0f - faustpower2(a));
+        }
+
+        return x;
+    }
+
+    float process(const float input, const float gains[ShelfCascade::kNumBands]) noexcept
+    {
+        float x = ls3(0, edges[0], std::pow(10.0f, 0.00833333377f * gains[0]), input);
+
+        for (uint32_t b = 1; b < ShelfCascade::kNumEdges; ++b)
+        {
+            x = ls3(2 * b - 1, edges[b - 1], std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * gains[b])), x);
+            x = ls3(2 * b, edges[b], std::pow(10.0f, 0.00833333377f * gains[b]), x);
+        }
+
+        return hs3(13, edges[ShelfCascade::kNumEdges - 1], std::pow(10.0f, 0.00833333377f * gains[7]), x);
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static bool run(const char* const name, const std::vector<float>& input, const std::vector<float>& gains)
+{
+    const size_t numSamples = input.size();
+    std::vector<float> faustOutput(numSamples), cachedOutput(numSamples);
+
+    FaustShelfCascade faust;
+    ShelfCascade cached(kSampleRate);
+    cached.setCrossover(kLowCrossover, kHighCrossover);
+
+    const auto faustStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < numSamples; ++i)
+        faustOutput[i] = faust.process(input[i], &gains[i * ShelfCascade::kNumBands]);
+    const auto faustEnd = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < numSamples; ++i)
+        cachedOutput[i] = cached.process(input[i], &gains[i * ShelfCascade::kNumBands]);
+    const auto cachedEnd = std::chrono::steady_clock::now();
+
+    float maxError = 0.f;
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        if (faustOutput[i] == cachedOutput[i])
+            continue;
+        ++numDifferent;
+        maxError = std::max(maxError, std::fabs(faustOutput[i] - cachedOutput[i]));
+    }
+
+    const double faustTime = std::chrono::duration<double, std::nano>(faustEnd - faustStart).count();
+    const double cachedTime = std::chrono::duration<double, std::nano>(cachedEnd - faustEnd).count();
+
+    std::printf("%s gains: faust %.1f ns/sample, cached %.1f ns/sample, %zu of %zu samples differ, max error %g\n",
+                name, faustTime / numSamples, cachedTime / numSamples, numDifferent, numSamples, maxError);
+
+    if (maxError >= kMaxError)
+    {
+        std::printf("FAILED: error of %g or more\n", kMaxError);
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    const uint32_t seconds = argc > 1 ? std::max(1, std::atoi(argv[1])) : 30;
+    const uint32_t numSamples = seconds * kSampleRate;
+
+    std::mt19937 rng(1);
+    std::normal_distribution<float> noise(0.f, 1.f);
+    std::uniform_real_distribution<float> target(-12.f, 0.f);
+
+    std::vector<float> input(numSamples);
+    for (float& x : input)
+        x = 0.25f * noise(rng);
+
+    std::vector<float> moving(numSamples * ShelfCascade::kNumBands);
+    std::vector<float> steady(numSamples * ShelfCascade::kNumBands);
+    float targets[ShelfCascade::kNumBands];
+    float smoothed[ShelfCascade::kNumBands] = {};
+
+    for (uint32_t i = 0; i < numSamples; ++i)
+    {
+        if (i % (kSampleRate / 2) == 0)
+            for (float& t : targets)
+                t = target(rng);
+
+        for (uint32_t b = 0; b < ShelfCascade::kNumBands; ++b)
+        {
+            smoothed[b] += 0.001f * (targets[b] + 3.f * noise(rng) - smoothed[b]);
+            moving[i * ShelfCascade::kNumBands + b] = std::min(0.f, smoothed[b]);
+            steady[i * ShelfCascade::kNumBands + b] = targets[b];
+        }
+    }
+
+    const bool ok = run("moving", input, moving) && run("steady", input, steady);
+    return ok ? 0 : 1;
+}
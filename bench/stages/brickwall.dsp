@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// Brickwall (no latency) stage from master_me.dsp,
+// used in suitebench.cpp
+
+mm = library("master_me.dsp");
+
+process = mm.brickwall_no_latency_bp;
@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// EQ stage from master_me.dsp (highpass, tilt and side eq),
+// used in suitebench.cpp
+
+mm = library("master_me.dsp");
+
+process = mm.eq_bp;
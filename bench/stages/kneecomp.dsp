@@ -0,0 +1,9 @@
+// -*-Faust-*-
+
+// Kneecomp stage from master_me.dsp, with its own output as feedback instead of the brickwall one,
+// used in suitebench.cpp
+
+import("stdfaust.lib");
+mm = library("master_me.dsp");
+
+process = mm.sc_compressor ~ si.bus(2);
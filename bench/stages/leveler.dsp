@@ -0,0 +1,9 @@
+// -*-Faust-*-
+
+// Leveler stage from master_me.dsp, measuring its own output as it does in the full chain,
+// used in suitebench.cpp
+
+import("stdfaust.lib");
+mm = library("master_me.dsp");
+
+process = mm.leveler_sc(mm.target) ~ si.bus(2);
@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// Limiter stage from master_me.dsp,
+// used in suitebench.cpp
+
+mm = library("master_me.dsp");
+
+process = mm.limiter_rms_bp;
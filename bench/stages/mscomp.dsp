@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// Multiband mid/side compressor stage from master_me.dsp,
+// used in suitebench.cpp
+
+mm = library("master_me.dsp");
+
+process = mm.mscomp_bp;
@@ -0,0 +1,8 @@
+// -*-Faust-*-
+
+// Pre-processing stage from master_me.dsp: input gain, input peak meter, dc blocker, phase, mono and stereo correct,
+// used in suitebench.cpp
+
+mm = library("master_me.dsp");
+
+process = mm.in_gain : mm.peakmeter_in : mm.dc_blocker_bp : (mm.phase_invert_L, mm.phase_invert_R) : mm.mono_bp : mm.correlate_correct_bp;
@@ -0,0 +1,135 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Bench for the multi-stream engine (plugin/utils/MultiStreamEngine.hpp), running many master_me streams at once.
+//
+// Every stream gets the same kind of signal but with a different seed, and is processed for the same amount of time
+// with 1 thread and then with each power of 2 up to the requested amount.
+// Results are also checked against a single dsp instance processing one of the streams on its own.
+//
+// usage: streambench [streams] [max-threads] [seconds] [sample-rate] [buffer-size]
+
+#include "DistrhoPlugin.hpp"
+#include "extra/ScopedDenormalDisable.hpp"
+
+// faustpp generated plugin template, only mydsp is used
+#include "DistrhoPluginInfo.h"
+#include "Plugin.cpp"
+
+#include "utils/MultiStreamEngine.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace DISTRHO;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static void generate(float* const left, float* const right, const uint32_t frames, uint32_t& seed, uint64_t& frame,
+                     const double sampleRate)
+{
+    for (uint32_t i = 0; i < frames; ++i, ++frame)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const float noise = (static_cast<float>(seed >> 9) / 8388608.f - 0.5f) * 0.1f;
+        const float env = 0.5f + 0.5f * std::sin(2.0 * M_PI * 0.3 * frame / sampleRate);
+        left[i] = env * (0.3f * std::sin(2.0 * M_PI * 220.0 * frame / sampleRate) + noise);
+        right[i] = env * (0.2f * std::sin(2.0 * M_PI * 330.0 * frame / sampleRate) - noise);
+    }
+}
+
+static void applyPreset(mydsp* const dsp)
+{
+    for (uint32_t i = 1; i < ARRAY_SIZE(kEasyPresets[0].values); ++i)
+        *getFaustParameterZone(dsp, i) = kEasyPresets[0].values[i];
+}
+
+int main(int argc, char* argv[])
+{
+    const uint numStreams = argc > 1 ? std::max(1, std::atoi(argv[1])) : 16;
+    const uint maxThreads = argc > 2 ? std::max(1, std::atoi(argv[2])) : std::max(1u, std::thread::hardware_concurrency());
+    const double seconds = argc > 3 ? std::atof(argv[3]) : 10.0;
+    const double sampleRate = argc > 4 ? std::atof(argv[4]) : 48000.0;
+    const uint32_t bufferSize = argc > 5 ? std::atoi(argv[5]) : 512;
+    const uint64_t numBlocks = static_cast<uint64_t>(seconds * sampleRate / bufferSize);
+
+    const ScopedDenormalDisable sdd;
+
+    std::printf("%u streams, %.0f s, %.0f Hz, buffer size %u\n", numStreams, seconds, sampleRate, bufferSize);
+
+    std::vector<std::vector<float>> buffers(numStreams * 2, std::vector<float>(bufferSize));
+    std::vector<float*> channels(numStreams * 2);
+    for (uint i = 0; i < numStreams * 2; ++i)
+        channels[i] = buffers[i].data();
+
+    // reference, last stream processed on its own
+    std::vector<float> reference(numBlocks * bufferSize * 2);
+    {
+        std::unique_ptr<mydsp> dsp(new mydsp);
+        dsp->init(static_cast<int>(sampleRate));
+        applyPreset(dsp.get());
+
+        uint32_t seed = numStreams;
+        uint64_t frame = 0;
+        float* ins[2] = { channels[0], channels[1] };
+        float* outs[2] = { channels[0], channels[1] };
+
+        for (uint64_t b = 0; b < numBlocks; ++b)
+        {
+            generate(ins[0], ins[1], bufferSize, seed, frame, sampleRate);
+            dsp->compute(static_cast<int>(bufferSize), ins, outs);
+            std::memcpy(&reference[b * bufferSize * 2], outs[0], sizeof(float) * bufferSize);
+            std::memcpy(&reference[b * bufferSize * 2 + bufferSize], outs[1], sizeof(float) * bufferSize);
+        }
+    }
+
+    double singleThreadSeconds = 0.0;
+
+    std::vector<uint> threadCounts;
+    for (uint threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (const uint threads : threadCounts)
+    {
+        MultiStreamEngine<mydsp> engine(numStreams, sampleRate, threads);
+
+        for (uint s = 0; s < numStreams; ++s)
+            applyPreset(engine.getStream(s));
+
+        std::vector<uint32_t> seeds(numStreams);
+        std::vector<uint64_t> frames(numStreams, 0);
+        for (uint s = 0; s < numStreams; ++s)
+            seeds[s] = s + 1;
+
+        double elapsed = 0.0;
+        float maxDifference = 0.f;
+
+        for (uint64_t b = 0; b < numBlocks; ++b)
+        {
+            for (uint s = 0; s < numStreams; ++s)
+                generate(channels[s * 2], channels[s * 2 + 1], bufferSize, seeds[s], frames[s], sampleRate);
+
+            const auto start = std::chrono::steady_clock::now();
+            engine.process(channels.data(), channels.data(), bufferSize);
+            elapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            const float* const ref = &reference[b * bufferSize * 2];
+            for (uint32_t i = 0; i < bufferSize; ++i)
+            {
+                maxDifference = std::max(maxDifference, std::abs(channels[numStreams * 2 - 2][i] - ref[i]));
+                maxDifference = std::max(maxDifference, std::abs(channels[numStreams * 2 - 1][i] - ref[bufferSize + i]));
+            }
+        }
+
+        if (threads == 1)
+            singleThreadSeconds = elapsed;
+
+        std::printf("%3u threads %8.3f s %8.1fx realtime for all streams, speedup %.2fx, max difference %g\n",
+                    engine.getNumThreads(), elapsed, seconds / elapsed * numStreams,
+                    singleThreadSeconds / elapsed, maxDifference);
+    }
+
+    return 0;
+}
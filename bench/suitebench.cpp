@@ -0,0 +1,532 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Benchmark suite, timing every processing stage of master_me on its own and the whole chain,
+// over a matrix of sample rates and block sizes, with results as JSON for tracking regressions across commits.
+//
+// Stages are:
+//  - the faust stages, each one extracted from master_me.dsp into its own dsp (see bench/stages/*.dsp)
+//  - the full faust chain, master_me.dsp itself
+//  - the plugin side C++ stages (loudness meter, true-peak/lookahead brickwall, true peak meter, lookahead leveler)
+//
+// For each stage and sample rate this records:
+//  - cold-start time, creating the instance and initializing it
+//  - memory footprint, all heap allocations done while creating and initializing it
+// And then for each block size:
+//  - average ns per sample, best of kNumRuns runs
+//  - 99th percentile of the ns per sample of single blocks, from that best run
+//  - average cpu cycles per sample, from that best run
+//
+// Cycles come from the cpu cycle counter through perf events on Linux, which works the same on x86 and ARM.
+// Where that is not available (no perf support in the kernel, or perf_event_paranoid too high),
+// giving the cpu clock with -c converts the time instead, which is only right with a fixed cpu frequency.
+// Without either, cycles are reported as null.
+//
+// Built with EMBEDDED=true, the stages come from the embedded profile instead (see EMBEDDED in the Makefile),
+// and sample rates above the ones it is sized for are skipped.
+// That build is meant to run on the device itself, where cycles per sample tell how much of a core one instance takes.
+//
+// Progress goes to stderr, JSON to stdout or to the file given with -o.
+//
+// usage: suitebench [-o file.json] [-s seconds-per-run] [-f stage-name-filter] [-c cpu-mhz]
+
+#include "faust/gui/meta.h"
+#include "faust/gui/UI.h"
+#include "faust/dsp/dsp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// generated from bench/stages/*.dsp and master_me.dsp
+#include "stage_pre.h"
+#include "stage_gate.h"
+#include "stage_eq.h"
+#include "stage_leveler.h"
+#include "stage_kneecomp.h"
+#include "stage_mscomp.h"
+#include "stage_limiter.h"
+#include "stage_brickwall.h"
+#include "stage_full.h"
+
+#include "DistrhoUtils.hpp"
+#include "extra/ScopedDenormalDisable.hpp"
+#include "dsp/BrickwallLimiter.hpp"
+#include "dsp/LookaheadLeveler.hpp"
+#include "dsp/R128LoudnessMeter.hpp"
+
+#ifndef MASTER_ME_GIT_REV
+#define MASTER_ME_GIT_REV "unknown"
+#endif
+
+#ifndef MASTER_ME_SUITE_PROFILE
+#define MASTER_ME_SUITE_PROFILE "default"
+#endif
+
+#ifndef MASTER_ME_MAX_SAMPLE_RATE
+#define MASTER_ME_MAX_SAMPLE_RATE 192000
+#endif
+
+using namespace DISTRHO;
+
+// --------------------------------------------------------------------------------------------------------------------
+// memory accounting, counting every allocation while a stage is created and initialized
+
+static size_t gAllocatedBytes = 0;
+
+void* operator new(const size_t size)
+{
+    gAllocatedBytes += size;
+
+    if (void* const ptr = std::malloc(size != 0 ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// cpu cycles, counted in user space only, for the calling thread
+
+struct CycleCounter {
+    int fd = -1;
+
+    CycleCounter()
+    {
+       #ifdef __linux__
+        perf_event_attr attr = {};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        fd = static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+       #endif
+    }
+
+    ~CycleCounter()
+    {
+       #ifdef __linux__
+        if (fd >= 0)
+            ::close(fd);
+       #endif
+    }
+
+    bool isAvailable() const noexcept
+    {
+        return fd >= 0;
+    }
+
+    uint64_t read() const noexcept
+    {
+        uint64_t count = 0;
+       #ifdef __linux__
+        if (fd >= 0 && ::read(fd, &count, sizeof(count)) != sizeof(count))
+            count = 0;
+       #endif
+        return count;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+// stages
+
+struct Stage {
+    virtual ~Stage() {}
+    virtual void init(double sampleRate) = 0;
+    virtual void process(float** inputs, float** outputs, uint32_t frames) = 0;
+};
+
+template <class DSP>
+struct FaustStage : Stage {
+    DSP dsp;
+
+    void init(const double sampleRate) override
+    {
+        dsp.init(static_cast<int>(sampleRate));
+    }
+
+    void process(float** const inputs, float** const outputs, const uint32_t frames) override
+    {
+        dsp.compute(static_cast<int>(frames), inputs, outputs);
+    }
+};
+
+struct LoudnessMeterStage : Stage {
+    R128LoudnessMeter meter { 48000.0 };
+
+    void init(const double sampleRate) override
+    {
+        meter.setSampleRate(sampleRate);
+    }
+
+    void process(float** const inputs, float**, const uint32_t frames) override
+    {
+        meter.process(inputs[0], inputs[1], frames);
+    }
+};
+
+struct BrickwallStage : Stage {
+    BrickwallLimiter limiter { 48000.0 };
+
+    void init(const double sampleRate) override
+    {
+        limiter.setSampleRate(sampleRate);
+        limiter.setMode(true, 2.f);
+        limiter.setCeiling(-1.f);
+    }
+
+    void process(float** const inputs, float** const outputs, const uint32_t frames) override
+    {
+        std::memcpy(outputs[0], inputs[0], sizeof(float) * frames);
+        std::memcpy(outputs[1], inputs[1], sizeof(float) * frames);
+        limiter.process(outputs[0], outputs[1], frames);
+    }
+};
+
+struct TruePeakStage : Stage {
+    TruePeakDetector detector;
+    float peak = 0.f;
+
+    void init(double) override
+    {
+        detector.reset();
+    }
+
+    void process(float** const inputs, float**, const uint32_t frames) override
+    {
+        float p = peak;
+        for (uint32_t i = 0; i < frames; ++i)
+            p = std::max(p, detector.process(inputs[0][i], inputs[1][i]));
+        peak = p;
+    }
+};
+
+struct LookaheadLevelerStage : Stage {
+    LookaheadLeveler leveler { 48000.0 };
+
+    void init(const double sampleRate) override
+    {
+        leveler.setSampleRate(sampleRate);
+        leveler.setLookahead(3.f);
+    }
+
+    void process(float** const inputs, float** const outputs, const uint32_t frames) override
+    {
+        std::memcpy(outputs[0], inputs[0], sizeof(float) * frames);
+        std::memcpy(outputs[1], inputs[1], sizeof(float) * frames);
+        leveler.process(outputs[0], outputs[1], frames);
+    }
+};
+
+struct StageInfo {
+    const char* name;
+    const char* kind;
+    Stage* (*create)();
+};
+
+template <class T>
+static Stage* createStage()
+{
+    return new T;
+}
+
+static const StageInfo kStages[] = {
+    { "pre", "faust", createStage<FaustStage<stage_pre>> },
+    { "gate", "faust", createStage<FaustStage<stage_gate>> },
+    { "eq", "faust", createStage<FaustStage<stage_eq>> },
+    { "leveler", "faust", createStage<FaustStage<stage_leveler>> },
+    { "kneecomp", "faust", createStage<FaustStage<stage_kneecomp>> },
+    { "mscomp", "faust", createStage<FaustStage<stage_mscomp>> },
+    { "limiter", "faust", createStage<FaustStage<stage_limiter>> },
+    { "brickwall", "faust", createStage<FaustStage<stage_brickwall>> },
+    { "full", "faust", createStage<FaustStage<stage_full>> },
+    { "lufs_meter", "cpp", createStage<LoudnessMeterStage> },
+    { "brickwall_tp_lookahead", "cpp", createStage<BrickwallStage> },
+    { "true_peak_meter", "cpp", createStage<TruePeakStage> },
+    { "lookahead_leveler", "cpp", createStage<LookaheadLevelerStage> },
+};
+
+static constexpr const double kSampleRates[] = { 44100, 48000, 88200, 96000, 176400, 192000 };
+static constexpr const uint32_t kBlockSizes[] = { 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+static constexpr const uint kNumRuns = 3;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// same kind of signal as streambench, loud enough for every dynamics stage to do some work
+static void generate(std::vector<float>& left, std::vector<float>& right, const double sampleRate)
+{
+    uint32_t seed = 1;
+
+    for (size_t i = 0; i < left.size(); ++i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const float noise = (static_cast<float>(seed >> 9) / 8388608.f - 0.5f) * 0.1f;
+        const float env = 0.5f + 0.5f * std::sin(2.0 * M_PI * 0.3 * i / sampleRate);
+        left[i] = env * (0.3f * std::sin(2.0 * M_PI * 220.0 * i / sampleRate) + noise);
+        right[i] = env * (0.2f * std::sin(2.0 * M_PI * 330.0 * i / sampleRate) - noise);
+    }
+}
+
+struct BlockResult {
+    uint32_t blockSize;
+    double nsPerSample;
+    double p99NsPerSample;
+    // negative if unknown
+    double cyclesPerSample;
+};
+
+struct RateResult {
+    double sampleRate;
+    size_t memoryBytes;
+    double initMicroseconds;
+    std::vector<BlockResult> blocks;
+};
+
+static RateResult bench(const StageInfo& info, const double sampleRate, const std::vector<float> (&signal)[2],
+                        const CycleCounter& cycleCounter, const double cpuMHz)
+{
+    RateResult res;
+    res.sampleRate = sampleRate;
+
+    typedef std::chrono::steady_clock Clock;
+
+    const size_t allocatedBefore = gAllocatedBytes;
+    const Clock::time_point initStart = Clock::now();
+    Stage* const stage = info.create();
+    stage->init(sampleRate);
+    res.initMicroseconds = std::chrono::duration<double, std::micro>(Clock::now() - initStart).count();
+    res.memoryBytes = gAllocatedBytes - allocatedBefore;
+
+    std::vector<float> outL(kBlockSizes[ARRAY_SIZE(kBlockSizes) - 1]), outR(outL.size());
+    std::vector<double> blockTimes;
+    const size_t totalFrames = signal[0].size();
+
+    for (const uint32_t blockSize : kBlockSizes)
+    {
+        const size_t numBlocks = totalFrames / blockSize;
+        double bestSeconds = 1e9;
+        double bestP99 = 0.0;
+        uint64_t bestCycles = 0;
+
+        blockTimes.resize(numBlocks);
+
+        for (uint r = 0; r < kNumRuns; ++r)
+        {
+            // same state and input for every run
+            stage->init(sampleRate);
+
+            double seconds = 0.0;
+
+            // includes the per-block timing, which is small next to even the shortest blocks
+            const uint64_t cyclesStart = cycleCounter.read();
+
+            for (size_t b = 0; b < numBlocks; ++b)
+            {
+                float* inputs[2] = {
+                    const_cast<float*>(signal[0].data()) + b * blockSize,
+                    const_cast<float*>(signal[1].data()) + b * blockSize,
+                };
+                float* outputs[2] = { outL.data(), outR.data() };
+
+                const Clock::time_point start = Clock::now();
+                stage->process(inputs, outputs, blockSize);
+                const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+                blockTimes[b] = elapsed;
+                seconds += elapsed;
+            }
+
+            const uint64_t cycles = cycleCounter.read() - cyclesStart;
+
+            if (seconds < bestSeconds)
+            {
+                bestSeconds = seconds;
+                bestCycles = cycles;
+                std::nth_element(blockTimes.begin(), blockTimes.begin() + numBlocks * 99 / 100, blockTimes.end());
+                bestP99 = blockTimes[numBlocks * 99 / 100];
+            }
+        }
+
+        const double numSamples = static_cast<double>(numBlocks * blockSize);
+        double cyclesPerSample = -1.0;
+
+        if (cycleCounter.isAvailable())
+            cyclesPerSample = static_cast<double>(bestCycles) / numSamples;
+        else if (cpuMHz > 0.0)
+            cyclesPerSample = bestSeconds * cpuMHz * 1e6 / numSamples;
+
+        res.blocks.push_back({
+            blockSize,
+            bestSeconds * 1e9 / numSamples,
+            bestP99 * 1e9 / blockSize,
+            cyclesPerSample,
+        });
+    }
+
+    delete stage;
+    return res;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static void usage(const char* const argv0)
+{
+    std::fprintf(stderr,
+                 "usage: %s [options]\n"
+                 "  -o <file>     write JSON results to file instead of stdout\n"
+                 "  -s <seconds>  audio processed on each run (default 1)\n"
+                 "  -f <name>     only run stages with names containing this\n"
+                 "  -c <mhz>      cpu clock, for cycles per sample when there is no cycle counter\n",
+                 argv0);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* outputFile = nullptr;
+    const char* filter = nullptr;
+    double seconds = 1.0;
+    double cpuMHz = 0.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "-o") == 0 && hasValue)
+            outputFile = argv[++i];
+        else if (std::strcmp(argv[i], "-s") == 0 && hasValue)
+            seconds = std::max(0.1, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "-f") == 0 && hasValue)
+            filter = argv[++i];
+        else if (std::strcmp(argv[i], "-c") == 0 && hasValue)
+            cpuMHz = std::max(0.0, std::atof(argv[++i]));
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    const ScopedDenormalDisable sdd;
+    const CycleCounter cycleCounter;
+    const char* const cyclesSource = cycleCounter.isAvailable() ? "perf" : cpuMHz > 0.0 ? "clock" : "none";
+
+    if (! cycleCounter.isAvailable())
+        std::fprintf(stderr, "no cpu cycle counter available, %s\n",
+                     cpuMHz > 0.0 ? "converting time with the given cpu clock" : "use -c for cycles per sample");
+
+    std::vector<std::pair<const StageInfo*, std::vector<RateResult>>> results;
+
+    for (const StageInfo& info : kStages)
+        if (filter == nullptr || std::strstr(info.name, filter) != nullptr)
+            results.push_back({ &info, {} });
+
+    for (const double sampleRate : kSampleRates)
+    {
+        if (sampleRate > MASTER_ME_MAX_SAMPLE_RATE)
+            continue;
+
+        std::vector<float> signal[2];
+        signal[0].resize(static_cast<size_t>(seconds * sampleRate));
+        signal[1].resize(signal[0].size());
+        generate(signal[0], signal[1], sampleRate);
+
+        for (auto& result : results)
+        {
+            std::fprintf(stderr, "%-24s %6.0f Hz ...", result.first->name, sampleRate);
+            result.second.push_back(bench(*result.first, sampleRate, signal, cycleCounter, cpuMHz));
+
+            const RateResult& rr = result.second.back();
+            std::fprintf(stderr, " init %8.1f us, %9zu bytes, %7.2f ns/sample",
+                         rr.initMicroseconds, rr.memoryBytes, rr.blocks[4].nsPerSample);
+            if (rr.blocks[4].cyclesPerSample >= 0.0)
+                std::fprintf(stderr, ", %7.1f cycles/sample", rr.blocks[4].cyclesPerSample);
+            std::fprintf(stderr, " at %u frames\n", rr.blocks[4].blockSize);
+        }
+    }
+
+    FILE* const f = outputFile != nullptr ? std::fopen(outputFile, "w") : stdout;
+
+    if (f == nullptr)
+    {
+        std::fprintf(stderr, "error: cannot write to '%s'\n", outputFile);
+        return 1;
+    }
+
+    std::fprintf(f, "{\n");
+    std::fprintf(f, "  \"suite_version\": 2,\n");
+    std::fprintf(f, "  \"git_rev\": \"%s\",\n", MASTER_ME_GIT_REV);
+    std::fprintf(f, "  \"profile\": \"%s\",\n", MASTER_ME_SUITE_PROFILE);
+    std::fprintf(f, "  \"compiler\": \"%s\",\n", __VERSION__);
+    std::fprintf(f, "  \"seconds_per_run\": %g,\n", seconds);
+    std::fprintf(f, "  \"runs\": %u,\n", kNumRuns);
+    std::fprintf(f, "  \"cycles_source\": \"%s\",\n", cyclesSource);
+    std::fprintf(f, "  \"stages\": [\n");
+
+    for (size_t s = 0; s < results.size(); ++s)
+    {
+        std::fprintf(f, "    {\n");
+        std::fprintf(f, "      \"name\": \"%s\",\n", results[s].first->name);
+        std::fprintf(f, "      \"kind\": \"%s\",\n", results[s].first->kind);
+        std::fprintf(f, "      \"sample_rates\": [\n");
+
+        for (size_t r = 0; r < results[s].second.size(); ++r)
+        {
+            const RateResult& rr = results[s].second[r];
+
+            std::fprintf(f, "        {\n");
+            std::fprintf(f, "          \"sample_rate\": %.0f,\n", rr.sampleRate);
+            std::fprintf(f, "          \"memory_bytes\": %zu,\n", rr.memoryBytes);
+            std::fprintf(f, "          \"init_us\": %.3f,\n", rr.initMicroseconds);
+            std::fprintf(f, "          \"blocks\": [\n");
+
+            for (size_t b = 0; b < rr.blocks.size(); ++b)
+            {
+                const BlockResult& br = rr.blocks[b];
+                char cycles[32] = "null";
+                if (br.cyclesPerSample >= 0.0)
+                    std::snprintf(cycles, sizeof(cycles), "%.2f", br.cyclesPerSample);
+
+                std::fprintf(f, "            { \"block_size\": %u, \"ns_per_sample\": %.4f, \"p99_ns_per_sample\": %.4f, "
+                                "\"cycles_per_sample\": %s }%s\n",
+                             br.blockSize, br.nsPerSample, br.p99NsPerSample, cycles, b + 1 != rr.blocks.size() ? "," : "");
+            }
+
+            std::fprintf(f, "          ]\n");
+            std::fprintf(f, "        }%s\n", r + 1 != results[s].second.size() ? "," : "");
+        }
+
+        std::fprintf(f, "      ]\n");
+        std::fprintf(f, "    }%s\n", s + 1 != results.size() ? "," : "");
+    }
+
+    std::fprintf(f, "  ]\n");
+    std::fprintf(f, "}\n");
+
+    if (f != stdout)
+        std::fclose(f);
+
+    return 0;
+}
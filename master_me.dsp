@@ -5,7 +5,8 @@ declare version "1.0";
 declare author "Klaus Scheuermann";
 declare license "GPLv3";
 
-// double precision -double needed!
+// single precision, so the code vectorizes twice as wide as with -double;
+// recursions that float cannot resolve use precise_lp1 instead, `make check-precision` compares against -double
 
 ebu = library("lib/ebur128.dsp");
 ex = library("expanders.lib");
@@ -13,8 +14,9 @@ import("stdfaust.lib");
 
 // init values
 
-Nch = 2; //number of channels
-Nba = 8; //number of bands of the multiband compressor
+Nch = 2; //number of channels, 2 (stereo), 6 (5.1), 8 (7.1) or 12 (7.1.4), see CHANNELS in the Makefile
+Nba = 8; //number of bands of the multiband compressor, fewer in the embedded profile, see EMBEDDED in the Makefile
+maxSR = 192000; //highest sample rate the delay lines are sized for, lower in the embedded profile
 
 init_noisegate_threshold = -70; // not used in voc version
 
@@ -39,41 +41,89 @@ target = vslider("v:master_me/h:easy/[3]Target[unit:dB][symbol:target][integer]"
 
 // main
 process =
-  bp2(checkbox("[symbol:global_bypass]global bypass"),(
-       in_gain
-       : peakmeter_in
-       : lufs_meter_in
-       : dc_blocker_bp
-
-       : (phase_invert_L , phase_invert_R)
-       : mono_bp
-         //: correlate_meter
-       : correlate_correct_bp
-
-       : gate_bp
-       : eq_bp
-
-       : (
-         leveler_sc(target)
-         : ( sc_compressor
-             : mscomp_bp
-             : limiter_rms_bp
-             : brickwall_no_latency_bp
-           )~(si.bus(2))
-       )~(si.bus(2))
-       ))
-
+  bpN(global_bypass, chain_front : chain_back)
   : lufs_meter_out
   : peakmeter_out
 ;
 
-// stereo bypass with si.smoo fading
-bp2(sw,pr) =  _,_ <: _,_,pr : (_*sm,_*sm),(_*(1-sm),_*(1-sm)) :> _,_ with {
+global_bypass = checkbox("[symbol:global_bypass]global bypass");
+
+// the chain in two parts, which the pipelined build runs on separate threads (see pipeline/*.dsp)
+// pre-processing, gate and eq
+chain_front =
+  in_gain
+  : peakmeter_in
+  : lufs_meter_in
+  : dc_blocker_bp
+
+  : front_pair((phase_invert_L , phase_invert_R))
+  : front_pair(mono_bp)
+    //: correlate_meter
+  : front_pair(correlate_correct_bp)
+
+  : gate_bp
+  : eq_bp;
+
+// leveler and dynamics, with their feedback loops
+chain_back =
+  (
+    leveler_sc(target)
+    : ( sc_compressor
+        : mscomp_bp
+        : limiter_rms_bp
+        : brickwall_no_latency_bp
+      )~(si.bus(Nch))
+  )~(si.bus(Nch));
+
+// multichannel layouts, channel order as in plugin/dsp/ChannelLayout.hpp:
+// L R C LFE Ls Rs for 5.1, then Lrs Rrs for 7.1, then Ltf Rtf Ltr Rtr for 7.1.4
+// the stereo processing (phase, mono, stereo correct, mid/side) works on the front L/R pair,
+// the other channels go through everything else and are linked with it
+
+// run a stereo processor on the front pair, other channels pass through
+front_pair(pr) = fp(Nch) with {
+  fp(2) = pr;
+  fp(n) = pr, si.bus(n-2);
+};
+
+// ITU-R BS.1770-4 channel weights, LFE is not measured, same as in plugin/dsp/ChannelLayout.hpp
+bs1770_weight(c) = ba.take(c+1, weights(Nch)) with {
+  weights(2) = (1, 1);
+  weights(6) = (1, 1, 1, 0, 1.41, 1.41);
+  weights(8) = (1, 1, 1, 0, 1.41, 1.41, 1, 1);
+  weights(12) = (1, 1, 1, 0, 1.41, 1.41, 1, 1, 1, 1, 1, 1);
+};
+
+// N channel bypass with si.smoo fading
+bp_bus(N,sw,pr) = si.bus(N) <: si.bus(N),pr : bp_mix(N,sw);
+
+// the fading part of bp_bus, dry signal on the first N inputs and processed signal on the next N
+bp_mix(N,sw) = par(i,N,_*sm),par(i,N,_*(1-sm)) :> si.bus(N) with {
     sm = sw : si.smoo;
 };
 
+// stereo bypass, for the front pair
+bp2(sw,pr) = bp_bus(2,sw,pr);
+
+// bypass of all channels
+bpN(sw,pr) = bp_bus(Nch,sw,pr);
+
+// one-pole lowpass for very slow smoothing, same response as si.smooth(exp(-w)) but accurate in single precision
+// w is the cutoff in radians per sample (2*pi*fc/SR), it can change every sample.
+// with a pole this close to 1, a float state stops moving once a step is below its rounding step,
+// for the leveler 1.5dB short of the target at 192kHz. the state is kept as two floats instead,
+// hi on a 1/1024 grid and lo as the remainder below it, so moving lo into hi is exact and no step is lost.
+// the coefficient uses a series for small w, 1 - exp(-w) would cancel out most of its bits.
+precise_lp1(w) = step ~ (_,_) : + with {
+  b = select2(w < 0.001, 1 - exp(0 - w), w * (1 - w * (0.5 - w / 6)));
+  step(hi, lo, x) = hi + q, r - q with {
+    r = lo + b * (x - hi - lo);
+    q = floor(r * 1024) / 1024;
+  };
+};
+
 // DC FILTER
-dc_blocker_bp = bp2(sw,dc_blocker(2)) with {
+dc_blocker_bp = bpN(sw,dc_blocker(Nch)) with {
   sw = 1 - checkbox("v:master_me/t:expert/h:[1]pre-processing/[5][symbol:dc_blocker]dc blocker");
 };
 
@@ -95,7 +145,7 @@ mono_bp = bp2(1 - checkbox("v:master_me/t:expert/h:[1]pre-processing/[4][symbol:
 mono = _*0.5,_*0.5 <: +, +;
 
 // input gain
-in_gain = par(i,2,(_*g)) with{
+in_gain = par(i,Nch,(_*g)) with{
                g = vslider("v:master_me/t:expert/h:[1]pre-processing/[1][symbol:in_gain][unit:dB]input gain",0,-100,24,1) : ba.db2linear :si.smoo;
              };
 
@@ -105,13 +155,13 @@ ms_enc = _*0.5,_*0.5 <: +, -;
 // m/s to stereo decoder
 ms_dec = _,_ <: +, -;
 
-// peak meters
-peakmeter_in = in_meter_l,in_meter_r with {
+// peak meters, of the front pair
+peakmeter_in = front_pair((in_meter_l,in_meter_r)) with {
 envelop = abs : max(ba.db2linear(-70)) : ba.linear2db : min(10)  : max ~ -(80.0/ma.SR);
 in_meter_l(x) = attach(x, envelop(x) : vbargraph("v:master_me/h:easy/[0][symbol:peakmeter_in_l]in L[unit:dB]", -70, 0));
 in_meter_r(x) = attach(x, envelop(x) : vbargraph("v:master_me/h:easy/[1][symbol:peakmeter_in_r]in R[unit:dB]", -70, 0));
            };
-peakmeter_out = out_meter_l,out_meter_r with {
+peakmeter_out = front_pair((out_meter_l,out_meter_r)) with {
   envelop = abs : max(ba.db2linear(-70)) : ba.linear2db : min(10)  : max ~ -(80.0/ma.SR);
   out_meter_l(x) = attach(x, envelop(x) : vbargraph("v:master_me/h:easy/[8][symbol:peakmeter_out_l]out L[unit:dB]", -70, 0));
   out_meter_r(x) = attach(x, envelop(x) : vbargraph("v:master_me/h:easy/[9][symbol:peakmeter_out_r]out R[unit:dB]", -70, 0));
@@ -122,13 +172,16 @@ peakmeter_out = out_meter_l,out_meter_r with {
 
 
 // GATE
-gate_bp = bp2(checkbox("v:master_me/t:expert/h:[2]gate/[1][symbol:gate_bypass]gate bypass"),gate);
-gate(x,y) = attach(x,gateview(abs(x)+abs(y))),y : ef.gate_stereo(gate_thresh,gate_att,gate_hold,gate_rel) with{
+gate_bp = bpN(checkbox("v:master_me/t:expert/h:[2]gate/[1][symbol:gate_bypass]gate bypass"),gate);
+// keyed by the sum of all channels, same gain for all of them, like ef.gate_stereo
+gate = si.bus(Nch) <: (key : gain), si.bus(Nch) : (_ <: si.bus(Nch)), si.bus(Nch) : ro.interleave(Nch,2) : par(i,Nch,*) with{
+  key = par(i,Nch,abs) :> _;
+  gain = ef.gate_gain_mono(gate_thresh,gate_att,gate_hold,gate_rel) <: attach(_, gateview);
   gate_thresh = vslider("v:master_me/t:expert/h:[2]gate/[2][symbol:gate_threshold][unit:dB]gate threshold",-90,-90,0,1);
   gate_att = vslider("v:master_me/t:expert/h:[2]gate/[3][symbol:gate_attack][unit:ms]gate attack",0,0,100,1) *0.001;
   gate_hold = vslider("v:master_me/t:expert/h:[2]gate/[4][symbol:gate_hold][unit:ms]gate hold",50,0,500,1) *0.001;
   gate_rel = vslider("v:master_me/t:expert/h:[2]gate/[5][symbol:gate_release][unit:ms]gate release",500,50,5000,1) *0.001;
-  gateview = ef.gate_gain_mono(gate_thresh,gate_att,gate_hold,gate_rel) : ba.linear2db : max(-70) :
+  gateview = ba.linear2db : max(-70) :
       vbargraph("v:master_me/t:expert/h:[2]gate/[6][symbol:gate_meter][unit:dB]gate meter", -70,0);
 };
 
@@ -187,24 +240,24 @@ correlate_correct(l,r) = out_pos1, out_neg1, out_0, out_pos, out_neg :> _,_ with
 
 
 // EQ with bypass
-eq_bp = bp2(checkbox("v:master_me/t:expert/h:[3]eq/[1][symbol:eq_bypass]eq bypass"),eq);
+eq_bp = bpN(checkbox("v:master_me/t:expert/h:[3]eq/[1][symbol:eq_bypass]eq bypass"),eq);
 eq = hp_eq : tilt_eq : side_eq_b with{
   // HIGHPASS
-  hp_eq = par(i,2,fi.highpass(1,freq)) with {
+  hp_eq = par(i,Nch,fi.highpass(1,freq)) with {
   freq = vslider("v:master_me/t:expert/h:[3]eq/h:[1]highpass/[1]eq highpass freq [unit:Hz] [scale:log] [symbol:eq_highpass_freq]", 5, 5, 1000,1);
 };
 
   // TILT EQ STEREO
-  tilt_eq = par(i,2,_) : par(i,2, fi.lowshelf(N, -gain, freq) : fi.highshelf(N, gain, freq)) with{
+  tilt_eq = par(i,Nch,_) : par(i,Nch, fi.lowshelf(N, -gain, freq) : fi.highshelf(N, gain, freq)) with{
     N = 1;
-    gain = vslider("v:master_me/t:expert/h:[3]eq/h:[2]tilt eq/[1]eq tilt gain [unit:dB] [symbol:eq_tilt_gain]",0,-6,6,0.5):si.smoo;
+    gain = vslider("v:master_me/t:expert/h:[3]eq/h:[2]tilt eq/[1]eq tilt gain [unit:dB] [symbol:eq_tilt_gain]",0,-6,6,0.5); // smoothed at control rate on the plugin side
     freq = 630; //vslider("v:master_me/t:expert/h:[3]eq/h:[2]tilt eq/[2]eq tilt freq [unit:Hz] [scale:log] [symbol:eq_tilt_freq]", 630, 200, 2000,1);
   };
 
 
 
-  // SIDE EQ
-  side_eq_b =  ms_enc : _,band_shelf(freq_low,freq_high,eq_side_gain) : ms_dec with{
+  // SIDE EQ, of the front pair
+  side_eq_b =  front_pair(ms_enc : _,band_shelf(freq_low,freq_high,eq_side_gain) : ms_dec) with{
 
     //band_shelf(freq1 ,freq2 ,gain) = fi.low_shelf(0-gain,freq1): fi.low_shelf(gain,freq2);
     band_shelf(freq1 ,freq2 ,gain) = fi.svf.ls(freq1,0.7,0-gain): fi.svf.ls(freq2,0.7,gain);
@@ -212,7 +265,7 @@ eq = hp_eq : tilt_eq : side_eq_b with{
     freq_low = eq_side_freq - eq_side_freq*eq_side_width : max(50);
     freq_high = eq_side_freq + eq_side_freq*eq_side_width : min(8000);
 
-    eq_side_gain = vslider("v:master_me/t:expert/h:[3]eq/h:[3]side eq/[1]eq side gain [unit:dB] [symbol:eq_side_gain]",0,0,12,0.5):si.smoo;
+    eq_side_gain = vslider("v:master_me/t:expert/h:[3]eq/h:[3]side eq/[1]eq side gain [unit:dB] [symbol:eq_side_gain]",0,0,12,0.5); // smoothed at control rate on the plugin side
     eq_side_freq = vslider("v:master_me/t:expert/h:[3]eq/h:[3]side eq/[2]eq side freq [unit:Hz] [scale:log] [symbol:eq_side_freq]", 600,200,5000,1);
     eq_side_width = vslider("v:master_me/t:expert/h:[3]eq/h:[3]side eq/[3]eq side bandwidth [symbol:eq_side_bandwidth]", 1,0.5,4,0.5);
 
@@ -224,19 +277,25 @@ eq = hp_eq : tilt_eq : side_eq_b with{
 // LEVELER
 
 
-leveler_sc(target,fl,fr,l,r) =
-  (calc(lk2_short(fl,fr))*(1-bp)+bp)
-  <: (_*l,_*r)
+// measures the feedback channels (first Nch inputs), brakes on the sum of the input channels (next Nch)
+leveler_sc(target) =
+  lk2_short, (si.bus(Nch) <: key, si.bus(Nch))
+  : gain, si.bus(Nch)
+  : (_ <: si.bus(Nch)), si.bus(Nch) : ro.interleave(Nch,2) : par(i,Nch,*)
 with {
 
-  lp1p(cf) = si.smooth(ba.tau2pole(1/(2*ma.PI*cf)));
+  key = par(i,Nch,abs) :> _;
+  gain(lufs,sc) = calc(lufs,sc)*(1-bp)+bp;
 
-  calc(lufs) = FB(lufs)~_: ba.db2linear;
-  FB(lufs,prev_gain) =
+  // the speed goes down to fractions of 1Hz, too slow for si.smooth in single precision
+  lp1p(cf) = precise_lp1(2*ma.PI*cf/ma.SR);
+
+  calc(lufs,sc) = FB(lufs,sc)~_: ba.db2linear;
+  FB(lufs,sc,prev_gain) =
     (target - lufs)
     +(prev_gain )
     :  limit(limit_neg,limit_pos)
-    : lp1p(leveler_speed_brake(abs(l)+abs(r)))
+    : lp1p(leveler_speed_brake(sc))
     : leveler_meter_gain;
 
   bp = checkbox("v:master_me/t:expert/h:[3]leveler/[1]leveler bypass[symbol:leveler_bypass]") : si.smoo;
@@ -257,7 +316,7 @@ with {
        :max(0)
        :min(1));
 
-   maxHold = hold*192000;
+   maxHold = hold*maxSR;
    strength = 2;
    range = -120;
    gate_att = 0.05;
@@ -270,18 +329,24 @@ with {
 
 // SIDE CHAIN COMPRESSOR
 
-sc_compressor(fl,fr,l,r) =
-  (fl,fr,l,r)
-  : feedforward_feedback
-  : (ms_enc,ms_enc):
-  (((RMS_compression_gain_N_chan_db(strength,thresh,att,rel,knee,0,link,N)),si.bus(N) )
-   : ro.interleave(N,2) : par(i,N,(meter(i) : post_gain : ba.db2linear*(1-bypass)+bypass)*_))
-  : ms_dec
-  : ((l,_,r,_):par(i, 2, it.interpolate_linear(dw)))
+// the feedback channels (first Nch inputs) are mixed with the input channels (next Nch) for the level detection,
+// all channels are linked, the front pair in mid/side
+sc_compressor =
+  B, (B <: B, B)
+  : (compress, B)
+  : ro.interleave(N,2) : par(i, N, ro.cross(2) : it.interpolate_linear(dw))
 
 with {
-  N = 2;
-  B = si.bus(2);
+  N = Nch;
+  B = si.bus(N);
+
+  compress =
+    feedforward_feedback
+    : (front_pair(ms_enc),front_pair(ms_enc)):
+    (((RMS_compression_gain_N_chan_db(strength,thresh,att,rel,knee,0,link,N) : front_pair(par(i,2,meter(i)))),si.bus(N) )
+     : ro.interleave(N,2) : par(i,N,(post_gain : ba.db2linear*(1-bypass)+bypass)*_))
+    : front_pair(ms_dec);
+
   bypass = checkbox("v:master_me/t:expert/h:[5]kneecomp/[0][symbol:kneecomp_bypass]kneecomp bypass"):si.smoo;
   strength = vslider("v:master_me/t:expert/h:[5]kneecomp/[1][unit:%][integer][symbol:kneecomp_strength]kneecomp strength", 20, 0, 100, 1) * 0.01;
   thresh = target + vslider("v:master_me/t:expert/h:[5]kneecomp/[2][symbol:kneecomp_threshold][unit:dB]kneecomp tar-thresh",init_kneecomp_thresh,-12,6,1);
@@ -297,7 +362,7 @@ with {
                      "v:master_me/t:expert/h:[5]kneecomp/[symbol:kneecomp_meter_%i][unit:dB]kneecomp meter %i", -6, 0)
                   ));
 
-  feedforward_feedback = B,(B<:B,B) : par(i,2,_*fffb), par(i,2,_* (1-fffb)),B : (_,_,_,_:>_,_),_,_;
+  feedforward_feedback = B,(B<:B,B) : par(i,N,_*fffb), par(i,N,_* (1-fffb)),B : (si.bus(2*N):>B),B;
 
 
   // dev version of faust has this in the libs, TODO, use co.RMS_compression_gain_N_chan_db
@@ -332,10 +397,10 @@ with {
 
 
 // MSCOMP Interpolated (Bart Brouns)
-mscomp_bp = bp2(checkbox("v:master_me/t:expert/h:[5]mscomp/h:[0]bypass/[0][symbol:mscomp_bypass]mscomp bypass"),
-                ms_enc
+mscomp_bp = bpN(checkbox("v:master_me/t:expert/h:[5]mscomp/h:[0]bypass/[0][symbol:mscomp_bypass]mscomp bypass"),
+                front_pair(ms_enc)
                 : B_band_Compressor_N_chan(Nba,Nch)
-                : ms_dec
+                : front_pair(ms_dec)
                ) ;
 
 B_band_Compressor_N_chan(B,N) =
@@ -356,18 +421,28 @@ with {
   ;
 
   // TODO: use co.peak_compression_gain_N_chan_db when it arrives in the current faust version
-  compressor(N,prePost,strength,thresh,att,rel,knee,link) = peak_compression_gain_N_chan_db (strength,thresh,att,rel,knee,prePost,link,N);
+  compressor(N,prePost,strength,thresh,att,rel,knee,link) = peak_compression_gain_N_chan_db_l2db (mscomp_linear2db,strength,thresh,att,rel,knee,prePost,link,N);
+
+  // 16 of these run per sample, use an inline approximation instead of libm log10 (see plugin/dsp/FastMath.hpp).
+  // only the log is replaced here. `make pregen` then runs the whole gain computers of both channels as one vector
+  // kernel (see template/mscomp_kernel.py), which relies on the faust code of peak_compression_gain_N_chan_db_l2db
+  mscomp_linear2db = ffunction(float mscomp_linear2db(float), "dsp/FastMath.hpp", "");
 
   gain_calc = (strength_array, thresh_array, att_array, rel_array, knee_array, link_array, si.bus(N*B))
               : ro.interleave(B,6+N)
               : par(i, B, compressor(N,prePost)) // : si.bus (N * Nr_bands)
-              : par(b, B, par(c, N, meter(b+1, c+1)));
+              : par(b, B, front_pair(par(c, 2, meter(b+1, c+1))))
+              : idle_meters(8-B);
+
+  // the plugin has meters for 8 bands, with fewer bands the ones above B stay at 0 dB
+  idle_meters(0) = si.bus(N*B);
+  idle_meters(n) = attach(_, par(b, n, par(c, 2, 0 : meter(B+b+1, c+1))) :> _), si.bus(N*B-1);
 
 
   outputGain = par(i, N, _*mscomp_outGain);
 
   /* TODO: separate %b%c in symbol name so that it is a valid C/C++ variable-name (ideally an underscore) %b_%c
-   * meanwhile this is safe since there are only 8 bands (1..9) and 2 channels.
+   * meanwhile this is safe since there are only 8 bands (1..9) and 2 channels, as only the front pair is metered.
    */
   meter(b,c) =
     _<: attach(_, (max(-6):min(0):vbargraph(
@@ -421,8 +496,8 @@ with {
 };
 
 // LIMITER
-limiter_rms_bp = bp2(checkbox("v:master_me/t:expert/h:[7]limiter/[0]limiter bypass[symbol:limiter_bypass]"),limiter_rms);
-limiter_rms = co.RMS_FBFFcompressor_N_chan(strength,thresh,att,rel,knee,0,1,fffb,limiter_meter,2) : post_gain with{
+limiter_rms_bp = bpN(checkbox("v:master_me/t:expert/h:[7]limiter/[0]limiter bypass[symbol:limiter_bypass]"),limiter_rms);
+limiter_rms = co.RMS_FBFFcompressor_N_chan(strength,thresh,att,rel,knee,0,1,fffb,limiter_meter,Nch) : post_gain with{
   strength = vslider("v:master_me/t:expert/h:[7]limiter/[1][unit:%][integer][symbol:limiter_strength]limiter strength", 80, 0, 100, 1) *0.01;
   thresh = target + vslider("v:master_me/t:expert/h:[7]limiter/[2][symbol:limiter_threshold][unit:dB]limiter tar-thresh",6,-12,12,1);
   att = vslider("v:master_me/t:expert/h:[7]limiter/[3][unit:ms][symbol:limiter_attack]limiter attack",1,0,100,1)*0.001;
@@ -440,9 +515,9 @@ limiter_rms = co.RMS_FBFFcompressor_N_chan(strength,thresh,att,rel,knee,0,1,fffb
 };
 
 // LIMITER NO LATENCY
-brickwall_no_latency_bp = bp2(checkbox("v:master_me/t:expert/h:[8]brickwall/[1][symbol:brickwall_bypass]brickwall bypass"),brickwall_no_latency);
+brickwall_no_latency_bp = bpN(checkbox("v:master_me/t:expert/h:[8]brickwall/[1][symbol:brickwall_bypass]brickwall bypass"),brickwall_no_latency);
 brickwall_no_latency =
-  co.FFcompressor_N_chan(1,threshLim,att,rel,knee,0,link,meter_brickwall,2)
+  co.FFcompressor_N_chan(1,threshLim,att,rel,knee,0,link,meter_brickwall,Nch)
 with {
 
   threshLim = vslider("v:master_me/t:expert/h:[8]brickwall/[3]brickwall ceiling[unit:dB][symbol:brickwall_ceiling]",init_brickwall_ceiling,-6,-0,0.1);
@@ -462,9 +537,12 @@ with {
 
 // +++++++++++++++++++++++++ LUFS METER +++++++++++++++++++++++++
 
-lk2_var(Tg)= par(i,2,kfilter : zi) :> 4.342944819 * log(max(1e-12)) : -(0.691) with {
-  // maximum assumed sample rate is 192k
-  maxSR = 192000;
+// The window of the sliding sum is a faust delay line, whose length has to be known at compile time,
+// so it is sized for Tg at maxSR and not for the rate of the host. For lk2_short in the leveler this is
+// 0.4 s at 192 kHz, 76800 samples (a 131072 float ring) per channel, of which 19200 are used at 48 kHz.
+// It is inside the per-sample feedback loop of the leveler, so unlike the 3s meters it cannot move to the plugin;
+// builds for lower rates only can shrink it with maxSR (see EMBEDDED_MAX_SAMPLE_RATE in the Makefile).
+lk2_var(Tg)= par(i,Nch,kfilter : zi : *(bs1770_weight(i))) :> 4.342944819 * log(max(1e-12)) : -(0.691) with {
   sump(n) = ba.slidingSump(n, Tg*maxSR)/max(n,ma.EPSILON);
   envelope(period, x) = x * x :  sump(rint(period * ma.SR));
   zi = envelope(Tg); // mean square: average power = energy/Tg = integral of squared signal / Tg
@@ -476,13 +554,23 @@ lk2_var(Tg)= par(i,2,kfilter : zi) :> 4.342944819 * log(max(1e-12)) : -(0.691) w
 lk2 = lk2_var(3);
 lk2_short = lk2_var(0.4);
 
-lufs_meter_in(l,r) = l,r <: l, attach(r, (lk2 : vbargraph("v:master_me/h:easy/[2][unit:dB][symbol:lufs_in]in lufs-s",-70,0))) : _,_;
-lufs_meter_out(l,r) = l,r <: l, attach(r, (lk2 : vbargraph("v:master_me/h:easy/[7][unit:dB][symbol:lufs_out]out lufs-s",-70,0))) : _,_;
+// The 3s short-term meters are computed by the plugin on 100ms blocks (see plugin/dsp/R128LoudnessMeter.hpp),
+// which also provides gated integrated loudness.
+// The bargraphs are kept here so the parameter layout stays the same.
+lufs_meter_in = front_pair((_, attach(_, (0 : vbargraph("v:master_me/h:easy/[2][unit:dB][symbol:lufs_in]in lufs-s",-70,0)))));
+lufs_meter_out = front_pair((_, attach(_, (0 : vbargraph("v:master_me/h:easy/[7][unit:dB][symbol:lufs_out]out lufs-s",-70,0)))));
 
 /* ******* 8< *******/
 // TODO: use co.peak_compression_gain_N_chan_db when it arrives in the current faust version
 peak_compression_gain_mono_db(strength,thresh,att,rel,knee,prePost) =
-  abs : ba.bypass1(prePost,si.onePoleSwitching(att,rel)) : ba.linear2db : gain_computer(strength,thresh,knee) : ba.bypass1((prePost !=1),si.onePoleSwitching(rel,att))
+  peak_compression_gain_mono_db_l2db(ba.linear2db,strength,thresh,att,rel,knee,prePost);
+
+peak_compression_gain_N_chan_db(strength,thresh,att,rel,knee,prePost,link,N) =
+  peak_compression_gain_N_chan_db_l2db(ba.linear2db,strength,thresh,att,rel,knee,prePost,link,N);
+
+// same as above, with a custom linear to dB conversion for the level detector
+peak_compression_gain_mono_db_l2db(l2db,strength,thresh,att,rel,knee,prePost) =
+  abs : ba.bypass1(prePost,si.onePoleSwitching(att,rel)) : l2db : gain_computer(strength,thresh,knee) : ba.bypass1((prePost !=1),si.onePoleSwitching(rel,att))
 with {
   gain_computer(strength,thresh,knee,level) =
     select3((level>(thresh-(knee/2)))+(level>(thresh+(knee/2))),
@@ -492,11 +580,11 @@ with {
     : max(0)*-strength;
 };
 
-peak_compression_gain_N_chan_db(strength,thresh,att,rel,knee,prePost,link,1) =
-  peak_compression_gain_mono_db(strength,thresh,att,rel,knee,prePost);
+peak_compression_gain_N_chan_db_l2db(l2db,strength,thresh,att,rel,knee,prePost,link,1) =
+  peak_compression_gain_mono_db_l2db(l2db,strength,thresh,att,rel,knee,prePost);
 
-peak_compression_gain_N_chan_db(strength,thresh,att,rel,knee,prePost,link,N) =
-  par(i, N, peak_compression_gain_mono_db(strength,thresh,att,rel,knee,prePost))
+peak_compression_gain_N_chan_db_l2db(l2db,strength,thresh,att,rel,knee,prePost,link,N) =
+  par(i, N, peak_compression_gain_mono_db_l2db(l2db,strength,thresh,att,rel,knee,prePost))
   <: (si.bus(N),(ba.parallelMin(N) <: si.bus(N))) : ro.interleave(N,2) : par(i,N,(it.interpolate_linear(link)));
 
 /* ******* >8 *******/
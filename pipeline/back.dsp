@@ -0,0 +1,11 @@
+// -*-Faust-*-
+
+// Second part of the master_me chain for the pipelined build, leveler, dynamics and output meters.
+// Takes the unprocessed input on the first inputs and the output of front.dsp on the next ones.
+
+import("stdfaust.lib");
+mm = library("master_me.dsp");
+
+declare name "master_me back";
+
+process = si.bus(mm.Nch), mm.chain_back : mm.bp_mix(mm.Nch, mm.global_bypass) : mm.lufs_meter_out : mm.peakmeter_out;
@@ -0,0 +1,11 @@
+// -*-Faust-*-
+
+// First part of the master_me chain for the pipelined build, pre-processing, gate and eq.
+// The unprocessed input is passed along on the first outputs, for the global bypass in back.dsp.
+
+import("stdfaust.lib");
+mm = library("master_me.dsp");
+
+declare name "master_me front";
+
+process = si.bus(mm.Nch) <: si.bus(mm.Nch), mm.chain_front;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#define DISTRHO_PLUGIN_WANT_LATENCY    1
 #define DISTRHO_PLUGIN_WANT_PROGRAMS   1
 #define DISTRHO_PLUGIN_WANT_STATE      1
 #define DISTRHO_PLUGIN_WANT_FULL_STATE 1
@@ -18,9 +19,24 @@
 #define DISTRHO_UI_DEFAULT_WIDTH 1030
 #define DISTRHO_UI_DEFAULT_HEIGHT 597
 
-#define DISTRHO_PLUGIN_CLAP_ID "trummerschlunk.master_me"
 #define DISTRHO_PLUGIN_BRAND_ID KlSc
+
+// multichannel builds are separate plugins, they must not share ids with the stereo one
+#if DISTRHO_PLUGIN_NUM_INPUTS == 2
+#define DISTRHO_PLUGIN_CLAP_ID "trummerschlunk.master_me"
 #define DISTRHO_PLUGIN_UNIQUE_ID SndG
+#elif DISTRHO_PLUGIN_NUM_INPUTS == 6
+#define DISTRHO_PLUGIN_CLAP_ID "trummerschlunk.master_me_6ch"
+#define DISTRHO_PLUGIN_UNIQUE_ID SnG6
+#elif DISTRHO_PLUGIN_NUM_INPUTS == 8
+#define DISTRHO_PLUGIN_CLAP_ID "trummerschlunk.master_me_8ch"
+#define DISTRHO_PLUGIN_UNIQUE_ID SnG8
+#elif DISTRHO_PLUGIN_NUM_INPUTS == 12
+#define DISTRHO_PLUGIN_CLAP_ID "trummerschlunk.master_me_12ch"
+#define DISTRHO_PLUGIN_UNIQUE_ID SnGC
+#else
+#error unsupported channel count, see plugin/dsp/ChannelLayout.hpp
+#endif
 
 #define DPF_VST3_DONT_USE_BRAND_ID
 
@@ -32,6 +48,48 @@
 #define MASTER_ME_SHARED_MEMORY 1
 #endif
 
+// instrumented build, timing each processing stage and reporting to the UI inspector through telemetry
+#ifndef MASTER_ME_PROFILE
+#define MASTER_ME_PROFILE 0
+#endif
+
+#if MASTER_ME_PROFILE && ! MASTER_ME_SHARED_MEMORY
+#error MASTER_ME_PROFILE requires MASTER_ME_SHARED_MEMORY
+#endif
+
+// pipelined build, optionally running the chain as two stages on separate threads (see pipeline/*.dsp)
+#ifndef MASTER_ME_PIPELINE
+#define MASTER_ME_PIPELINE 0
+#endif
+
+// headless telemetry export over UDP, used at runtime when MASTER_ME_EXPORT is set to a host:port destination
+#ifndef MASTER_ME_TELEMETRY_EXPORT
+#define MASTER_ME_TELEMETRY_EXPORT MASTER_ME_SHARED_MEMORY
+#endif
+
+#if MASTER_ME_TELEMETRY_EXPORT && ! MASTER_ME_SHARED_MEMORY
+#error MASTER_ME_TELEMETRY_EXPORT requires MASTER_ME_SHARED_MEMORY
+#endif
+
+// embedded profile, lighter faust dsp for MOD and other ARM devices (see EMBEDDED in the Makefile)
+#ifndef MASTER_ME_EMBEDDED
+#define MASTER_ME_EMBEDDED 0
+#endif
+
+// highest sample rate the faust delay lines are sized for, loudness windows and hold times get shorter above it
+#ifndef MASTER_ME_MAX_SAMPLE_RATE
+#if MASTER_ME_EMBEDDED
+#define MASTER_ME_MAX_SAMPLE_RATE 48000
+#else
+#define MASTER_ME_MAX_SAMPLE_RATE 192000
+#endif
+#endif
+
+// how often the UI redraws meters and histogram at most, can be lowered at runtime with MASTER_ME_UI_FPS
+#ifndef MASTER_ME_UI_MAX_FPS
+#define MASTER_ME_UI_MAX_FPS 30
+#endif
+
 static constexpr const struct EasyPreset {
     const char* const name;
     float values[61];
@@ -63,16 +121,33 @@ enum ExtraParameters {
 #if ! MASTER_ME_SHARED_MEMORY
     kExtraParameterHistogramValueIn,
     kExtraParameterHistogramValueOut,
+#endif
+    kExtraParameterLufsInIntegrated,
+    kExtraParameterLufsOutIntegrated,
+    kExtraParameterBrickwallTruePeak,
+    kExtraParameterTruePeakOut,
+    kExtraParameterBrickwallLookahead,
+    kExtraParameterBrickwallLookaheadTime,
+    kExtraParameterLevelerLookahead,
+    kExtraParameterLevelerLookaheadTime,
+    kExtraParameterPresetMorphTime,
+#if MASTER_ME_PIPELINE
+    kExtraParameterPipelined,
 #endif
     kExtraParameterCount
 };
 
+// number of values in each preset, the first (global bypass) is not set by presets
+static constexpr const uint kNumPresetValues = sizeof(kEasyPresets[0].values)/sizeof(kEasyPresets[0].values[0]);
+
 enum ExtraPrograms {
     kExtraProgramCount = sizeof(kEasyPresets)/sizeof(kEasyPresets[0]),
 };
 
 enum ExtraStates {
     kExtraStateMode = 0,
+    kExtraStateWarmState,
+    kExtraStateHistogramTimeline,
     kExtraStateCount
 };
 
@@ -81,12 +156,62 @@ static constexpr const uint kMinimumHistogramBufferSize = 4096;
 #if MASTER_ME_SHARED_MEMORY
 #include "utils/FloatFifo.hpp"
 
-typedef FloatFifo<128> MasterMeFloatFifo;
-typedef FloatFifoControl<128> MasterMeFifoControl;
+// capacity of each meter fifo shared between plugin and UI, must be a power of 2
+#ifndef MASTER_ME_FIFO_SIZE
+#define MASTER_ME_FIFO_SIZE 256
+#endif
+
+typedef FloatFifo<MASTER_ME_FIFO_SIZE> MasterMeFloatFifo;
+typedef FloatFifoControl<MASTER_ME_FIFO_SIZE> MasterMeFifoControl;
+
+#include "utils/SeqLock.hpp"
+
+// all meters, that is all faust output parameters, in the same order
+static constexpr const uint kTelemetryFirstMeter = kParameter_peakmeter_in_l;
+static constexpr const uint kTelemetryNumMeters = kParameterCount - kTelemetryFirstMeter;
+
+// processing stages timed in MASTER_ME_PROFILE builds, in processing order
+// the faust dsp is a single stage, its compute function has all of its stages fused together,
+// except in the pipelined build, where its front stage (up to the eq) runs and is timed in the worker
+enum ProfileStages {
+    kProfileStageLufsIn,
+    kProfileStageLookaheadLeveler,
+    kProfileStagePipelineFront,
+    kProfileStageDsp,
+    kProfileStageBrickwall,
+    kProfileStageTruePeak,
+    kProfileStageLufsOut,
+    kProfileStageCount
+};
+
+static constexpr const char* const kProfileStageNames[kProfileStageCount] = {
+    "lufs in meter",
+    "lookahead leveler",
+    "faust front stage (worker)",
+    "faust dsp / back stage",
+    "true-peak/lookahead brickwall",
+    "true peak meter",
+    "lufs out meter",
+};
+
+// bumped on any change to the telemetry layout
+static constexpr const uint32_t kTelemetryVersion = 4;
+
+struct MasterMeTelemetry {
+    // set by the UI when creating the shared memory, the plugin only writes to a matching version
+    uint32_t version;
+    // written by the plugin once per audio block
+    SeqLockFloats<kTelemetryNumMeters> meters;
+    // p50 and p99 in ns per sample for each stage, written about once per second, only in MASTER_ME_PROFILE builds
+    SeqLockFloats<kProfileStageCount * 2> profile;
+    // NaN and Inf input samples replaced by silence so far, wraps around
+    std::atomic<uint32_t> badInputSamples;
+};
 
 struct MasterMeHistogramFifos {
     MasterMeFloatFifo lufsIn;
     MasterMeFloatFifo lufsOut;
+    MasterMeTelemetry telemetry;
     bool closed;
 };
 #endif // MASTER_ME_SHARED_MEMORY
@@ -2,20 +2,100 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "DistrhoPlugin.hpp"
+#include "extra/Base64.hpp"
 #include "extra/ScopedDenormalDisable.hpp"
 
 // faustpp generated plugin template
 #include "DistrhoPluginInfo.h"
 #include "Plugin.cpp"
 
+#if MASTER_ME_PIPELINE
+// faustpp generated stages of the pipelined build, see template/PipelineStage.hpp
+#include "PipelineFront.hpp"
+#include "PipelineBack.hpp"
+#include "utils/FloatFifo.hpp"
+#endif
+
+#include "dsp/ChannelLayout.hpp"
+#include "dsp/R128LoudnessMeter.hpp"
+#include "dsp/BrickwallLimiter.hpp"
+#include "dsp/LookaheadLeveler.hpp"
+#include "dsp/ControlRateSmoother.hpp"
+#include "dsp/InputSanitizer.hpp"
+#include "dsp/PresetMorph.hpp"
+#include "dsp/SilenceDetector.hpp"
+#include "utils/WarmState.hpp"
+
+#if MASTER_ME_PROFILE
+#include "utils/StageProfiler.hpp"
+#define MASTER_ME_PROFILE_MARK(stage) profiler.mark(stage)
+#define MASTER_ME_PROFILE_FRONT_MARK(stage) pipelineFrontTimes.mark(stage)
+#else
+#define MASTER_ME_PROFILE_MARK(stage)
+#define MASTER_ME_PROFILE_FRONT_MARK(stage)
+#endif
+
 // leaving for last, includes windows.h
 #if MASTER_ME_SHARED_MEMORY
 #include "utils/SharedMemory.hpp"
 #endif
+#if MASTER_ME_PIPELINE
+#include "utils/PipelineThread.hpp"
+#endif
+#if MASTER_ME_TELEMETRY_EXPORT
+#include "utils/TelemetryExporter.hpp"
+#endif
 
 // checks to ensure things are still as we expect them to be from faust dsp side
-static_assert(DISTRHO_PLUGIN_NUM_INPUTS == 2, "has 2 audio inputs");
-static_assert(DISTRHO_PLUGIN_NUM_OUTPUTS == 2, "has 2 audio outputs");
+static_assert(DISTRHO_PLUGIN_NUM_INPUTS == DISTRHO_PLUGIN_NUM_OUTPUTS, "has as many audio inputs as outputs");
+
+// stereo, or one of the multichannel layouts (see CHANNELS in the Makefile and dsp/ChannelLayout.hpp)
+static constexpr const uint kNumChannels = DISTRHO_PLUGIN_NUM_INPUTS;
+static_assert(DISTRHO_NAMESPACE::ChannelLayout::isSupported(kNumChannels), "has a supported channel layout");
+
+// the lookahead leveler, lookahead/true-peak brickwall and true-peak meter are stereo only,
+// multichannel builds always use the faust leveler and brickwall
+static constexpr const bool kHasStereoExtras = kNumChannels == 2;
+
+// number of frames between each step of the control rate smoothers
+// keep as a multiple of the faust vector size (FAUST_VECTOR_SIZE in the Makefile), so steps are whole faust sub-blocks
+static constexpr const uint32_t kControlRateFrames = 16;
+
+#if MASTER_ME_PIPELINE
+// switching pipelined processing on or off, the side taking over runs alongside for this long at least,
+// so filters, compressors and loudness windows settle, and then until its leveler gain is close enough
+// the maximum is for when the leveler is braked and cannot catch up, then it switches anyway
+static constexpr const float kPipelineHandoverMinSeconds = 3.f;
+static constexpr const float kPipelineHandoverMaxSeconds = 60.f;
+static constexpr const float kPipelineHandoverMaxGainDifferenceDb = 0.05f;
+
+// capacity of each fifo between the two pipeline stages, in frames, must be a power of 2
+// they hold one buffer of latency plus the block being written, so pipelining works up to half of this buffer size
+static constexpr const uint32_t kPipelineFifoSize = 32768;
+#endif
+
+// how long setState of "warm_state" waits for the audio thread to swap in the new state, in milliseconds
+static constexpr const uint kWarmStateTimeoutMs = 500;
+
+// sections of the warm state, see WarmState.hpp
+enum WarmStateSections {
+    kWarmStateSectionDsp = 1,
+    kWarmStateSectionLufsIn,
+    kWarmStateSectionLufsOut,
+    kWarmStateSectionLeveler,
+    kWarmStateSectionPipelineFront,
+    kWarmStateSectionPipelineBack
+};
+
+#if MASTER_ME_SHARED_MEMORY
+// how often meters are updated for the host while the UI reads them through telemetry
+static constexpr const double kHostMeterUpdateSeconds = 0.25;
+#endif
+
+#if MASTER_ME_TELEMETRY_EXPORT
+// default time between telemetry export datagrams, can be changed with MASTER_ME_EXPORT_INTERVAL
+static constexpr const uint kTelemetryExportIntervalMs = 100;
+#endif
 
 START_NAMESPACE_DISTRHO
 
@@ -25,6 +105,122 @@ class MasterMePlugin : public FaustGeneratedPlugin
 {
     // current mode
     String mode;
+    String histogramTimeline;
+
+    // loudness meters, see lufs_meter_in/out in master_me.dsp
+    R128LoudnessMeterBase<kNumChannels> lufsInMeter;
+    R128LoudnessMeterBase<kNumChannels> lufsOutMeter;
+    float lufsInValue = -70.f;
+    float lufsOutValue = -70.f;
+    float lufsInIntegratedValue = -70.f;
+    float lufsOutIntegratedValue = -70.f;
+
+    // optional brickwall with true-peak detection and/or lookahead, replaces the faust one when enabled
+    BrickwallLimiter brickwallLimiter;
+    TruePeakDetector truePeakOutDetector;
+    bool brickwallBypass = kParameterRanges[kParameter_brickwall_bypass].def > 0.5f;
+    bool brickwallTruePeak = false;
+    bool brickwallLookahead = false;
+    float brickwallLookaheadTime = BrickwallLimiter::kDefaultLookaheadMs;
+    bool brickwallModeChanged = true;
+    bool brickwallRunning = false;
+    float truePeakOutValue = -70.f;
+
+    // optional leveler with lookahead, runs before faust and replaces its leveler when enabled
+    LookaheadLeveler lookaheadLeveler;
+    bool levelerBypass = kParameterRanges[kParameter_leveler_bypass].def > 0.5f;
+    bool levelerLookahead = false;
+    float levelerLookaheadTime = 3.f;
+    bool levelerModeChanged = true;
+    bool levelerRunning = false;
+
+    // the eq gains are smoothed here instead of si.smoo, so faust computes their filter coefficients once per block
+    ControlRateSmoother eqTiltGain;
+    ControlRateSmoother eqSideGain;
+
+    // presets loaded through loadProgram move there gradually, see startPresetMorph()
+    // the morph belongs to the audio thread, loadProgram only leaves the preset index here for run() to pick up
+    PresetMorph<kNumPresetValues> presetMorph;
+    float presetMorphTime = 1.f;
+    std::atomic<int> presetMorphRequest { -1 };
+
+    // silence fast path, see run()
+    SilenceDetector silenceDetector;
+    bool silenceIdle = false;
+
+    // NaN and Inf input samples replaced by silence since the plugin was created, reported through telemetry
+    uint32_t badInputSamples = 0;
+
+    // warm state, see getState("warm_state")
+    // while active the audio thread does the copies, the buffers belong to it while a request is pending
+    // capturing does not wait for it, getState returns the snapshot completed since the previous call
+    // restoring decodes into standby dsp instances and meter states first, the audio thread only swaps them in
+    enum WarmStateRequest {
+        kWarmStateRequestNone,
+        kWarmStateRequestBusy,
+        kWarmStateRequestCapture,
+        kWarmStateRequestRestore
+    };
+    mutable std::vector<uint8_t> warmStateDsp;
+    std::unique_ptr<mydsp, FaustDspDeleter<mydsp>> warmStateStandbyDsp;
+   #if MASTER_ME_PIPELINE
+    mutable std::vector<uint8_t> warmStatePipelineFront;
+    mutable std::vector<uint8_t> warmStatePipelineBack;
+    std::unique_ptr<pipeline_front::mydsp, FaustDspDeleter<pipeline_front::mydsp>> warmStateStandbyPipelineFront;
+    std::unique_ptr<pipeline_back::mydsp, FaustDspDeleter<pipeline_back::mydsp>> warmStateStandbyPipelineBack;
+   #endif
+    mutable R128LoudnessMeterBase<kNumChannels>::State warmStateLufsIn;
+    mutable R128LoudnessMeterBase<kNumChannels>::State warmStateLufsOut;
+    mutable float warmStateLevelerGain = 0.f;
+    R128LoudnessMeterBase<kNumChannels>::State warmStateStandbyLufsIn;
+    R128LoudnessMeterBase<kNumChannels>::State warmStateStandbyLufsOut;
+    float warmStateStandbyLevelerGain = 0.f;
+    mutable std::atomic<int> warmStateRequest { kWarmStateRequestNone };
+    mutable bool warmStateCapturePending = false;
+    mutable String warmStateLastCapture;
+    std::atomic<bool> activated { false };
+
+   #if MASTER_ME_PIPELINE
+    // optional pipelined processing, the front part of the chain runs in a worker one block ahead of the back part
+    // the stages come from pipeline/*.dsp, parameters and meters stay in the full dsp and are copied to/from them
+    struct PipelineFifos {
+        FloatFifo<kPipelineFifoSize> dry[kNumChannels];
+        FloatFifo<kPipelineFifoSize> wet[kNumChannels];
+    };
+    std::unique_ptr<pipeline_front::mydsp, FaustDspDeleter<pipeline_front::mydsp>> pipelineFront;
+    std::unique_ptr<pipeline_back::mydsp, FaustDspDeleter<pipeline_back::mydsp>> pipelineBack;
+    std::unique_ptr<PipelineFifos> pipelineFifoData;
+    FloatFifoControl<kPipelineFifoSize> pipelineDryFifos[kNumChannels];
+    FloatFifoControl<kPipelineFifoSize> pipelineWetFifos[kNumChannels];
+    // input copy for the worker, front stage outputs and back stage inputs, all of buffer size
+    std::vector<float> pipelineInputs[kNumChannels];
+    std::vector<float> pipelineFrontOutputs[kNumChannels * 2];
+    std::vector<float> pipelineBackInputs[kNumChannels * 2];
+    // the worker has its own copy of the eq gain smoothers, synced back once it is done, see finishPipelineFront
+    ControlRateSmoother pipelineEqTiltGain;
+    ControlRateSmoother pipelineEqSideGain;
+    // the worker job runs on past the end of the block that started it, so it is a member, declared before the thread
+    struct PipelineFrontJob {
+        MasterMePlugin* const self;
+        void operator()() const { self->runPipelineFront(); }
+    };
+    PipelineFrontJob pipelineFrontJob { this };
+    uint32_t pipelineFrontFrames = 0;
+    bool pipelineFrontPending = false;
+   #if MASTER_ME_PROFILE
+    // stages timed by the worker, added to the profiler once it is done
+    StageTimes<kProfileStageCount> pipelineFrontTimes;
+   #endif
+    PipelineThread pipelineThread;
+    bool pipelined = false;
+    bool pipelineModeChanged = true;
+    bool pipelineRunning = false;
+    uint32_t pipelineLatency = 0;
+    // the stages and the full dsp do not run at the same time, each has stale state when taking over,
+    // so the other side first runs alongside on the same input until it has caught up, see updatePipelineMode
+    bool pipelineHandover = false;
+    uint32_t pipelineHandoverFrames = 0;
+   #endif
 
     // histogram related stuff
     uint bufferSizeForHistogram;
@@ -38,6 +234,18 @@ class MasterMePlugin : public FaustGeneratedPlugin
     MasterMeFifoControl lufsInFifo;
     MasterMeFifoControl lufsOutFifo;
     SharedMemory<MasterMeHistogramFifos> histogramSharedData;
+    // meter values as reported to the host while telemetry is active, see updateTelemetry()
+    float hostMeterValues[kTelemetryNumMeters];
+    uint32_t hostMeterFrames = 0;
+    bool telemetryActive = false;
+   #if MASTER_ME_PROFILE
+    StageProfiler<kProfileStageCount> profiler;
+    bool profileReady = false;
+   #endif
+   #if MASTER_ME_TELEMETRY_EXPORT
+    // headless telemetry, only created when exporting, see MASTER_ME_EXPORT
+    std::unique_ptr<TelemetryExporter<kTelemetryNumMeters, MASTER_ME_FIFO_SIZE>> telemetryExporter;
+   #endif
    #else
     float histogramValueIn = -70.f;
     float histogramValueOut = -70.f;
@@ -46,9 +254,64 @@ class MasterMePlugin : public FaustGeneratedPlugin
 
 public:
     MasterMePlugin()
-        : FaustGeneratedPlugin(kExtraParameterCount, kExtraProgramCount, kExtraStateCount)
+        : FaustGeneratedPlugin(kExtraParameterCount, kExtraProgramCount, kExtraStateCount),
+          lufsInMeter(getSampleRate(), true),
+          lufsOutMeter(getSampleRate()),
+          brickwallLimiter(getSampleRate()),
+          lookaheadLeveler(getSampleRate()),
+          eqTiltGain(kParameterRanges[kParameter_eq_tilt_gain].def),
+          eqSideGain(kParameterRanges[kParameter_eq_side_gain].def),
+          silenceDetector(getSampleRate())
+         #if MASTER_ME_PROFILE
+        , profiler(getSampleRate())
+         #endif
     {
+        eqTiltGain.setSampleRate(getSampleRate(), kControlRateFrames);
+        eqSideGain.setSampleRate(getSampleRate(), kControlRateFrames);
         bufferSizeForHistogram = std::max(kMinimumHistogramBufferSize, getBufferSize());
+
+        presetMorph.setTime(getSampleRate(), presetMorphTime);
+        checkMaxSampleRate(getSampleRate());
+
+        for (uint i = 0; i < kNumPresetValues; ++i)
+        {
+            Parameter param;
+            initParameter(i, param);
+
+            if (param.hints & kParameterIsBoolean)
+                presetMorph.setKind(i, PresetMorph<kNumPresetValues>::kKindToggle);
+            else if (param.hints & kParameterIsInteger)
+                presetMorph.setKind(i, PresetMorph<kNumPresetValues>::kKindInteger);
+            else if (param.unit == "Hz" || param.unit == "ms")
+                presetMorph.setKind(i, PresetMorph<kNumPresetValues>::kKindLogarithmic);
+        }
+
+       #if MASTER_ME_PIPELINE
+        pipelineFront.reset(createFaustDsp<pipeline_front::mydsp>(getSampleRate()));
+        pipelineBack.reset(createFaustDsp<pipeline_back::mydsp>(getSampleRate()));
+        pipelineFifoData.reset(new PipelineFifos);
+
+        for (uint c = 0; c < kNumChannels; ++c)
+        {
+            pipelineDryFifos[c].setFloatFifo(&pipelineFifoData->dry[c]);
+            pipelineWetFifos[c].setFloatFifo(&pipelineFifoData->wet[c]);
+        }
+
+        resizePipelineBuffers(getBufferSize());
+       #endif
+
+       #if MASTER_ME_TELEMETRY_EXPORT
+        if (const char* const destination = std::getenv("MASTER_ME_EXPORT"))
+        {
+            const char* const interval = std::getenv("MASTER_ME_EXPORT_INTERVAL");
+            const int intervalMs = interval != nullptr ? std::atoi(interval) : 0;
+
+            telemetryExporter.reset(new TelemetryExporter<kTelemetryNumMeters, MASTER_ME_FIFO_SIZE>);
+
+            if (! telemetryExporter->start(destination, intervalMs > 0 ? intervalMs : kTelemetryExportIntervalMs))
+                telemetryExporter.reset();
+        }
+       #endif
     }
 
 protected:
@@ -65,11 +328,18 @@ protected:
 
     void initAudioPort(const bool input, const uint32_t index, AudioPort& port) override
     {
-        // always stereo
-        port.groupId = kPortGroupStereo;
+        if (kNumChannels == 2)
+            port.groupId = kPortGroupStereo;
 
         // everything else is as default
         Plugin::initAudioPort(input, index, port);
+
+        // multichannel ports are named after their channel
+        if (kNumChannels != 2)
+        {
+            port.name = input ? "Input " : "Output ";
+            port.name += ChannelLayout::getName(kNumChannels, index);
+        }
     }
 
     void initParameter(const uint32_t index, Parameter& param) override
@@ -122,6 +392,110 @@ protected:
             param.ranges.max = 0;
             break;
        #endif
+        case kExtraParameterLufsInIntegrated:
+            param.hints = kParameterIsOutput;
+            param.name = "in lufs-i";
+            param.unit = "dB";
+            param.symbol = "lufs_in_integrated";
+            param.shortName = "LufsInI";
+            param.ranges.def = -70;
+            param.ranges.min = -70;
+            param.ranges.max = 0;
+            break;
+        case kExtraParameterLufsOutIntegrated:
+            param.hints = kParameterIsOutput;
+            param.name = "out lufs-i";
+            param.unit = "dB";
+            param.symbol = "lufs_out_integrated";
+            param.shortName = "LufsOutI";
+            param.ranges.def = -70;
+            param.ranges.min = -70;
+            param.ranges.max = 0;
+            break;
+        case kExtraParameterBrickwallTruePeak:
+            // changes latency, so not automatable
+            param.hints = kParameterIsBoolean|kParameterIsInteger;
+            param.name = "brickwall true peak";
+            param.symbol = "brickwall_true_peak";
+            param.shortName = "BW TP";
+            param.ranges.def = 0;
+            param.ranges.min = 0;
+            param.ranges.max = 1;
+            break;
+        case kExtraParameterBrickwallLookahead:
+            // changes latency, so not automatable
+            param.hints = kParameterIsBoolean|kParameterIsInteger;
+            param.name = "brickwall lookahead";
+            param.symbol = "brickwall_lookahead";
+            param.shortName = "BW LA";
+            param.ranges.def = 0;
+            param.ranges.min = 0;
+            param.ranges.max = 1;
+            break;
+        case kExtraParameterBrickwallLookaheadTime:
+            // changes latency, so not automatable
+            param.hints = 0x0;
+            param.name = "brickwall lookahead time";
+            param.unit = "ms";
+            param.symbol = "brickwall_lookahead_time";
+            param.shortName = "BW LA time";
+            param.ranges.def = BrickwallLimiter::kDefaultLookaheadMs;
+            param.ranges.min = BrickwallLimiter::kMinLookaheadMs;
+            param.ranges.max = BrickwallLimiter::kMaxLookaheadMs;
+            break;
+        case kExtraParameterLevelerLookahead:
+            // changes latency, so not automatable
+            param.hints = kParameterIsBoolean|kParameterIsInteger;
+            param.name = "leveler lookahead";
+            param.symbol = "leveler_lookahead";
+            param.shortName = "LVL LA";
+            param.ranges.def = 0;
+            param.ranges.min = 0;
+            param.ranges.max = 1;
+            break;
+        case kExtraParameterLevelerLookaheadTime:
+            // changes latency, so not automatable
+            param.hints = 0x0;
+            param.name = "leveler lookahead time";
+            param.unit = "s";
+            param.symbol = "leveler_lookahead_time";
+            param.shortName = "LVL LA time";
+            param.ranges.def = 3;
+            param.ranges.min = 1;
+            param.ranges.max = LookaheadLeveler::kMaxLookaheadSeconds;
+            break;
+        case kExtraParameterPresetMorphTime:
+            param.hints = kParameterIsAutomatable;
+            param.name = "preset morph time";
+            param.unit = "s";
+            param.symbol = "preset_morph_time";
+            param.shortName = "Morph time";
+            param.ranges.def = 1;
+            param.ranges.min = 0;
+            param.ranges.max = 10;
+            break;
+       #if MASTER_ME_PIPELINE
+        case kExtraParameterPipelined:
+            // changes latency, so not automatable
+            param.hints = kParameterIsBoolean|kParameterIsInteger;
+            param.name = "pipelined processing";
+            param.symbol = "pipelined";
+            param.shortName = "Pipelined";
+            param.ranges.def = 0;
+            param.ranges.min = 0;
+            param.ranges.max = 1;
+            break;
+       #endif
+        case kExtraParameterTruePeakOut:
+            param.hints = kParameterIsOutput;
+            param.name = "out true peak";
+            param.unit = "dB";
+            param.symbol = "true_peak_out";
+            param.shortName = "TP out";
+            param.ranges.def = -70;
+            param.ranges.min = -70;
+            param.ranges.max = 0;
+            break;
         }
     }
 
@@ -144,6 +518,19 @@ protected:
             state.label = "Mode";
             state.description = "Simple vs Advanced mode switch";
             break;
+        case kExtraStateWarmState:
+            state.hints = kStateIsOnlyForDSP;
+            state.key = "warm_state";
+            state.label = "Warm State";
+            state.description = "Filters, envelopes, loudness windows and leveler gain, for continuing without warm-up";
+            break;
+        case kExtraStateHistogramTimeline:
+            state.hints = kStateIsHostReadable | kStateIsOnlyForUI;
+            state.key = "histogram_timeline";
+            state.defaultValue = "30";
+            state.label = "Histogram Timeline";
+            state.description = "Seconds of loudness history shown in easy mode";
+            break;
         }
     }
 
@@ -151,9 +538,52 @@ protected:
     * Internal data */
 
     float getParameterValue(const uint32_t index) const override
+    {
+       #if MASTER_ME_SHARED_MEMORY
+        // the UI gets meters through telemetry, the host only needs them at a lower rate
+        if (telemetryActive && index >= kTelemetryFirstMeter && index < kParameterCount)
+            return hostMeterValues[index - kTelemetryFirstMeter];
+       #endif
+
+        return getCurrentParameterValue(index);
+    }
+
+    // the actual value of a parameter, after the plugin side overrides
+    float getCurrentParameterValue(const uint32_t index) const
     {
         if (index < kParameterCount)
-            return FaustGeneratedPlugin::getParameterValue(index);
+        {
+            // report where a preset morph is going, so hosts save and show the preset values
+            const int requestedPreset = presetMorphRequest.load(std::memory_order_acquire);
+            if (requestedPreset >= 0 && index != kParameter_global_bypass && index < kNumPresetValues)
+                return kEasyPresets[requestedPreset].values[index];
+            if (presetMorph.isMorphing(index))
+                return presetMorph.getTarget(index);
+
+            switch (index)
+            {
+            case kParameter_brickwall_bypass:
+                return brickwallBypass ? 1.f : 0.f;
+            case kParameter_leveler_bypass:
+                return levelerBypass ? 1.f : 0.f;
+            case kParameter_leveler_gain:
+                return levelerRunning ? lookaheadLeveler.getGain()
+                                      : FaustGeneratedPlugin::getParameterValue(index);
+            case kParameter_leveler_brake:
+                return levelerRunning ? lookaheadLeveler.getBrake()
+                                      : FaustGeneratedPlugin::getParameterValue(index);
+            case kParameter_eq_tilt_gain:
+                return eqTiltGain.getTarget();
+            case kParameter_eq_side_gain:
+                return eqSideGain.getTarget();
+            case kParameter_lufs_in:
+                return lufsInValue;
+            case kParameter_lufs_out:
+                return lufsOutValue;
+            default:
+                return FaustGeneratedPlugin::getParameterValue(index);
+            }
+        }
 
         switch (index - kParameterCount)
         {
@@ -164,16 +594,144 @@ protected:
             return histogramValueIn;
         case kExtraParameterHistogramValueOut:
             return histogramValueOut;
+       #endif
+        case kExtraParameterLufsInIntegrated:
+            return lufsInIntegratedValue;
+        case kExtraParameterLufsOutIntegrated:
+            return lufsOutIntegratedValue;
+        case kExtraParameterBrickwallTruePeak:
+            return brickwallTruePeak ? 1.f : 0.f;
+        case kExtraParameterBrickwallLookahead:
+            return brickwallLookahead ? 1.f : 0.f;
+        case kExtraParameterBrickwallLookaheadTime:
+            return brickwallLookaheadTime;
+        case kExtraParameterTruePeakOut:
+            return truePeakOutValue;
+        case kExtraParameterLevelerLookahead:
+            return levelerLookahead ? 1.f : 0.f;
+        case kExtraParameterLevelerLookaheadTime:
+            return levelerLookaheadTime;
+        case kExtraParameterPresetMorphTime:
+            return presetMorphTime;
+       #if MASTER_ME_PIPELINE
+        case kExtraParameterPipelined:
+            return pipelined ? 1.f : 0.f;
        #endif
         default:
             return 0.0f;
         }
     }
 
+    void setParameterValue(const uint32_t index, const float value) override
+    {
+        if (index < kParameterCount)
+        {
+            // a new value from the host or UI takes over from a preset morph
+            if (index < kNumPresetValues)
+                presetMorph.cancel(index);
+
+            applyParameterValue(index, value);
+            return;
+        }
+
+        switch (index - kParameterCount)
+        {
+        case kExtraParameterBrickwallTruePeak:
+            brickwallTruePeak = value > 0.5f;
+            brickwallModeChanged = true;
+            break;
+        case kExtraParameterBrickwallLookahead:
+            brickwallLookahead = value > 0.5f;
+            brickwallModeChanged = true;
+            break;
+        case kExtraParameterBrickwallLookaheadTime:
+            brickwallLookaheadTime = value;
+            brickwallModeChanged = brickwallLookahead;
+            break;
+        case kExtraParameterLevelerLookahead:
+            levelerLookahead = value > 0.5f;
+            levelerModeChanged = true;
+            break;
+        case kExtraParameterLevelerLookaheadTime:
+            levelerLookaheadTime = value;
+            levelerModeChanged = levelerLookahead;
+            break;
+        case kExtraParameterPresetMorphTime:
+            presetMorphTime = value;
+            presetMorph.setTime(getSampleRate(), value);
+            break;
+       #if MASTER_ME_PIPELINE
+        case kExtraParameterPipelined:
+            pipelined = value > 0.5f;
+            pipelineModeChanged = true;
+            break;
+       #endif
+        }
+    }
+
+    // faust side of setParameterValue, also used by the preset morph
+    void applyParameterValue(const uint32_t index, const float value)
+    {
+        // the faust brickwall is kept bypassed while ours is running
+        if (index == kParameter_brickwall_bypass)
+        {
+            brickwallBypass = value > 0.5f;
+            return FaustGeneratedPlugin::setParameterValue(index, brickwallRunning ? 1.f : value);
+        }
+
+        // same for the leveler
+        if (index == kParameter_leveler_bypass)
+        {
+            levelerBypass = value > 0.5f;
+            return FaustGeneratedPlugin::setParameterValue(index, levelerRunning ? 1.f : value);
+        }
+
+        // smoothed values are sent to faust during run
+        if (index == kParameter_eq_tilt_gain)
+            return eqTiltGain.setTarget(value);
+        if (index == kParameter_eq_side_gain)
+            return eqSideGain.setTarget(value);
+
+        return FaustGeneratedPlugin::setParameterValue(index, value);
+    }
+
     void loadProgram(const uint32_t index) override
     {
+        DISTRHO_SAFE_ASSERT_RETURN(index < ARRAY_SIZE(kEasyPresets),);
+
+        // morphing happens in run(), nothing to morph while not playing or without morph time
+        if (activated.load(std::memory_order_acquire) && presetMorphTime > 0.f)
+        {
+            presetMorphRequest.store(static_cast<int>(index), std::memory_order_release);
+            return;
+        }
+
         const EasyPreset& preset(kEasyPresets[index]);
 
+        // everything but the global bypass
+        for (uint i=1; i<ARRAY_SIZE(preset.values); ++i)
+            setParameterValue(i, preset.values[i]);
+    }
+
+    // audio thread side of loadProgram
+    void startPresetMorph(const uint32_t index)
+    {
+        const EasyPreset& preset(kEasyPresets[index]);
+
+        // everything but the global bypass
+        float current[kNumPresetValues];
+        bool morph[kNumPresetValues];
+
+        for (uint i=0; i<kNumPresetValues; ++i)
+        {
+            current[i] = getCurrentParameterValue(i);
+            morph[i] = i != kParameter_global_bypass;
+        }
+
+        if (presetMorph.start(current, preset.values, morph))
+            return;
+
+        // morph time was set to 0 in the meantime, straight to the new values
         for (uint i=1; i<ARRAY_SIZE(preset.values); ++i)
             setParameterValue(i, preset.values[i]);
     }
@@ -182,6 +740,10 @@ protected:
     {
         if (std::strcmp(key, "mode") == 0)
             return mode;
+        if (std::strcmp(key, "warm_state") == 0)
+            return getWarmState();
+        if (std::strcmp(key, "histogram_timeline") == 0)
+            return histogramTimeline;
 
         return String();
     }
@@ -192,6 +754,14 @@ protected:
         {
             mode = value;
         }
+        else if (std::strcmp(key, "warm_state") == 0)
+        {
+            setWarmState(value);
+        }
+        else if (std::strcmp(key, "histogram_timeline") == 0)
+        {
+            histogramTimeline = value;
+        }
        #ifndef __MOD_DEVICES__
         else if (std::strcmp(key, "histogram") == 0)
         {
@@ -207,8 +777,15 @@ protected:
             MasterMeHistogramFifos* const fifos = histogramSharedData.connect(value);
             DISTRHO_SAFE_ASSERT_RETURN(fifos != nullptr,);
 
-            lufsInFifo.setFloatFifo(&fifos->lufsIn);
-            lufsOutFifo.setFloatFifo(&fifos->lufsOut);
+            // the UI side is the reader and owns the fifo data, it has cleared it already
+            lufsInFifo.setFloatFifo(&fifos->lufsIn, false);
+            lufsOutFifo.setFloatFifo(&fifos->lufsOut, false);
+
+            for (uint i=0; i<kTelemetryNumMeters; ++i)
+                hostMeterValues[i] = getCurrentParameterValue(kTelemetryFirstMeter + i);
+
+            hostMeterFrames = 0;
+            telemetryActive = fifos->telemetry.version == kTelemetryVersion;
            #endif
             histogramActive = true;
         }
@@ -227,28 +804,142 @@ protected:
     void activate() override
     {
         numFramesSoFar = 0;
+
+        // nothing was playing yet, no need to morph
+        const int requestedPreset = presetMorphRequest.exchange(-1, std::memory_order_acq_rel);
+        if (requestedPreset >= 0)
+            startPresetMorph(static_cast<uint32_t>(requestedPreset));
+        presetMorph.finish([this](const uint index, const float value) { applyPresetMorphValue(index, value); });
+
+        lufsInMeter.resetIntegrated();
+        lufsOutMeter.resetIntegrated();
+
+        updateBrickwallMode();
+        updateLevelerMode();
+       #if MASTER_ME_PIPELINE
+        // decided in run(), the worker priority is matched from the audio thread
+        stopPipeline();
+        pipelineHandover = false;
+        pipelineModeChanged = true;
+       #endif
+
+        silenceDetector.reset();
+        silenceIdle = false;
+
+        eqTiltGain.reset();
+        eqSideGain.reset();
+        FaustGeneratedPlugin::setParameterValue(kParameter_eq_tilt_gain, eqTiltGain.getValue());
+        FaustGeneratedPlugin::setParameterValue(kParameter_eq_side_gain, eqSideGain.getValue());
+
+        activated.store(true, std::memory_order_release);
+    }
+
+    void deactivate() override
+    {
+        activated.store(false, std::memory_order_release);
+
+       #if MASTER_ME_PIPELINE
+        // nothing may be left running in the worker once deactivated
+        finishPipelineFront();
+       #endif
+
+        // run() will not pick up a pending request anymore, have it done here
+        processWarmStateRequest();
     }
 
     void run(const float** const inputs, float** const outputs, const uint32_t frames) override
     {
         // optimize for non-denormal usage
         const ScopedDenormalDisable sdd;
-        for (uint32_t i = 0; i < frames; ++i)
+
+       #if MASTER_ME_PIPELINE
+        // the worker might still be on the front stage of the last block, which uses about everything below
+        finishPipelineFront();
+       #endif
+
+        if (brickwallModeChanged)
+            updateBrickwallMode();
+        if (levelerModeChanged)
+            updateLevelerMode();
+       #if MASTER_ME_PIPELINE
+        if (pipelineModeChanged)
+            updatePipelineMode();
+       #endif
+
+        // a preset loaded since the last block, see loadProgram
+        if (presetMorphRequest.load(std::memory_order_relaxed) >= 0)
+        {
+            const int requestedPreset = presetMorphRequest.exchange(-1, std::memory_order_acq_rel);
+            if (requestedPreset >= 0)
+                startPresetMorph(static_cast<uint32_t>(requestedPreset));
+        }
+
+        if (presetMorph.isActive())
+            presetMorph.process(frames, [this](const uint index, const float value) { applyPresetMorphValue(index, value); });
+
+        if (warmStateRequest.load(std::memory_order_acquire) != kWarmStateRequestNone)
+            processWarmStateRequest();
+
+        // a single pass over the input, for both silence detection and broken samples
+        const InputSanitizer::Scan scan = InputSanitizer::scan(inputs, kNumChannels, frames);
+        const float* dspInputs[kNumChannels];
+        std::memcpy(dspInputs, inputs, sizeof(dspInputs));
+
+        if (scan.broken)
+        {
+            // the cleaned up copy goes into the outputs, which processing can run in-place on
+            for (uint c = 0; c < kNumChannels; ++c)
+            {
+                badInputSamples += InputSanitizer::scrub(inputs[c], outputs[c], frames);
+                dspInputs[c] = outputs[c];
+            }
+        }
+
+        // skip all processing while the input stays silent, once everything has settled
+        const bool silentInput = silenceDetector.processPeak(scan.peak, frames);
+
+        if (silenceIdle && silentInput)
+        {
+            runIdle(outputs, frames);
+        }
+        else
+        {
+           #if MASTER_ME_PIPELINE
+            if (pipelineRunning)
+                runPipelined(dspInputs, outputs, frames);
+            else
+           #endif
+                runDsp(dspInputs, outputs, frames);
+
+            silenceIdle = silenceDetector.isSettled() && SilenceDetector::isSilent(outputs, kNumChannels, frames);
+        }
+
+       #if MASTER_ME_PIPELINE
+        // the worker is running the input meter, its values are taken once done, see finishPipelineFront
+        if (! pipelineFrontPending)
+       #endif
         {
-            if (!std::isfinite(inputs[0][i]))
-                __builtin_unreachable();
-            if (!std::isfinite(inputs[1][i]))
-                __builtin_unreachable();
-            if (!std::isfinite(outputs[0][i]))
-                __builtin_unreachable();
-            if (!std::isfinite(outputs[1][i]))
-                __builtin_unreachable();
+            lufsInValue = lufsInMeter.getShortTermLoudness();
+            lufsInIntegratedValue = lufsInMeter.getIntegratedLoudness();
         }
+        lufsOutValue = lufsOutMeter.getShortTermLoudness();
+        lufsOutIntegratedValue = lufsOutMeter.getIntegratedLoudness();
 
-        dsp->compute(frames, const_cast<float**>(inputs), outputs);
+       #if MASTER_ME_SHARED_MEMORY
+        if (telemetryActive)
+            updateTelemetry(frames);
+       #endif
+       #if MASTER_ME_TELEMETRY_EXPORT
+        if (telemetryExporter != nullptr)
+        {
+            float values[kTelemetryNumMeters];
+            getTelemetryMeters(values);
+            telemetryExporter->writeMeters(values, badInputSamples);
+        }
+       #endif
 
-        highestLufsInValue = std::max(highestLufsInValue, FaustGeneratedPlugin::getParameterValue(kParameter_lufs_in));
-        highestLufsOutValue = std::max(highestLufsOutValue, FaustGeneratedPlugin::getParameterValue(kParameter_lufs_out));
+        highestLufsInValue = std::max(highestLufsInValue, lufsInValue);
+        highestLufsOutValue = std::max(highestLufsOutValue, lufsOutValue);
 
         numFramesSoFar += frames;
 
@@ -256,6 +947,11 @@ protected:
         {
             numFramesSoFar -= bufferSizeForHistogram;
 
+           #if MASTER_ME_TELEMETRY_EXPORT
+            if (telemetryExporter != nullptr)
+                telemetryExporter->writeHistogram(highestLufsInValue, highestLufsOutValue);
+           #endif
+
            #ifndef __MOD_DEVICES__
             if (histogramActive)
            #endif
@@ -266,7 +962,7 @@ protected:
 
                 if (data->closed)
                 {
-                    histogramActive = false;
+                    histogramActive = telemetryActive = false;
                 }
                 else
                 {
@@ -295,10 +991,795 @@ protected:
     void bufferSizeChanged(const uint newBufferSize) override
     {
         bufferSizeForHistogram = std::max(kMinimumHistogramBufferSize, newBufferSize);
+
+       #if MASTER_ME_PIPELINE
+        // pipeline latency is one buffer
+        resizePipelineBuffers(newBufferSize);
+        pipelineModeChanged = true;
+       #endif
+    }
+
+    void sampleRateChanged(const double newSampleRate) override
+    {
+        FaustGeneratedPlugin::sampleRateChanged(newSampleRate);
+
+        lufsInMeter.setSampleRate(newSampleRate);
+        lufsOutMeter.setSampleRate(newSampleRate);
+        brickwallLimiter.setSampleRate(newSampleRate);
+        brickwallModeChanged = true;
+        lookaheadLeveler.setSampleRate(newSampleRate);
+        levelerModeChanged = true;
+
+        eqTiltGain.setSampleRate(newSampleRate, kControlRateFrames);
+        eqSideGain.setSampleRate(newSampleRate, kControlRateFrames);
+        silenceDetector.setSampleRate(newSampleRate);
+        silenceIdle = false;
+        presetMorph.setTime(newSampleRate, presetMorphTime);
+        checkMaxSampleRate(newSampleRate);
+
+       #if MASTER_ME_PROFILE
+        profiler.setSampleRate(newSampleRate);
+       #endif
+
+       #if MASTER_ME_PIPELINE
+        // same as the full dsp, see FaustGeneratedPlugin::sampleRateChanged
+        // parameters are copied over on each run, meters are only read from the full dsp
+        pipeline_front::mydsp* const newFront = createFaustDsp<pipeline_front::mydsp>(newSampleRate);
+        pipeline_back::mydsp* const newBack = createFaustDsp<pipeline_back::mydsp>(newSampleRate);
+        DISTRHO_SAFE_ASSERT_RETURN(newFront != nullptr && newBack != nullptr,);
+
+        pipelineFront.reset(newFront);
+        pipelineBack.reset(newBack);
+        pipelineModeChanged = true;
+       #endif
     }
 
     // ----------------------------------------------------------------------------------------------------------------
 
+private:
+    // the faust dsp still runs above MASTER_ME_MAX_SAMPLE_RATE, with its longest windows cut short
+    static void checkMaxSampleRate(const double sampleRate)
+    {
+        if (sampleRate > MASTER_ME_MAX_SAMPLE_RATE)
+            d_stderr("MasterMePlugin: sample rate %.0f is above the %d this build is sized for, "
+                     "loudness windows and leveler hold will be shorter than set", sampleRate, MASTER_ME_MAX_SAMPLE_RATE);
+    }
+
+    void runDsp(const float** const inputs, float** const outputs, const uint32_t frames)
+    {
+       #if MASTER_ME_PROFILE
+        profiler.begin();
+       #endif
+
+        // input meter goes first, as inputs and outputs might share the same buffers
+        lufsInMeter.setInputGain(std::pow(10.f, FaustGeneratedPlugin::getParameterValue(kParameter_in_gain) * 0.05f));
+        lufsInMeter.process(inputs, frames);
+        MASTER_ME_PROFILE_MARK(kProfileStageLufsIn);
+
+        // the lookahead leveler processes a copy of the input, which then goes through faust
+        const float** dspInputs = inputs;
+
+        if (levelerRunning)
+        {
+            for (uint c = 0; c < kNumChannels; ++c)
+            {
+                if (outputs[c] != inputs[c])
+                    std::memcpy(outputs[c], inputs[c], sizeof(float) * frames);
+            }
+
+            runLookaheadLeveler(outputs, frames);
+            MASTER_ME_PROFILE_MARK(kProfileStageLookaheadLeveler);
+
+            dspInputs = const_cast<const float**>(outputs);
+        }
+
+       #if MASTER_ME_PIPELINE
+        // the stages catching up run on the same input as the full dsp, in-place processing would overwrite it
+        if (pipelineHandover)
+        {
+            for (uint c = 0; c < kNumChannels; ++c)
+                std::memcpy(pipelineInputs[c].data(), dspInputs[c], sizeof(float) * frames);
+        }
+       #endif
+
+        computeFaust(dsp.get(), dspInputs, outputs, kNumChannels, kNumChannels, frames, eqTiltGain, eqSideGain);
+        MASTER_ME_PROFILE_MARK(kProfileStageDsp);
+
+       #if MASTER_ME_PIPELINE
+        if (pipelineHandover)
+        {
+            runPipelineStagesAlongside(frames);
+            MASTER_ME_PROFILE_MARK(kProfileStageDsp);
+        }
+       #endif
+
+        runOutputStages(outputs, frames);
+
+       #if MASTER_ME_PROFILE
+        profileReady |= profiler.finish(frames);
+       #endif
+    }
+
+   #if MASTER_ME_PIPELINE
+    // same as runDsp, with everything up to the eq delayed by one block and running in parallel in the worker
+    // the worker is not waited for here, it runs on into the next period and is only waited for at the start of the
+    // next run(), see finishPipelineFront, so it has about a full period instead of the time taken by the back stage
+    void runPipelined(const float** const inputs, float** const outputs, const uint32_t frames)
+    {
+        // the worker gets its own copy of the input, as inputs and outputs might share the same buffers
+        for (uint c = 0; c < kNumChannels; ++c)
+            std::memcpy(pipelineInputs[c].data(), inputs[c], sizeof(float) * frames);
+
+        copyFaustControls(dsp.get(), pipelineFront.get());
+
+        pipelineEqTiltGain = eqTiltGain;
+        pipelineEqSideGain = eqSideGain;
+        pipelineFrontFrames = frames;
+        pipelineFrontPending = true;
+        pipelineThread.start(pipelineFrontJob);
+
+       #if MASTER_ME_PROFILE
+        // lufs in meter, lookahead leveler and front stage are timed by the worker, see finishPipelineFront
+        profiler.begin();
+       #endif
+
+        // front stage output from earlier blocks, one buffer behind as prefilled in updatePipelineMode
+        float* backInputs[kNumChannels * 2];
+
+        for (uint c = 0; c < kNumChannels; ++c)
+        {
+            backInputs[c] = pipelineBackInputs[c].data();
+            backInputs[kNumChannels + c] = pipelineBackInputs[kNumChannels + c].data();
+
+            const uint32_t dryRead = pipelineDryFifos[c].readN(backInputs[c], frames);
+            const uint32_t wetRead = pipelineWetFifos[c].readN(backInputs[kNumChannels + c], frames);
+            DISTRHO_SAFE_ASSERT(dryRead == frames && wetRead == frames);
+        }
+
+        copyFaustControls(dsp.get(), pipelineBack.get());
+        pipelineBack->compute(frames, backInputs, outputs);
+        copyFaustMeters(pipelineBack.get(), dsp.get());
+        MASTER_ME_PROFILE_MARK(kProfileStageDsp);
+
+        runOutputStages(outputs, frames);
+
+       #if MASTER_ME_PROFILE
+        profileReady |= profiler.finish(frames);
+       #endif
+    }
+
+    // wait for the worker started in the last runPipelined, and take over what it has done
+    void finishPipelineFront()
+    {
+        if (! pipelineFrontPending)
+            return;
+
+        pipelineThread.wait();
+        pipelineFrontPending = false;
+
+       #if MASTER_ME_PROFILE
+        // goes with the block being started, one behind the block the worker ran for
+        profiler.add(pipelineFrontTimes);
+       #endif
+
+        const uint32_t frames = pipelineFrontFrames;
+
+        lufsInValue = lufsInMeter.getShortTermLoudness();
+        lufsInIntegratedValue = lufsInMeter.getIntegratedLoudness();
+
+        // the worker only stepped its own eq gain smoothers, keep a target set meanwhile, and the full dsp in sync
+        const float eqTiltTarget = eqTiltGain.getTarget();
+        const float eqSideTarget = eqSideGain.getTarget();
+        eqTiltGain = pipelineEqTiltGain;
+        eqSideGain = pipelineEqSideGain;
+        eqTiltGain.setTarget(eqTiltTarget);
+        eqSideGain.setTarget(eqSideTarget);
+        FaustGeneratedPlugin::setParameterValue(kParameter_eq_tilt_gain, eqTiltGain.getValue());
+        FaustGeneratedPlugin::setParameterValue(kParameter_eq_side_gain, eqSideGain.getValue());
+
+        // the full dsp catching up, on the input the worker has just run the lookahead leveler on
+        // its meters are replaced by those of the stages again, which are still the ones heard
+        if (pipelineHandover)
+        {
+            float* fullInputs[kNumChannels];
+            float* fullOutputs[kNumChannels];
+
+            for (uint c = 0; c < kNumChannels; ++c)
+            {
+                fullInputs[c] = pipelineInputs[c].data();
+                fullOutputs[c] = pipelineBackInputs[c].data();
+            }
+
+            dsp->compute(frames, fullInputs, fullOutputs);
+
+            const float fullGainDb = *getFaustParameterZone(dsp.get(), kParameter_leveler_gain);
+            copyFaustMeters(pipelineBack.get(), dsp.get());
+            copyFaustMeters(pipelineFront.get(), dsp.get());
+            updatePipelineHandover(fullGainDb, frames);
+            return;
+        }
+
+        copyFaustMeters(pipelineFront.get(), dsp.get());
+    }
+
+    // both stages one after the other in this thread, without the fifos in between, while catching up to the full dsp
+    void runPipelineStagesAlongside(const uint32_t frames)
+    {
+        float* inputs[kNumChannels];
+        float* frontOutputs[kNumChannels * 2];
+        float* backOutputs[kNumChannels];
+
+        for (uint c = 0; c < kNumChannels; ++c)
+            inputs[c] = pipelineInputs[c].data();
+        for (uint c = 0; c < kNumChannels * 2; ++c)
+            frontOutputs[c] = pipelineFrontOutputs[c].data();
+        for (uint c = 0; c < kNumChannels; ++c)
+            backOutputs[c] = pipelineBackInputs[c].data();
+
+        copyFaustControls(dsp.get(), pipelineFront.get());
+        pipelineFront->compute(frames, inputs, frontOutputs);
+        copyFaustControls(dsp.get(), pipelineBack.get());
+        pipelineBack->compute(frames, frontOutputs, backOutputs);
+
+        updatePipelineHandover(*getFaustParameterZone(dsp.get(), kParameter_leveler_gain), frames);
+    }
+
+    // switch over once the side catching up has settled, see kPipelineHandoverMinSeconds
+    void updatePipelineHandover(const float fullGainDb, const uint32_t frames)
+    {
+        const float stageGainDb = *getFaustParameterZone(pipelineBack.get(), kParameter_leveler_gain);
+        const double sampleRate = getSampleRate();
+
+        pipelineHandoverFrames += frames;
+
+        if (pipelineHandoverFrames < kPipelineHandoverMinSeconds * sampleRate)
+            return;
+        if (std::abs(fullGainDb - stageGainDb) > kPipelineHandoverMaxGainDifferenceDb &&
+            pipelineHandoverFrames < kPipelineHandoverMaxSeconds * sampleRate)
+            return;
+
+        pipelineHandover = false;
+
+        if (pipelineRunning)
+            stopPipeline();
+        else
+            startPipeline();
+    }
+
+    // worker side of runPipelined, runs the front stage on the input copy and queues its output
+    void runPipelineFront()
+    {
+        const ScopedDenormalDisable sdd;
+        const uint32_t frames = pipelineFrontFrames;
+
+       #if MASTER_ME_PROFILE
+        pipelineFrontTimes.begin();
+       #endif
+
+        float* inputs[kNumChannels];
+        float* frontOutputs[kNumChannels * 2];
+
+        for (uint c = 0; c < kNumChannels; ++c)
+            inputs[c] = pipelineInputs[c].data();
+        for (uint c = 0; c < kNumChannels * 2; ++c)
+            frontOutputs[c] = pipelineFrontOutputs[c].data();
+
+        lufsInMeter.setInputGain(std::pow(10.f, FaustGeneratedPlugin::getParameterValue(kParameter_in_gain) * 0.05f));
+        lufsInMeter.process(const_cast<const float**>(inputs), frames);
+        MASTER_ME_PROFILE_FRONT_MARK(kProfileStageLufsIn);
+
+        if (levelerRunning)
+        {
+            runLookaheadLeveler(inputs, frames);
+            MASTER_ME_PROFILE_FRONT_MARK(kProfileStageLookaheadLeveler);
+        }
+
+        computeFaust(pipelineFront.get(), const_cast<const float**>(inputs), frontOutputs,
+                     kNumChannels, kNumChannels * 2, frames, pipelineEqTiltGain, pipelineEqSideGain);
+        MASTER_ME_PROFILE_FRONT_MARK(kProfileStagePipelineFront);
+
+        for (uint c = 0; c < kNumChannels; ++c)
+        {
+            pipelineDryFifos[c].writeN(frontOutputs[c], frames);
+            pipelineWetFifos[c].writeN(frontOutputs[kNumChannels + c], frames);
+        }
+    }
+   #endif
+
+    // lookahead leveler, in-place, before faust
+    void runLookaheadLeveler(float** const buffers, const uint32_t frames)
+    {
+        lookaheadLeveler.setBypass(FaustGeneratedPlugin::getParameterValue(kParameter_global_bypass) > 0.5f ||
+                                   levelerBypass);
+        lookaheadLeveler.setInputGain(FaustGeneratedPlugin::getParameterValue(kParameter_in_gain));
+        lookaheadLeveler.setParameters(FaustGeneratedPlugin::getParameterValue(kParameter_target),
+                                       FaustGeneratedPlugin::getParameterValue(kParameter_leveler_speed),
+                                       FaustGeneratedPlugin::getParameterValue(kParameter_leveler_brake_threshold),
+                                       FaustGeneratedPlugin::getParameterValue(kParameter_leveler_max_plus),
+                                       FaustGeneratedPlugin::getParameterValue(kParameter_leveler_max_minus));
+        lookaheadLeveler.process(buffers[0], buffers[1], frames);
+    }
+
+    // run a faust dsp (the full one, or the front stage of the pipelined build), updating the smoothed eq gains
+    template <class FaustDsp>
+    void computeFaust(FaustDsp* const faustDsp, const float** const inputs, float** const outputs,
+                      const uint numInputs, const uint numOutputs, const uint32_t frames,
+                      ControlRateSmoother& tiltGain, ControlRateSmoother& sideGain)
+    {
+        if (tiltGain.isSmoothing() || sideGain.isSmoothing())
+        {
+            // run in small steps while smoothing, updating the faust parameters in between
+            for (uint32_t offset = 0; offset < frames; offset += kControlRateFrames)
+            {
+                const uint32_t stepFrames = std::min(kControlRateFrames, frames - offset);
+                const float* stepInputs[kNumChannels * 2];
+                float* stepOutputs[kNumChannels * 2];
+
+                for (uint c = 0; c < numInputs; ++c)
+                    stepInputs[c] = inputs[c] + offset;
+                for (uint c = 0; c < numOutputs; ++c)
+                    stepOutputs[c] = outputs[c] + offset;
+
+                *getFaustParameterZone(faustDsp, kParameter_eq_tilt_gain) = tiltGain.next();
+                *getFaustParameterZone(faustDsp, kParameter_eq_side_gain) = sideGain.next();
+
+                faustDsp->compute(stepFrames, const_cast<float**>(stepInputs), stepOutputs);
+            }
+        }
+        else
+        {
+            faustDsp->compute(frames, const_cast<float**>(inputs), outputs);
+        }
+    }
+
+    // everything after faust, the plugin side brickwall and the output meters
+    void runOutputStages(float** const outputs, const uint32_t frames)
+    {
+        if (brickwallRunning)
+        {
+            brickwallLimiter.setActive(FaustGeneratedPlugin::getParameterValue(kParameter_global_bypass) < 0.5f &&
+                                       ! brickwallBypass);
+            brickwallLimiter.setCeiling(FaustGeneratedPlugin::getParameterValue(kParameter_brickwall_ceiling));
+            brickwallLimiter.setRelease(FaustGeneratedPlugin::getParameterValue(kParameter_brickwall_release));
+            brickwallLimiter.process(outputs[0], outputs[1], frames);
+            MASTER_ME_PROFILE_MARK(kProfileStageBrickwall);
+        }
+
+        if (kHasStereoExtras && brickwallTruePeak)
+        {
+            float peak = 0.f;
+            for (uint32_t i = 0; i < frames; ++i)
+                peak = std::max(peak, truePeakOutDetector.process(outputs[0][i], outputs[1][i]));
+
+            // same falloff as peakmeter_out in master_me.dsp
+            truePeakOutValue = std::max(std::max(-70.f, 20.f * std::log10(std::max(1e-5f, peak))),
+                                        truePeakOutValue - static_cast<float>(80.0 * frames / getSampleRate()));
+            MASTER_ME_PROFILE_MARK(kProfileStageTruePeak);
+        }
+
+        lufsOutMeter.process(outputs, frames);
+        MASTER_ME_PROFILE_MARK(kProfileStageLufsOut);
+    }
+
+    // one step of a preset morph, see loadProgram
+    void applyPresetMorphValue(const uint index, const float value)
+    {
+        // the morph moves the eq gains in small steps already, skip their control rate smoothing,
+        // which would otherwise run faust in sub-blocks for the whole morph
+        if (index == kParameter_eq_tilt_gain || index == kParameter_eq_side_gain)
+        {
+            ControlRateSmoother& smoother(index == kParameter_eq_tilt_gain ? eqTiltGain : eqSideGain);
+            smoother.setTarget(value);
+            smoother.reset();
+            FaustGeneratedPlugin::setParameterValue(index, value);
+            return;
+        }
+
+        applyParameterValue(index, value);
+    }
+
+    // meters and dsp state are kept as they were, already settled, until signal comes back
+    void runIdle(float** const outputs, const uint32_t frames)
+    {
+        for (uint c = 0; c < kNumChannels; ++c)
+            std::memset(outputs[c], 0, sizeof(float) * frames);
+
+        // nothing to hear, jump directly to the new values
+        if (eqTiltGain.isSmoothing() || eqSideGain.isSmoothing())
+        {
+            eqTiltGain.reset();
+            eqSideGain.reset();
+            FaustGeneratedPlugin::setParameterValue(kParameter_eq_tilt_gain, eqTiltGain.getValue());
+            FaustGeneratedPlugin::setParameterValue(kParameter_eq_side_gain, eqSideGain.getValue());
+        }
+    }
+
+   #if MASTER_ME_SHARED_MEMORY
+    void getTelemetryMeters(float* const values) const noexcept
+    {
+        for (uint i=0; i<kTelemetryNumMeters; ++i)
+            values[i] = getCurrentParameterValue(kTelemetryFirstMeter + i);
+    }
+
+    // write all meters for the UI, once per block
+    void updateTelemetry(const uint32_t frames)
+    {
+        MasterMeHistogramFifos* const data = histogramSharedData.getDataPointer();
+        DISTRHO_SAFE_ASSERT_RETURN(data != nullptr,);
+
+        if (data->closed)
+        {
+            histogramActive = telemetryActive = false;
+            return;
+        }
+
+        float values[kTelemetryNumMeters];
+        getTelemetryMeters(values);
+
+        data->telemetry.meters.write(values);
+        data->telemetry.badInputSamples.store(badInputSamples, std::memory_order_relaxed);
+
+       #if MASTER_ME_PROFILE
+        if (profileReady)
+        {
+            profileReady = false;
+            data->telemetry.profile.write(profiler.getResults());
+        }
+       #endif
+
+        if ((hostMeterFrames += frames) >= static_cast<uint32_t>(kHostMeterUpdateSeconds * getSampleRate()))
+        {
+            hostMeterFrames = 0;
+            std::memcpy(hostMeterValues, values, sizeof(values));
+        }
+    }
+   #endif
+
+    void updateBrickwallMode()
+    {
+        brickwallModeChanged = false;
+        brickwallRunning = kHasStereoExtras && (brickwallTruePeak || brickwallLookahead);
+
+        brickwallLimiter.setMode(brickwallTruePeak, brickwallLookahead ? brickwallLookaheadTime : 0.f);
+        truePeakOutDetector.reset();
+        truePeakOutValue = -70.f;
+
+        FaustGeneratedPlugin::setParameterValue(kParameter_brickwall_bypass,
+                                                brickwallRunning || brickwallBypass ? 1.f : 0.f);
+
+        updateLatency();
+    }
+
+    void updateLevelerMode()
+    {
+        levelerModeChanged = false;
+        levelerRunning = kHasStereoExtras && levelerLookahead;
+
+        lookaheadLeveler.setLookahead(levelerLookahead ? levelerLookaheadTime : 0.f);
+
+        FaustGeneratedPlugin::setParameterValue(kParameter_leveler_bypass,
+                                                levelerRunning || levelerBypass ? 1.f : 0.f);
+
+        updateLatency();
+    }
+
+   #if MASTER_ME_PIPELINE
+    // audio thread only, as the worker priority is matched from here
+    void updatePipelineMode()
+    {
+        pipelineModeChanged = false;
+
+        // one buffer of latency between the stages, which together with the next block must fit in the fifos
+        // the audio thread waits for the worker, which is not used without the same real-time priority
+        const bool wanted = pipelined
+                         && getBufferSize() * 2 <= kPipelineFifoSize
+                         && pipelineThread.matchCallerPriority();
+
+        if (wanted != pipelineRunning)
+        {
+            // the other side runs alongside first, see updatePipelineHandover
+            if (! pipelineHandover)
+            {
+                pipelineHandover = true;
+                pipelineHandoverFrames = 0;
+            }
+            return;
+        }
+
+        // switched back before the handover was done
+        pipelineHandover = false;
+
+        // the buffer size might have changed
+        if (pipelineRunning)
+            startPipeline();
+    }
+
+    void startPipeline()
+    {
+        const uint32_t bufferSize = getBufferSize();
+        pipelineRunning = true;
+        pipelineLatency = bufferSize;
+
+        float* const silence = pipelineBackInputs[0].data();
+        std::memset(silence, 0, sizeof(float) * bufferSize);
+
+        for (uint c = 0; c < kNumChannels; ++c)
+        {
+            pipelineDryFifos[c].clearData();
+            pipelineWetFifos[c].clearData();
+            pipelineDryFifos[c].writeN(silence, bufferSize);
+            pipelineWetFifos[c].writeN(silence, bufferSize);
+        }
+
+        updateLatency();
+    }
+
+    void stopPipeline()
+    {
+        pipelineRunning = false;
+        pipelineLatency = 0;
+        updateLatency();
+    }
+
+    void resizePipelineBuffers(const uint bufferSize)
+    {
+        for (std::vector<float>& buffer : pipelineInputs)
+            buffer.resize(bufferSize);
+        for (std::vector<float>& buffer : pipelineFrontOutputs)
+            buffer.resize(bufferSize);
+        for (std::vector<float>& buffer : pipelineBackInputs)
+            buffer.resize(bufferSize);
+    }
+   #endif
+
+    void updateLatency()
+    {
+       #if MASTER_ME_PIPELINE
+        const uint32_t latency = (brickwallRunning ? brickwallLimiter.getLatency() : 0)
+                               + (levelerRunning ? lookaheadLeveler.getLatency() : 0)
+                               + pipelineLatency;
+       #else
+        const uint32_t latency = (brickwallRunning ? brickwallLimiter.getLatency() : 0)
+                               + (levelerRunning ? lookaheadLeveler.getLatency() : 0);
+       #endif
+
+        setLatency(latency);
+        silenceDetector.setLatency(latency);
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+
+    // returns the last completed snapshot and asks for the next one, without waiting for the audio thread
+    // while not active the copy is done right away, so the snapshot returned is always the current one then
+    String getWarmState() const
+    {
+        if (! warmStateCapturePending)
+        {
+            resizeWarmStateBuffers();
+
+            int expected = kWarmStateRequestNone;
+            if (warmStateRequest.compare_exchange_strong(expected, kWarmStateRequestCapture))
+            {
+                warmStateCapturePending = true;
+
+                if (! activated.load(std::memory_order_acquire))
+                    const_cast<MasterMePlugin*>(this)->processWarmStateRequest();
+            }
+        }
+
+        if (warmStateCapturePending && warmStateRequest.load(std::memory_order_acquire) == kWarmStateRequestNone)
+        {
+            warmStateCapturePending = false;
+            encodeWarmState();
+        }
+
+        return warmStateLastCapture;
+    }
+
+    void encodeWarmState() const
+    {
+        WarmStateWriter writer(kNumChannels, getSampleRate());
+        writer.addSection(kWarmStateSectionDsp, warmStateDsp.data(), warmStateDsp.size());
+        writer.addSection(kWarmStateSectionLufsIn, &warmStateLufsIn, sizeof(warmStateLufsIn));
+        writer.addSection(kWarmStateSectionLufsOut, &warmStateLufsOut, sizeof(warmStateLufsOut));
+        writer.addSection(kWarmStateSectionLeveler, &warmStateLevelerGain, sizeof(warmStateLevelerGain));
+       #if MASTER_ME_PIPELINE
+        writer.addSection(kWarmStateSectionPipelineFront, warmStatePipelineFront.data(), warmStatePipelineFront.size());
+        writer.addSection(kWarmStateSectionPipelineBack, warmStatePipelineBack.data(), warmStatePipelineBack.size());
+       #endif
+
+        const std::vector<uint8_t>& data(writer.getData());
+        warmStateLastCapture = String::asBase64(data.data(), data.size());
+    }
+
+    void setWarmState(const char* const value)
+    {
+        // nothing saved, as with the default value
+        if (value[0] == '\0')
+            return;
+
+        const std::vector<uint8_t> data(d_getChunkFromBase64String(value));
+
+        // the dsp state is decoded into new instances here, so their memory is written outside the audio thread
+        // everything is only applied if all of it is valid
+        WarmStateReader reader;
+        bool valid = reader.open(data.data(), data.size(), kNumChannels, getSampleRate());
+        if (valid)
+        {
+            warmStateStandbyDsp.reset(readFaustState<mydsp>(reader, kWarmStateSectionDsp));
+            valid = warmStateStandbyDsp != nullptr;
+        }
+        valid = valid
+             && reader.readSection(kWarmStateSectionLufsIn, &warmStateStandbyLufsIn, sizeof(warmStateStandbyLufsIn))
+             && reader.readSection(kWarmStateSectionLufsOut, &warmStateStandbyLufsOut, sizeof(warmStateStandbyLufsOut))
+             && reader.readSection(kWarmStateSectionLeveler, &warmStateStandbyLevelerGain, sizeof(warmStateStandbyLevelerGain));
+       #if MASTER_ME_PIPELINE
+        if (valid)
+        {
+            warmStateStandbyPipelineFront.reset(readFaustState<pipeline_front::mydsp>(reader, kWarmStateSectionPipelineFront));
+            valid = warmStateStandbyPipelineFront != nullptr;
+        }
+        if (valid)
+        {
+            warmStateStandbyPipelineBack.reset(readFaustState<pipeline_back::mydsp>(reader, kWarmStateSectionPipelineBack));
+            valid = warmStateStandbyPipelineBack != nullptr;
+        }
+       #endif
+        valid = valid && reader.isAtEnd();
+
+        if (! valid)
+            d_stderr("MasterMePlugin::setWarmState: ignoring state from a different build, channel count or sample rate");
+        else if (! runWarmStateRequest(kWarmStateRequestRestore))
+            d_stderr("MasterMePlugin::setWarmState: timed out waiting for the audio thread");
+
+        // the instances swapped out by the audio thread, or the unused new ones
+        warmStateStandbyDsp.reset();
+       #if MASTER_ME_PIPELINE
+        warmStateStandbyPipelineFront.reset();
+        warmStateStandbyPipelineBack.reset();
+       #endif
+    }
+
+    // new faust dsp instance with its state decoded from the next section, or null if invalid
+    // the instance starts as zero pages, only the non-zero parts of the state are written to it
+    // this is only valid because nothing has run on the instance yet, see createFaustDsp
+    template <class DSP>
+    DSP* readFaustState(WarmStateReader& reader, const uint32_t tag) const
+    {
+        DSP* const faustDsp = createFaustDsp<DSP>(getSampleRate());
+        DISTRHO_SAFE_ASSERT_RETURN(faustDsp != nullptr, nullptr);
+
+        if (reader.readSection(tag,
+                               reinterpret_cast<uint8_t*>(faustDsp) + sizeof(DISTRHO::dsp),
+                               sizeof(DSP) - sizeof(DISTRHO::dsp),
+                               true))
+            return faustDsp;
+
+        destroyFaustDsp(faustDsp);
+        return nullptr;
+    }
+
+    void resizeWarmStateBuffers() const
+    {
+        warmStateDsp.resize(sizeof(mydsp) - sizeof(DISTRHO::dsp));
+       #if MASTER_ME_PIPELINE
+        warmStatePipelineFront.resize(sizeof(pipeline_front::mydsp) - sizeof(DISTRHO::dsp));
+        warmStatePipelineBack.resize(sizeof(pipeline_back::mydsp) - sizeof(DISTRHO::dsp));
+       #endif
+    }
+
+    // have a warm state restore done by the audio thread while active, or directly otherwise
+    // a capture still pending from getWarmState has to complete first, it is kept for the next getWarmState call
+    bool runWarmStateRequest(const int request) const
+    {
+        if (! activated.load(std::memory_order_acquire))
+            const_cast<MasterMePlugin*>(this)->processWarmStateRequest();
+
+        uint i = 0;
+
+        for (int expected = kWarmStateRequestNone;
+             ! warmStateRequest.compare_exchange_strong(expected, request);
+             expected = kWarmStateRequestNone)
+        {
+            if (++i == kWarmStateTimeoutMs)
+                return false;
+
+            d_msleep(1);
+        }
+
+        if (warmStateCapturePending)
+        {
+            warmStateCapturePending = false;
+            encodeWarmState();
+        }
+
+        if (! activated.load(std::memory_order_acquire))
+        {
+            const_cast<MasterMePlugin*>(this)->processWarmStateRequest();
+            return true;
+        }
+
+        for (; i < kWarmStateTimeoutMs; ++i)
+        {
+            if (warmStateRequest.load(std::memory_order_acquire) == kWarmStateRequestNone)
+                return true;
+
+            d_msleep(1);
+        }
+
+        // take the request back, unless the audio thread has just picked it up
+        int expected = request;
+        if (warmStateRequest.compare_exchange_strong(expected, kWarmStateRequestNone))
+            return false;
+
+        while (warmStateRequest.load(std::memory_order_acquire) != kWarmStateRequestNone)
+            d_msleep(1);
+
+        return true;
+    }
+
+    void processWarmStateRequest() noexcept
+    {
+        int request = warmStateRequest.load(std::memory_order_acquire);
+
+        if (request == kWarmStateRequestNone || ! warmStateRequest.compare_exchange_strong(request, kWarmStateRequestBusy))
+            return;
+
+        if (request == kWarmStateRequestCapture)
+            captureWarmState();
+        else
+            restoreWarmState();
+
+        warmStateRequest.store(kWarmStateRequestNone, std::memory_order_release);
+    }
+
+    // the faust dsp has no pointers, it is copied whole except for the vtable pointer of its base class
+    // the meters give their runtime state as plain data
+    static_assert(std::is_trivially_copyable<R128LoudnessMeterBase<kNumChannels>::State>::value,
+                  "loudness meter state copied as bytes");
+
+    static void copyFaustState(std::vector<uint8_t>& buffer, const DISTRHO::dsp* const faustDsp) noexcept
+    {
+        std::memcpy(buffer.data(), reinterpret_cast<const uint8_t*>(faustDsp) + sizeof(DISTRHO::dsp), buffer.size());
+    }
+
+    void captureWarmState() const noexcept
+    {
+        copyFaustState(warmStateDsp, dsp.get());
+       #if MASTER_ME_PIPELINE
+        copyFaustState(warmStatePipelineFront, pipelineFront.get());
+        copyFaustState(warmStatePipelineBack, pipelineBack.get());
+       #endif
+        lufsInMeter.saveState(warmStateLufsIn);
+        lufsOutMeter.saveState(warmStateLufsOut);
+        warmStateLevelerGain = lookaheadLeveler.getGain();
+    }
+
+    // swaps in the standby instances from setWarmState, which takes care of freeing the old ones
+    void restoreWarmState() noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(warmStateStandbyDsp != nullptr,);
+
+        // parameters come from the host, only the runtime state of the dsp is taken from the snapshot
+        // the pipeline stages get theirs from the full dsp on every block
+        for (uint32_t i = 0; i < kParameter_peakmeter_in_l; ++i)
+            *getFaustParameterZone(warmStateStandbyDsp.get(), i) = *getFaustParameterZone(dsp.get(), i);
+
+        dsp.swap(warmStateStandbyDsp);
+       #if MASTER_ME_PIPELINE
+        pipelineFront.swap(warmStateStandbyPipelineFront);
+        pipelineBack.swap(warmStateStandbyPipelineBack);
+       #endif
+
+        lufsInMeter.restoreState(warmStateStandbyLufsIn);
+        lufsOutMeter.restoreState(warmStateStandbyLufsOut);
+        lookaheadLeveler.setGain(warmStateStandbyLevelerGain);
+
+        // the restored state is not silent, the dsp needs to run again
+        silenceDetector.reset();
+        silenceIdle = false;
+    }
+
     DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MasterMePlugin)
 };
 
@@ -6,14 +6,18 @@
 #include "Quantum.hpp"
 #include "MasterMeWidgetGroups.hpp"
 #include "extra/ScopedPointer.hpp"
+#include "extra/Time.hpp"
 #include "widgets/DoubleClickHelper.hpp"
 #include "widgets/Histogram.hpp"
 #include "widgets/InspectorWindow.hpp"
 
+#include "dsp/BrickwallLimiter.hpp"
+
 #include "BuildInfo1.hpp"
 #include "BuildInfo2.hpp"
 #include "Logo.hpp"
 
+#include <cstdlib>
 #include <functional>
 
 #include "utils/SharedMemory.hpp"
@@ -28,6 +32,13 @@ static_assert(kParameterRanges[kParameter_target].max == -2.f, "lufs target -2 d
 static_assert(kParameterRanges[kParameter_leveler_gain].min == -50.f, "leveler gain -50 dB min");
 static_assert(kParameterRanges[kParameter_leveler_gain].max == +50.f, "leveler gain +50 dB max");
 
+// meters are the last parameters, see flushMeterValues()
+static constexpr const uint kFirstMeter = kParameter_peakmeter_in_l;
+static constexpr const uint kNumMeters = kParameterCount - kFirstMeter;
+
+// smallest meter change worth a redraw, as fraction of its range, below a pixel for the tallest meters
+static constexpr const float kMeterRedrawResolution = 0.002f;
+
 // -----------------------------------------------------------------------------------------------------------
 
 // our custom metrics, making vertical sliders have less height
@@ -317,6 +328,10 @@ class MasterMeNameWidget : public NanoSubWidget
     QuantumThemeCallback* const callback;
     NanoImage image, image2x;
     ScopedPointer<InspectorWindow> inspectorWindow;
+    const char* const* profileNames = nullptr;
+    const float* profileValues = nullptr;
+    uint numProfileStages = 0;
+    const uint32_t* badInputSamples = nullptr;
 
 public:
     explicit MasterMeNameWidget(NanoTopLevelWidget* const parent, QuantumThemeCallback* const cb, QuantumTheme& t)
@@ -330,6 +345,26 @@ public:
         image2x = createImageFromMemory(Logo::master_me_white_2xData, Logo::master_me_white_2xDataSize, 0);
     }
 
+    // profiling results to show in the inspector, see MASTER_ME_PROFILE
+    void setProfile(const char* const* const names, const float* const values, const uint numStages)
+    {
+        profileNames = names;
+        profileValues = values;
+        numProfileStages = numStages;
+    }
+
+    // broken input samples count to show in the inspector, from telemetry
+    void setBadInputSamples(const uint32_t* const count)
+    {
+        badInputSamples = count;
+    }
+
+    void inspectorValuesChanged()
+    {
+        if (inspectorWindow != nullptr && inspectorWindow->isOpen)
+            inspectorWindow->repaint();
+    }
+
     void adjustSize()
     {
         const double scaleFactor = getTopLevelWidget()->getScaleFactor();
@@ -354,7 +389,11 @@ protected:
         if (ev.button == 1 && ev.press && contains(ev.pos))
         {
             if (inspectorWindow == nullptr)
+            {
                 inspectorWindow = new InspectorWindow(getTopLevelWidget(), theme, callback);
+                inspectorWindow->setProfile(profileNames, profileValues, numProfileStages);
+                inspectorWindow->setBadInputSamples(badInputSamples);
+            }
 
             inspectorWindow->isOpen = true;
         }
@@ -369,6 +408,7 @@ class MasterMeUI : public UI,
                    public ButtonEventHandler::Callback,
                    public KnobEventHandler::Callback,
                    public DoubleClickHelper::Callback,
+                   public Histogram::Callback,
                    public QuantumThemeCallback
 {
     QuantumTheme theme;
@@ -395,6 +435,14 @@ class MasterMeUI : public UI,
     // little helper for text input on double click
     ScopedPointer<DoubleClickHelper> doubleClickHelper;
 
+    // redraw scheduling, meter values and histogram changes are applied once per frame, see uiIdle
+    float meterValues[kNumMeters];
+    float meterValuesShown[kNumMeters];
+    bool meterValuesChanged = false;
+    bool histogramChanged = false;
+    uint32_t frameInterval = 1000 / MASTER_ME_UI_MAX_FPS;
+    uint32_t lastFrameTime = 0;
+
     // histogram stuff
     bool firstIdle = true;
     Histogram histogram;
@@ -402,6 +450,14 @@ class MasterMeUI : public UI,
     MasterMeFifoControl lufsInFifo;
     MasterMeFifoControl lufsOutFifo;
     SharedMemory<MasterMeHistogramFifos> histogramSharedData;
+    // meters, read directly from shared memory instead of through output parameters
+    bool telemetryActive = false;
+    uint32_t telemetrySequence = 0;
+    uint32_t badInputSamples = 0;
+   #if MASTER_ME_PROFILE
+    float profileValues[kProfileStageCount * 2] = {};
+    uint32_t profileSequence = 0;
+   #endif
    #else
     float histogramValueIn = -70.f;
     float histogramValueOut = -70.f;
@@ -1003,13 +1059,21 @@ class MasterMeUI : public UI,
     struct Brickwall : MasterMeParameterGroupWithBypassSwitch {
         QuantumValueSliderWithLabel ceiling;
         QuantumValueSliderWithLabel release;
+        QuantumSingleSwitch truePeak;
+        QuantumSingleSwitch lookahead;
+        QuantumValueSliderWithLabel lookaheadTime;
         QuantumValueMeterWithLabel limit;
+        QuantumValueMeterWithLabel truePeakOut;
 
         explicit Brickwall(NanoTopLevelWidget* const parent, ButtonEventHandler::Callback* const bcb, KnobEventHandler::Callback* const cb, const QuantumTheme& theme)
             : MasterMeParameterGroupWithBypassSwitch(parent, theme),
               ceiling(&frame, theme),
               release(&frame, theme),
-              limit(&frame, theme)
+              truePeak(&frame, theme),
+              lookahead(&frame, theme),
+              lookaheadTime(&frame, theme),
+              limit(&frame, theme),
+              truePeakOut(&frame, theme)
         {
             frame.setName("Brickwall");
             frame.mainWidget.setCallback(bcb);
@@ -1018,14 +1082,24 @@ class MasterMeUI : public UI,
 
             setupSlider(ceiling, cb, kParameter_brickwall_ceiling, 10);
             setupSlider(release, cb, kParameter_brickwall_release, 10);
+            // not faust parameters, same names and ranges as in the plugin side
+            setupSwitch(truePeak, bcb, kParameterCount + kExtraParameterBrickwallTruePeak, "brickwall true peak", 10, false);
+            setupSwitch(lookahead, bcb, kParameterCount + kExtraParameterBrickwallLookahead, "brickwall lookahead", 10, false);
+            setupSlider(lookaheadTime, cb, kParameterCount + kExtraParameterBrickwallLookaheadTime, "brickwall lookahead time", 10,
+                        "ms", BrickwallLimiter::kDefaultLookaheadMs, BrickwallLimiter::kMinLookaheadMs, BrickwallLimiter::kMaxLookaheadMs);
             setupMeter(limit, kParameter_brickwall_limit, 0);
+            setupMeter(truePeakOut, kParameterCount + kExtraParameterTruePeakOut, "out true peak", 0, "dB", -70.f, -70.f, 0.f);
         }
 
         void adjustSize(const QuantumMetrics& metrics) override
         {
             ceiling.adjustSize(metrics);
             release.adjustSize(metrics);
+            truePeak.adjustSize();
+            lookahead.adjustSize();
+            lookaheadTime.adjustSize(metrics);
             limit.adjustSize(metrics);
+            truePeakOut.adjustSize(metrics);
             MasterMeParameterGroupWithBypassSwitch::adjustSize(metrics);
         }
 
@@ -1036,8 +1110,12 @@ class MasterMeUI : public UI,
             ceiling.slider.setTextColor(color);
             release.label.setLabelColor(color);
             release.slider.setTextColor(color);
+            lookaheadTime.label.setLabelColor(color);
+            lookaheadTime.slider.setTextColor(color);
             limit.label.setLabelColor(color);
             limit.meter.setTextColor(color);
+            truePeakOut.label.setLabelColor(color);
+            truePeakOut.meter.setTextColor(color);
         }
     } brickwall;
 
@@ -1229,10 +1307,28 @@ public:
       // load initial state, easy mode is default
       easyModeButton.setChecked(true, false);
 
+      histogram.setCallback(this);
       histogram.setup(kMinimumHistogramBufferSize, getSampleRate());
 
+     #if MASTER_ME_SHARED_MEMORY
+      name.setBadInputSamples(&badInputSamples);
+     #endif
+     #if MASTER_ME_PROFILE
+      name.setProfile(kProfileStageNames, profileValues, kProfileStageCount);
+     #endif
+
       for (NanoSubWidget* w : parameterGroups)
           w->hide();
+
+      for (uint i=0; i<kNumMeters; ++i)
+          meterValues[i] = meterValuesShown[i] = kParameterRanges[kFirstMeter + i].def;
+
+      if (const char* const fps = std::getenv("MASTER_ME_UI_FPS"))
+      {
+          const int value = std::atoi(fps);
+          if (value > 0 && value < MASTER_ME_UI_MAX_FPS)
+              frameInterval = 1000 / value;
+      }
     }
 
     ~MasterMeUI() override
@@ -1342,6 +1438,30 @@ protected:
      * DSP/Plugin Callbacks */
 
     void parameterChanged(const uint32_t index, const float value) override
+    {
+       #if MASTER_ME_SHARED_MEMORY
+        // meters come from telemetry once the plugin side has written to it, see uiIdle
+        if (telemetrySequence != 0 && index >= kTelemetryFirstMeter && index < kParameterCount)
+            return;
+       #endif
+
+        updateParameterValue(index, value);
+    }
+
+    void updateParameterValue(const uint32_t index, const float value)
+    {
+        // meters change all the time, only the last value before each frame gets drawn
+        if (index >= kFirstMeter && index < kParameterCount)
+        {
+            meterValues[index - kFirstMeter] = value;
+            meterValuesChanged = true;
+            return;
+        }
+
+        applyParameterValue(index, value);
+    }
+
+    void applyParameterValue(const uint32_t index, const float value)
     {
         if (index >= kParameterCount)
         {
@@ -1350,13 +1470,25 @@ protected:
             case kExtraParameterHistogramBufferSize:
                 histogram.setup(value, getSampleRate());
                 break;
+            case kExtraParameterBrickwallTruePeak:
+                brickwall.truePeak.smallSwitch.setChecked(value > 0.5f, false);
+                break;
+            case kExtraParameterBrickwallLookahead:
+                brickwall.lookahead.smallSwitch.setChecked(value > 0.5f, false);
+                break;
+            case kExtraParameterBrickwallLookaheadTime:
+                brickwall.lookaheadTime.slider.setValue(value, false);
+                break;
+            case kExtraParameterTruePeakOut:
+                brickwall.truePeakOut.meter.setValue(value);
+                break;
            #if ! MASTER_ME_SHARED_MEMORY
             case kExtraParameterHistogramValueIn:
                 if (d_isNotEqual(histogramValueIn, value))
                 {
                     histogramValueIn = value;
                     histogram.tick(false, value);
-                    repaint();
+                    histogramChanged = true;
                 }
                 break;
             case kExtraParameterHistogramValueOut:
@@ -1364,7 +1496,7 @@ protected:
                 {
                     histogramValueOut = value;
                     histogram.tick(true, value);
-                    repaint();
+                    histogramChanged = true;
                 }
                 break;
            #endif
@@ -1679,6 +1811,20 @@ protected:
             const bool expert = std::strcmp(value, "expert") == 0;
             buttonClicked(expert ? &expertModeButton : &easyModeButton, 0);
         }
+        else if (std::strcmp(key, "histogram_timeline") == 0)
+        {
+            const uint seconds = std::atoi(value);
+
+            for (uint i = 0; i < kNumHistogramTimelines; ++i)
+            {
+                if (kHistogramTimelines[i] == seconds)
+                {
+                    histogram.setTimeline(seconds);
+                    histogramChanged = true;
+                    break;
+                }
+            }
+        }
     }
 
     void sampleRateChanged(const double newSampleRate) override
@@ -1751,6 +1897,8 @@ protected:
                 MasterMeHistogramFifos* const fifos = histogramSharedData.getDataPointer();
                 lufsInFifo.setFloatFifo(&fifos->lufsIn, true);
                 lufsOutFifo.setFloatFifo(&fifos->lufsOut, true);
+                fifos->telemetry.version = kTelemetryVersion;
+                telemetryActive = true;
 
                 setState("histogram", histogramSharedData.getDataFilename());
             }
@@ -1761,22 +1909,58 @@ protected:
        #if MASTER_ME_SHARED_MEMORY
         else
         {
-            bool shouldRepaint = false;
+            float values[MASTER_ME_FIFO_SIZE];
 
-            for (int i=0; i<1000 && lufsInFifo.canRead(); ++i)
+            if (const uint32_t numValues = lufsInFifo.readN(values, MASTER_ME_FIFO_SIZE))
             {
-                histogram.tick(false, lufsInFifo.read());
-                shouldRepaint = true;
+                for (uint32_t i=0; i<numValues; ++i)
+                    histogram.tick(false, values[i]);
+                histogramChanged = true;
             }
 
-            for (int i=0; i<1000 && lufsOutFifo.canRead(); ++i)
+            if (const uint32_t numValues = lufsOutFifo.readN(values, MASTER_ME_FIFO_SIZE))
             {
-                histogram.tick(true, lufsOutFifo.read());
-                shouldRepaint = true;
+                for (uint32_t i=0; i<numValues; ++i)
+                    histogram.tick(true, values[i]);
+                histogramChanged = true;
             }
 
-            if (shouldRepaint)
-                repaint();
+            if (telemetryActive)
+            {
+                MasterMeHistogramFifos* const data = histogramSharedData.getDataPointer();
+                float meters[kTelemetryNumMeters];
+
+                // 0 means nothing written yet, or no consistent read
+                const uint32_t sequence = data->telemetry.meters.read(meters);
+
+                if (sequence != 0 && sequence != telemetrySequence)
+                {
+                    telemetrySequence = sequence;
+
+                    for (uint i=0; i<kTelemetryNumMeters; ++i)
+                        updateParameterValue(kTelemetryFirstMeter + i, meters[i]);
+                }
+
+                const uint32_t newBadInputSamples = data->telemetry.badInputSamples.load(std::memory_order_relaxed);
+
+                if (newBadInputSamples != badInputSamples)
+                {
+                    badInputSamples = newBadInputSamples;
+                    name.inspectorValuesChanged();
+                }
+
+               #if MASTER_ME_PROFILE
+                float profile[kProfileStageCount * 2];
+                const uint32_t profileSeq = data->telemetry.profile.read(profile);
+
+                if (profileSeq != 0 && profileSeq != profileSequence)
+                {
+                    profileSequence = profileSeq;
+                    std::memcpy(profileValues, profile, sizeof(profile));
+                    name.inspectorValuesChanged();
+                }
+               #endif
+            }
         }
        #endif
 
@@ -1787,7 +1971,7 @@ protected:
             const int maxX = std::max(leveler.threshold.label.getAbsoluteX() + leveler.threshold.label.getWidth(),
                                       limiter.gainReduction.label.getAbsoluteX() + limiter.gainReduction.label.getWidth());
             const int maxY = std::max(msCompressor.outputGain.label.getAbsoluteY() + msCompressor.outputGain.label.getHeight(),
-                                      brickwall.limit.label.getAbsoluteY() + brickwall.limit.label.getHeight());
+                                      brickwall.truePeakOut.label.getAbsoluteY() + brickwall.truePeakOut.label.getHeight());
 
             const uint nextWidth = theme.borderSize * 3 + theme.padding * 7 + maxX + outputGroup.getWidth();
             const uint nextHeight = theme.borderSize * 3 + theme.padding * 7 + maxY;
@@ -1796,6 +1980,44 @@ protected:
             resizeOnNextIdle = false;
             // d_stdout("master_me new size is %u %u", nextWidth, nextHeight);
         }
+
+        // at most one frame per interval, and none while the window is not shown
+        const uint32_t time = d_gettime_ms();
+
+        if (time - lastFrameTime >= frameInterval && getWindow().isVisible())
+        {
+            lastFrameTime = time;
+            flushMeterValues();
+
+            if (histogramChanged)
+            {
+                histogramChanged = false;
+
+                if (histogram.isVisible())
+                    histogram.repaint();
+            }
+        }
+    }
+
+    // apply meter values that moved enough to be seen, each meter widget then redraws only its own area
+    void flushMeterValues()
+    {
+        if (! meterValuesChanged)
+            return;
+
+        meterValuesChanged = false;
+
+        for (uint i=0; i<kNumMeters; ++i)
+        {
+            const auto& ranges(kParameterRanges[kFirstMeter + i]);
+            const float threshold = (ranges.max - ranges.min) * kMeterRedrawResolution;
+
+            if (std::abs(meterValues[i] - meterValuesShown[i]) < threshold)
+                continue;
+
+            meterValuesShown[i] = meterValues[i];
+            applyParameterValue(kFirstMeter + i, meterValues[i]);
+        }
     }
 
     /* --------------------------------------------------------------------------------------------------------
@@ -1833,13 +2055,16 @@ protected:
             case kParameter_phase_r:
             case kParameter_dc_blocker:
             case kParameter_stereo_correct:
+            case kParameterCount + kExtraParameterBrickwallTruePeak:
+            case kParameterCount + kExtraParameterBrickwallLookahead:
                 value = enabled ? 1.f : 0.f;
                 break;
             default:
                 return;
             }
 
-            presetButtons.updateCurrentValue(id, value);
+            if (id < kParameterCount)
+                presetButtons.updateCurrentValue(id, value);
 
             editParameter(id, true);
             setParameterValue(id, value);
@@ -1935,7 +2160,8 @@ protected:
 
     void knobValueChanged(SubWidget* const widget, const float value) override
     {
-        presetButtons.updateCurrentValue(widget->getId(), value);
+        if (widget->getId() < kParameterCount)
+            presetButtons.updateCurrentValue(widget->getId(), value);
         setParameterValue(widget->getId(), value);
     }
     
@@ -1978,6 +2204,23 @@ protected:
 
     static inline float safeNumberFromText(const uint id, const bool isInteger, const char* const text) noexcept
     {
+        float def, min, max;
+
+        // the lookahead time is the only slider not coming from faust
+        if (id == kParameterCount + kExtraParameterBrickwallLookaheadTime)
+        {
+            def = BrickwallLimiter::kDefaultLookaheadMs;
+            min = BrickwallLimiter::kMinLookaheadMs;
+            max = BrickwallLimiter::kMaxLookaheadMs;
+        }
+        else
+        {
+            DISTRHO_SAFE_ASSERT_RETURN(id < kParameterCount, 0.f);
+            def = kParameterRanges[id].def;
+            min = kParameterRanges[id].min;
+            max = kParameterRanges[id].max;
+        }
+
         float value;
 
         {
@@ -1985,10 +2228,10 @@ protected:
 
             try {
                 value = static_cast<float>(isInteger ? std::atoi(text) : std::atof(text));
-            } DISTRHO_SAFE_EXCEPTION_RETURN("safeNumberFromText", kParameterRanges[id].def);
+            } DISTRHO_SAFE_EXCEPTION_RETURN("safeNumberFromText", def);
         }
 
-        return std::max(kParameterRanges[id].min, std::min(kParameterRanges[id].max, value));
+        return std::max(min, std::min(max, value));
     }
 
     void doubleClickHelperDone(SubWidget* const widget, const char* const text) override
@@ -2013,6 +2256,11 @@ protected:
         }
     }
 
+    void histogramTimelineChanged(Histogram*, const uint seconds) override
+    {
+        setState("histogram_timeline", String(seconds));
+    }
+
     void quantumThemeChanged(const bool size, const bool colors) override
     {
         if (colors)
@@ -64,20 +64,29 @@ struct MasterMeParameterGroup : VerticallyStackedHorizontalLayout
     }
 
     inline void setupSlider(QuantumValueSliderWithLabel& w, KnobEventHandler::Callback* const cb, const int id, const uint nameOffset)
+    {
+        setupSlider(w, cb, id, kParameterNames[id], nameOffset, kParameterUnits[id],
+                    kParameterRanges[id].def, kParameterRanges[id].min, kParameterRanges[id].max);
+    }
+
+    // for parameters not coming from faust, which are not in the kParameter* arrays
+    inline void setupSlider(QuantumValueSliderWithLabel& w, KnobEventHandler::Callback* const cb, const int id,
+                            const char* const name, const uint nameOffset,
+                            const char* const unit, const float def, const float min, const float max)
     {
         w.slider.setCallback(cb);
         w.slider.setId(id);
-        w.slider.setName(kParameterNames[id]);
-        w.slider.setDefault(kParameterRanges[id].def);
-        w.slider.setRange(kParameterRanges[id].min, kParameterRanges[id].max);
-        w.slider.setUnitLabel(kParameterUnits[id]);
-        w.slider.setValue(kParameterRanges[id].def, false);
-        w.label.setLabel(kParameterNames[id] + nameOffset);
-        w.label.setName(String(kParameterNames[id]) + " [label]");
+        w.slider.setName(name);
+        w.slider.setDefault(def);
+        w.slider.setRange(min, max);
+        w.slider.setUnitLabel(unit);
+        w.slider.setValue(def, false);
+        w.label.setLabel(name + nameOffset);
+        w.label.setName(String(name) + " [label]");
         items.push_back(&w);
 
         // FIXME find the proper way faust exports this
-        if (kParameterUnits[id][0] == '%')
+        if (unit[0] == '%')
             w.slider.setStep(1.f);
     }
 
@@ -111,25 +120,40 @@ struct MasterMeParameterGroup : VerticallyStackedHorizontalLayout
 
     inline void setupMeter(QuantumValueMeterWithLabel& w, const int id, const uint nameOffset,
                            const QuantumValueMeter::Orientation orientation = QuantumValueMeter::RightToLeft)
+    {
+        setupMeter(w, id, kParameterNames[id], nameOffset, kParameterUnits[id],
+                   kParameterRanges[id].def, kParameterRanges[id].min, kParameterRanges[id].max, orientation);
+    }
+
+    inline void setupMeter(QuantumValueMeterWithLabel& w, const int id,
+                           const char* const name, const uint nameOffset,
+                           const char* const unit, const float def, const float min, const float max,
+                           const QuantumValueMeter::Orientation orientation = QuantumValueMeter::RightToLeft)
     {
         w.meter.setId(id);
-        w.meter.setName(kParameterNames[id]);
+        w.meter.setName(name);
         w.meter.setOrientation(orientation);
-        w.meter.setRange(kParameterRanges[id].min, kParameterRanges[id].max);
-        w.meter.setUnitLabel(kParameterUnits[id]);
-        w.meter.setValue(kParameterRanges[id].def);
-        w.label.setLabel(kParameterNames[id] + nameOffset);
-        w.label.setName(String(kParameterNames[id]) + " [label]");
+        w.meter.setRange(min, max);
+        w.meter.setUnitLabel(unit);
+        w.meter.setValue(def);
+        w.label.setLabel(name + nameOffset);
+        w.label.setName(String(name) + " [label]");
         items.push_back(&w);
     }
 
     inline void setupSwitch(QuantumSingleSwitch& w, ButtonEventHandler::Callback* const bcb, const int id, const uint nameOffset)
+    {
+        setupSwitch(w, bcb, id, kParameterNames[id], nameOffset, kParameterRanges[id].def > 0.5f);
+    }
+
+    inline void setupSwitch(QuantumSingleSwitch& w, ButtonEventHandler::Callback* const bcb, const int id,
+                            const char* const name, const uint nameOffset, const bool def)
     {
         w.smallSwitch.setCallback(bcb);
         w.smallSwitch.setId(id);
-        w.smallSwitch.setChecked(kParameterRanges[id].def > 0.5f, false);
-        w.smallSwitch.setLabel(kParameterNames[id] + nameOffset);
-        w.smallSwitch.setName(kParameterNames[id]);
+        w.smallSwitch.setChecked(def, false);
+        w.smallSwitch.setLabel(name + nameOffset);
+        w.smallSwitch.setName(name);
         items.push_back(&w);
     }
 };
@@ -0,0 +1,253 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "SlidingExtremum.hpp"
+#include "TruePeakDetector.hpp"
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Stereo linked brickwall limiter with optional lookahead and true-peak detection,
+   meant as the very last stage of the plugin.
+
+   Without lookahead it works the same way as brickwall_no_latency in master_me.dsp (no attack, exponential release).
+   With lookahead the gain is held at the lowest value required over the lookahead window, using a sliding minimum,
+   and then smoothed with a moving average of the same length.
+   This gives a linear attack that reaches the required gain right as the peak arrives, instead of a jump.
+
+   With true-peak detection it reacts on the 4x interpolated signal instead of sample peaks, and the gain is also held
+   over the interpolation filter length around each frame, so every sample contributing to an inter-sample peak
+   gets the reduced gain.
+
+   The signal is delayed accordingly, see getLatency().
+   When not active the gain releases back to unity, but the signal is still delayed so latency stays the same.
+   Processing happens in-place, allocations only happen when the sample rate changes.
+ */
+class BrickwallLimiter
+{
+public:
+    // range of the lookahead time parameter, lower values are still valid for setMode()
+    static constexpr const float kMinLookaheadMs = 1.f;
+    static constexpr const float kDefaultLookaheadMs = 2.f;
+    static constexpr const float kMaxLookaheadMs = 5.f;
+
+    BrickwallLimiter(const double sampleRate)
+    {
+        setSampleRate(sampleRate);
+    }
+
+    ~BrickwallLimiter()
+    {
+        delete[] delay[0];
+        delete[] delay[1];
+        delete[] average;
+    }
+
+    /**
+       Change the sample rate, resetting the limiter.
+       Allocates memory if needed, must not be called from the audio thread.
+     */
+    void setSampleRate(const double newSampleRate)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(newSampleRate > 0.0,);
+
+        sampleRate = newSampleRate;
+
+        const uint32_t maxLookahead = msToFrames(kMaxLookaheadMs);
+        const uint32_t maxAverage = maxLookahead + 1;
+        const uint32_t maxLatency = TruePeakDetector::kLatency + kTruePeakSpread + maxLookahead;
+
+        if (maxLatency > bufferSize)
+        {
+            delete[] delay[0];
+            delete[] delay[1];
+            delete[] average;
+            delay[0] = new float[maxLatency];
+            delay[1] = new float[maxLatency];
+            average = new float[maxAverage];
+            bufferSize = maxLatency;
+        }
+
+        hold.setMaxWindowSize(maxAverage + kTruePeakSpread * 2);
+
+        updateReleaseCoef();
+        configure();
+    }
+
+    /**
+       Setup the detection mode and lookahead time (0 to disable, or up to kMaxLookaheadMs), resetting the limiter.
+       The latency might change as a result.
+     */
+    void setMode(const bool useTruePeak, const float newLookaheadMs) noexcept
+    {
+        truePeak = useTruePeak;
+        lookaheadMs = std::max(0.f, std::min(kMaxLookaheadMs, newLookaheadMs));
+        configure();
+    }
+
+    /**
+       Get the current latency, in frames.
+     */
+    uint32_t getLatency() const noexcept
+    {
+        return latency;
+    }
+
+    void reset() noexcept
+    {
+        detector.reset();
+        hold.reset();
+        std::memset(delay[0], 0, sizeof(float) * latency);
+        std::memset(delay[1], 0, sizeof(float) * latency);
+        delayPosition = 0;
+
+        for (uint32_t i = 0; i < averageSize; ++i)
+            average[i] = 1.f;
+
+        averagePosition = 0;
+        averageSum = averageSize;
+        envelope = 1.f;
+    }
+
+    /**
+       Enable or disable limiting.
+     */
+    void setActive(const bool yesNo) noexcept
+    {
+        active = yesNo;
+    }
+
+    /**
+       Set the maximum allowed peak level, in dB (dBTP when using true-peak detection).
+     */
+    void setCeiling(const float db) noexcept
+    {
+        ceiling = std::pow(10.f, db * 0.05f);
+    }
+
+    /**
+       Set the release time, in milliseconds.
+     */
+    void setRelease(const float ms) noexcept
+    {
+        if (d_isEqual(releaseMs, ms))
+            return;
+
+        releaseMs = ms;
+        updateReleaseCoef();
+    }
+
+    void process(float* const left, float* const right, const uint32_t frames) noexcept
+    {
+        float env = envelope;
+
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            const float peak = truePeak ? detector.process(left[i], right[i])
+                                        : std::max(std::abs(left[i]), std::abs(right[i]));
+
+            const float target = hold.process(active && peak > ceiling ? ceiling / peak : 1.f);
+
+            env = target < env ? target : target + releaseCoef * (env - target);
+
+            float gain = env;
+
+            if (averageSize > 1)
+            {
+                averageSum += env - average[averagePosition];
+                average[averagePosition] = env;
+
+                if (++averagePosition == averageSize)
+                {
+                    averagePosition = 0;
+
+                    // re-sum once per window, so rounding errors do not accumulate
+                    averageSum = 0.0;
+                    for (uint32_t j = 0; j < averageSize; ++j)
+                        averageSum += average[j];
+                }
+
+                gain = static_cast<float>(averageSum / averageSize);
+            }
+
+            if (latency != 0)
+            {
+                const float l = delay[0][delayPosition];
+                const float r = delay[1][delayPosition];
+                delay[0][delayPosition] = left[i];
+                delay[1][delayPosition] = right[i];
+
+                if (++delayPosition == latency)
+                    delayPosition = 0;
+
+                left[i] = l * gain;
+                right[i] = r * gain;
+            }
+            else
+            {
+                left[i] *= gain;
+                right[i] *= gain;
+            }
+        }
+
+        envelope = env;
+    }
+
+private:
+    // true-peak gain is held this many frames on each side of a frame, matching the interpolation filter
+    static constexpr const uint32_t kTruePeakSpread = TruePeakDetector::kTapsPerPhase / 2;
+
+    TruePeakDetector detector;
+    SlidingMinimum hold;
+
+    float* delay[2] = {};
+    uint32_t bufferSize = 0;
+    uint32_t delayPosition = 0;
+    uint32_t latency = 0;
+
+    float* average = nullptr;
+    uint32_t averageSize = 1;
+    uint32_t averagePosition = 0;
+    double averageSum = 1.0;
+
+    double sampleRate = 48000.0;
+    bool truePeak = false;
+    bool active = true;
+    float lookaheadMs = 0.f;
+    float ceiling = 1.f;
+    float releaseMs = 50.f;
+    float releaseCoef = 0.f;
+    float envelope = 1.f;
+
+    uint32_t msToFrames(const float ms) const noexcept
+    {
+        return static_cast<uint32_t>(std::lrint(ms * 0.001 * sampleRate));
+    }
+
+    // delay, hold and average lengths so that every sample around a peak gets at most the gain it requires
+    void configure() noexcept
+    {
+        const uint32_t spread = truePeak ? kTruePeakSpread : 0;
+
+        averageSize = msToFrames(lookaheadMs) + 1;
+        hold.setWindowSize(averageSize + spread * 2);
+        latency = (truePeak ? TruePeakDetector::kLatency : 0) + spread + averageSize - 1;
+
+        reset();
+    }
+
+    void updateReleaseCoef() noexcept
+    {
+        releaseCoef = static_cast<float>(std::exp(-1.0 / (std::max(0.001f, releaseMs * 0.001f) * sampleRate)));
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(BrickwallLimiter)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,61 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Channel layouts of the multichannel builds (see CHANNELS in the Makefile), identified by their number of channels.
+
+   Channels are in the usual SMPTE / ITU-R BS.2051 order, same as master_me.dsp:
+    - 2: L R
+    - 6 (5.1): L R C LFE Ls Rs
+    - 8 (7.1): L R C LFE Ls Rs Lrs Rrs
+    - 12 (7.1.4): L R C LFE Ls Rs Lrs Rrs Ltf Rtf Ltr Rtr
+
+   The first 2 channels are always the front pair, which is where the stereo-only processing happens.
+ */
+struct ChannelLayout {
+    static constexpr const uint kMaxChannels = 12;
+
+    static constexpr bool isSupported(const uint numChannels) noexcept
+    {
+        return numChannels == 2 || numChannels == 6 || numChannels == 8 || numChannels == 12;
+    }
+
+    /**
+       Get the ITU-R BS.1770-4 weight of a channel, for loudness measurement.
+       Surrounds at the sides (60 to 120 degrees) get +1.5 dB, the LFE is not measured, everything else is at unity.
+       Must match bs1770_weight in master_me.dsp.
+     */
+    static constexpr float getLoudnessWeight(const uint numChannels, const uint channel) noexcept
+    {
+        return numChannels == 2 ? 1.f
+             : channel == 3 ? 0.f
+             : channel == 4 || channel == 5 ? 1.41f
+             : 1.f;
+    }
+
+    /**
+       Get the short name of a channel, like "L" or "LFE".
+     */
+    static const char* getName(const uint numChannels, const uint channel) noexcept
+    {
+        static constexpr const char* const kNames[kMaxChannels] = {
+            "L", "R", "C", "LFE", "Ls", "Rs", "Lrs", "Rrs", "Ltf", "Rtf", "Ltr", "Rtr"
+        };
+
+        DISTRHO_SAFE_ASSERT_RETURN(channel < numChannels && channel < kMaxChannels, "");
+
+        return kNames[channel];
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,101 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cmath>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   One-pole parameter smoother running at control rate, that is, advancing once per step of several frames.
+
+   Uses the same time constant as faust's si.smoo (pole at 1 - 44.1 / sample rate), raised to the step size,
+   so that a parameter smoothed this way moves as fast as it would through si.smoo, just in coarser steps.
+
+   This is meant for faust parameters driving costly filter coefficients (pow, sqrt, tan),
+   which faust computes once per block when the parameter is not smoothed inside the dsp.
+   The plugin then runs the dsp in small sub-blocks only while isSmoothing() returns true.
+ */
+class ControlRateSmoother
+{
+public:
+    ControlRateSmoother(const float initialValue = 0.f) noexcept
+        : value(initialValue),
+          target(initialValue) {}
+
+    /**
+       Set the sample rate and number of frames per step, keeping the current value.
+     */
+    void setSampleRate(const double sampleRate, const uint32_t stepFrames) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+        DISTRHO_SAFE_ASSERT_RETURN(stepFrames != 0,);
+
+        coef = static_cast<float>(std::pow(std::max(0.0, 1.0 - 44.1 / sampleRate), static_cast<double>(stepFrames)));
+    }
+
+    void setTarget(const float newTarget) noexcept
+    {
+        target = newTarget;
+        smoothing = d_isNotEqual(value, target);
+    }
+
+    float getTarget() const noexcept
+    {
+        return target;
+    }
+
+    float getValue() const noexcept
+    {
+        return value;
+    }
+
+    /**
+       Jump directly to the target value.
+     */
+    void reset() noexcept
+    {
+        value = target;
+        smoothing = false;
+    }
+
+    bool isSmoothing() const noexcept
+    {
+        return smoothing;
+    }
+
+    /**
+       Advance one step and return the new value.
+       Ends on the exact target value once close enough to it, so isSmoothing() becomes false.
+     */
+    float next() noexcept
+    {
+        if (! smoothing)
+            return value;
+
+        value = target + coef * (value - target);
+
+        if (std::abs(value - target) < kEpsilon)
+            reset();
+
+        return value;
+    }
+
+private:
+    // well below the step size of any parameter using this
+    static constexpr const float kEpsilon = 1e-4f;
+
+    float value;
+    float target;
+    float coef = 0.f;
+    bool smoothing = false;
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
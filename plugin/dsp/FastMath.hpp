@@ -0,0 +1,85 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// use the approximated log2 for the mscomp level detectors, instead of libm log10.
+// In faust generated code this replaces the libm call of each of the 16 gain computers. Being inline and branch-free,
+// the approximation lets the compiler vectorize each detector loop of the -vec faust code separately.
+// pregen/Plugin.cpp replaces the gain computers as a whole, see MscompGainKernel.hpp, which needs this enabled.
+#ifndef MASTER_ME_MSCOMP_FASTMATH
+#define MASTER_ME_MSCOMP_FASTMATH 1
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Approximated base 2 logarithm, for normal positive numbers only.
+
+   The exponent is taken from the float bits, moved so the mantissa falls in [sqrt(0.5), sqrt(2)),
+   and the mantissa logarithm comes from the atanh series, ln(m) = 2 * atanh((m - 1) / (m + 1)), up to the 7th power.
+   Maximum absolute error is around 4e-6 (less than 3e-5 dB), with no branches, tables or libm calls,
+   so compilers can inline and vectorize it.
+ */
+static inline float master_me_fast_log2f(const float x) noexcept
+{
+    int32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    // exponent relative to sqrt(0.5), then mantissa bits in [sqrt(0.5), sqrt(2))
+    const int32_t exponent = (bits - 0x3f3504f3) >> 23;
+    bits -= exponent * (1 << 23);
+
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+
+    const float s = (m - 1.f) / (m + 1.f);
+    const float s2 = s * s;
+    const float ln = 2.f * s * (1.f + s2 * (1.f / 3.f + s2 * (1.f / 5.f + s2 * (1.f / 7.f))));
+
+    return static_cast<float>(exponent) + ln * 1.44269504088896f;
+}
+
+/**
+   Approximated base 2 exponential, with input clamped to [-126, 126].
+
+   The integer part goes directly into the float exponent bits, the fractional part (in [-0.5, 0.5])
+   comes from a 6th order taylor polynomial of exp.
+   Maximum relative error is around 2e-7, again without branches, tables or libm calls.
+ */
+static inline float master_me_fast_exp2f(float x) noexcept
+{
+    x = std::fmax(-126.f, std::fmin(126.f, x));
+
+    // rounding to nearest, conversion truncates but the value is always positive here
+    const int32_t n = static_cast<int32_t>(x + 126.5f) - 126;
+    const float t = (x - static_cast<float>(n)) * 0.693147181f;
+    const float p = 1.f + t * (1.f + t * (1.f / 2.f + t * (1.f / 6.f + t * (1.f / 24.f + t * (1.f / 120.f + t * (1.f / 720.f))))));
+
+    const int32_t bits = (n + 127) * (1 << 23);
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+
+    return p * scale;
+}
+
+/**
+   Linear to dB conversion used by the mscomp gain computers, called from faust code.
+   Same as ba.linear2db, 20 * log10(max(ma.MIN, x)), but using master_me_fast_log2f when MASTER_ME_MSCOMP_FASTMATH is set.
+   The attack/release smoothing, knee and gain around it stay faust generated scalar code,
+   except in pregen/Plugin.cpp, see MscompGainKernel.hpp.
+ */
+static inline float mscomp_linear2db(const float x) noexcept
+{
+   #if MASTER_ME_MSCOMP_FASTMATH
+    return 6.02059991f * master_me_fast_log2f(std::fmax(1.17549435e-38f, x));
+   #else
+    return 20.f * std::log10(std::fmax(1.17549435e-38f, x));
+   #endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------
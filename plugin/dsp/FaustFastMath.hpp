@@ -0,0 +1,79 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Math functions for the fast-math build of the faust dsp, as used by `faust -fm` (see FASTMATH in the Makefile).
+// faust calls these instead of the libm ones everywhere, and inlines this file into the generated code.
+//
+// The exponentials and logarithms, that is every ba.linear2db, ba.db2linear and filter coefficient,
+// go through the polynomial approximations in FastMath.hpp which have no branches, tables or libm calls,
+// so they inline and vectorize inside the per-sample loops.
+// Anything else is a plain call to libm, same as the regular build.
+//
+// Accuracy is checked against the regular build with `make check-fastmath` (see bench/fastmathcheck.cpp).
+// Logarithms are only valid for positive values, which faust code always ensures with ma.MIN.
+
+#pragma once
+
+#include "dsp/FastMath.hpp"
+
+extern "C" {
+
+// --------------------------------------------------------------------------------------------------------------------
+// float version, approximated
+
+inline float fast_exp2f(const float x) { return master_me_fast_exp2f(x); }
+inline float fast_expf(const float x) { return master_me_fast_exp2f(x * 1.44269504088896f); }
+inline float fast_exp10f(const float x) { return master_me_fast_exp2f(x * 3.32192809488736f); }
+inline float fast_log2f(const float x) { return master_me_fast_log2f(x); }
+inline float fast_logf(const float x) { return master_me_fast_log2f(x) * 0.693147180559945f; }
+inline float fast_log10f(const float x) { return master_me_fast_log2f(x) * 0.301029995663981f; }
+inline float fast_powf(const float x, const float y) { return master_me_fast_exp2f(y * master_me_fast_log2f(x)); }
+
+// --------------------------------------------------------------------------------------------------------------------
+// float version, from libm
+
+inline float fast_fabsf(const float x) { return std::fabs(x); }
+inline float fast_acosf(const float x) { return std::acos(x); }
+inline float fast_asinf(const float x) { return std::asin(x); }
+inline float fast_atanf(const float x) { return std::atan(x); }
+inline float fast_atan2f(const float x, const float y) { return std::atan2(x, y); }
+inline float fast_ceilf(const float x) { return std::ceil(x); }
+inline float fast_cosf(const float x) { return std::cos(x); }
+inline float fast_floorf(const float x) { return std::floor(x); }
+inline float fast_fmodf(const float x, const float y) { return std::fmod(x, y); }
+inline float fast_remainderf(const float x, const float y) { return std::remainder(x, y); }
+inline float fast_rintf(const float x) { return std::rint(x); }
+inline float fast_roundf(const float x) { return std::round(x); }
+inline float fast_sinf(const float x) { return std::sin(x); }
+inline float fast_sqrtf(const float x) { return std::sqrt(x); }
+inline float fast_tanf(const float x) { return std::tan(x); }
+
+// --------------------------------------------------------------------------------------------------------------------
+// double version, only used for constants, so always from libm
+
+inline double fast_fabs(const double x) { return std::fabs(x); }
+inline double fast_acos(const double x) { return std::acos(x); }
+inline double fast_asin(const double x) { return std::asin(x); }
+inline double fast_atan(const double x) { return std::atan(x); }
+inline double fast_atan2(const double x, const double y) { return std::atan2(x, y); }
+inline double fast_ceil(const double x) { return std::ceil(x); }
+inline double fast_cos(const double x) { return std::cos(x); }
+inline double fast_exp(const double x) { return std::exp(x); }
+inline double fast_exp2(const double x) { return std::exp2(x); }
+inline double fast_exp10(const double x) { return std::pow(10.0, x); }
+inline double fast_floor(const double x) { return std::floor(x); }
+inline double fast_fmod(const double x, const double y) { return std::fmod(x, y); }
+inline double fast_log(const double x) { return std::log(x); }
+inline double fast_log2(const double x) { return std::log2(x); }
+inline double fast_log10(const double x) { return std::log10(x); }
+inline double fast_pow(const double x, const double y) { return std::pow(x, y); }
+inline double fast_remainder(const double x, const double y) { return std::remainder(x, y); }
+inline double fast_rint(const double x) { return std::rint(x); }
+inline double fast_round(const double x) { return std::round(x); }
+inline double fast_sin(const double x) { return std::sin(x); }
+inline double fast_sqrt(const double x) { return std::sqrt(x); }
+inline double fast_tan(const double x) { return std::tan(x); }
+
+// --------------------------------------------------------------------------------------------------------------------
+
+}
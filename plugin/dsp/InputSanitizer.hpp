@@ -0,0 +1,93 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cstring>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Detection and replacement of broken input samples (NaN and Inf) coming from the host or upstream plugins.
+   A single one would otherwise end up in every filter and envelope state, breaking the output until a reset.
+
+   Everything works on the float bits as integers, as with -ffast-math std::isfinite is assumed to always be true.
+   Magnitudes of valid floats sort the same way as their bits with the sign cleared, and NaN and Inf sort above
+   all of them, so a single integer max over a block gives both its peak level and whether anything is broken.
+   That is scan(), which also serves as the silence detector input, so checking costs no extra pass over the audio.
+
+   Only blocks with broken samples go through scrub(), which writes a copy with those replaced by silence.
+   Denormals are flushed to zero there too, otherwise the denormal-disabling CPU flags already take care of them.
+
+   Both loops are branch-free and vectorize.
+ */
+class InputSanitizer
+{
+public:
+    struct Scan {
+        // peak level of the block, infinite if broken
+        float peak;
+        // whether the block has NaN or Inf samples
+        bool broken;
+    };
+
+    static Scan scan(const float* const* const channels, const uint numChannels, const uint32_t frames) noexcept
+    {
+        uint32_t peakBits = 0;
+
+        for (uint c = 0; c < numChannels; ++c)
+        {
+            const float* const in = channels[c];
+
+            for (uint32_t i = 0; i < frames; ++i)
+                peakBits = std::max(peakBits, absBits(in[i]));
+        }
+
+        Scan result;
+        result.broken = peakBits >= kExponentMask;
+
+        if (result.broken)
+            peakBits = kExponentMask;
+
+        std::memcpy(&result.peak, &peakBits, sizeof(float));
+        return result;
+    }
+
+    /**
+       Copy a block from @a in to @a out (which can be the same buffer) replacing NaN, Inf and denormals with 0.
+       Returns the number of NaN and Inf samples replaced.
+     */
+    static uint32_t scrub(const float* const in, float* const out, const uint32_t frames) noexcept
+    {
+        uint32_t numBroken = 0;
+
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            const uint32_t exponent = absBits(in[i]) & kExponentMask;
+            const bool broken = exponent == kExponentMask;
+
+            numBroken += broken ? 1 : 0;
+            out[i] = broken || exponent == 0 ? 0.f : in[i];
+        }
+
+        return numBroken;
+    }
+
+private:
+    static constexpr const uint32_t kExponentMask = 0x7f800000;
+
+    static inline uint32_t absBits(const float value) noexcept
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits & 0x7fffffff;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,339 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "LoudnessMeter.hpp"
+#include "SlidingExtremum.hpp"
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Stereo leveler with lookahead, an alternative to leveler_sc in master_me.dsp for offline and delayed-live use.
+
+   The faust leveler measures the loudness of its own output, fed back from the end of the chain,
+   so its gain always rides behind the signal, by the loudness window plus its very slow smoothing.
+   Here the loudness (K-weighted, 400ms window, same as lk2_short) is measured on the incoming signal,
+   while the audio goes through a delay line of the lookahead length.
+   The gain is computed the same way as the faust one would settle to for that loudness,
+   that is, target minus loudness, limited to max +/- and smoothed with a cutoff set by speed and brake,
+   and is applied to the delayed audio, which it now reaches in time.
+   With a lookahead close to the leveler time constant (about 5 seconds at the default speed),
+   gain changes end up centered on the loudness changes instead of lagging behind them.
+
+   The brake matches the faust one too: a peak expander with 100ms hold on the incoming signal,
+   slowing the leveler down to a stop below the brake threshold.
+
+   Loudness, brake and gain are updated every kStepFrames frames, the applied gain is interpolated in between.
+   The delay line is allocated for kMaxLookaheadSeconds when the sample rate changes, so the lookahead time can be
+   changed without allocations.
+   It is not cleared on reset either, up to 2 x 7.7 MB at 192 kHz, old contents are skipped until filled again instead.
+ */
+class LookaheadLeveler
+{
+public:
+    static constexpr const float kMaxLookaheadSeconds = 10.f;
+    static constexpr const uint32_t kStepFrames = 32;
+
+    LookaheadLeveler(const double sampleRate)
+        : meter(sampleRate, 0.4f, true)
+    {
+        setSampleRate(sampleRate);
+    }
+
+    ~LookaheadLeveler()
+    {
+        delete[] delay[0];
+        delete[] delay[1];
+    }
+
+    /**
+       Change the sample rate, resetting the leveler.
+       Allocates memory if needed, must not be called from the audio thread.
+     */
+    void setSampleRate(const double newSampleRate)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(newSampleRate > 0.0,);
+
+        sampleRate = newSampleRate;
+
+        const uint32_t maxLatency = secondsToFrames(kMaxLookaheadSeconds);
+
+        if (maxLatency > bufferSize)
+        {
+            delete[] delay[0];
+            delete[] delay[1];
+            delay[0] = new float[maxLatency];
+            delay[1] = new float[maxLatency];
+            bufferSize = maxLatency;
+        }
+
+        meter.setSampleRate(newSampleRate);
+        levelHold.setMaxWindowSize(secondsToFrames(kHoldSeconds) / kStepFrames + 1);
+        levelHold.setWindowSize(secondsToFrames(kHoldSeconds) / kStepFrames + 1);
+
+        brakeAttackPole = stepPole(kBrakeAttackSeconds);
+        brakeReleasePole = stepPole(kBrakeReleaseSeconds);
+        bypassPole = static_cast<float>(std::pow(1.0 - 44.1 / sampleRate, static_cast<double>(kStepFrames)));
+
+        latency = std::min(latency, bufferSize);
+        reset();
+    }
+
+    /**
+       Set the lookahead time in seconds, up to kMaxLookaheadSeconds, resetting the leveler.
+       The latency changes as a result.
+     */
+    void setLookahead(const float seconds) noexcept
+    {
+        latency = std::min(bufferSize, secondsToFrames(std::max(0.f, std::min(kMaxLookaheadSeconds, seconds))));
+        reset();
+    }
+
+    /**
+       Get the current latency, in frames.
+     */
+    uint32_t getLatency() const noexcept
+    {
+        return latency;
+    }
+
+    void reset() noexcept
+    {
+        delayPosition = 0;
+        delayFilling = latency;
+
+        meter.reset();
+        levelHold.reset();
+        stepCount = 0;
+        stepPeak = 0.f;
+
+        brakeDb = 0.f;
+        brake = 1.f;
+        gainDb = 0.0;
+        bypass = bypassTarget;
+        gain = 1.f;
+        gainIncrement = 0.f;
+    }
+
+    /**
+       Set the leveler parameters, matching the faust ones.
+     */
+    void setParameters(const float targetDb, const float speedPercent, const float brakeThresholdDb,
+                       const float maxPlusDb, const float maxMinusDb) noexcept
+    {
+        target = targetDb;
+        speed = speedPercent * 0.0015f;
+        brakeThreshold = brakeThresholdDb;
+        maxPlus = maxPlusDb;
+        maxMinus = maxMinusDb;
+    }
+
+    /**
+       Set the input gain, in dB, which the faust dsp applies before the leveler.
+       Only used for measuring, the gain itself is still applied by faust.
+     */
+    void setInputGain(const float db) noexcept
+    {
+        inputGain = std::pow(10.f, db * 0.05f);
+        meter.setInputGain(inputGain);
+    }
+
+    /**
+       Bypass the leveler gain, fading the same way as the faust leveler bypass.
+       The audio is still delayed, so latency stays the same.
+     */
+    void setBypass(const bool yesNo) noexcept
+    {
+        bypassTarget = yesNo ? 1.f : 0.f;
+    }
+
+    /**
+       Current leveler gain in dB, for the leveler gain meter.
+     */
+    float getGain() const noexcept
+    {
+        return static_cast<float>(gainDb);
+    }
+
+    /**
+       Jump to a leveler gain in dB, as restored from a warm state, without fading to it.
+     */
+    void setGain(const float db) noexcept
+    {
+        gainDb = db;
+        gain = std::pow(10.f, db * 0.05f) * (1.f - bypass) + bypass;
+        gainIncrement = 0.f;
+    }
+
+    /**
+       Current brake amount in percent, for the leveler brake meter.
+     */
+    float getBrake() const noexcept
+    {
+        return (1.f - brake) * 100.f;
+    }
+
+    void process(float* left, float* right, uint32_t frames) noexcept
+    {
+        while (frames != 0)
+        {
+            const uint32_t numFrames = std::min(frames, kStepFrames - stepCount);
+
+            // analysis on the incoming signal
+            meter.process(left, right, numFrames);
+
+            float peak = stepPeak;
+            for (uint32_t i = 0; i < numFrames; ++i)
+                peak = std::max(peak, std::abs(left[i]) + std::abs(right[i]));
+            stepPeak = peak;
+
+            // gain on the delayed signal
+            float g = gain;
+
+            if (latency != 0)
+            {
+                uint32_t pos = delayPosition;
+                uint32_t i = 0;
+
+                // not filled since the last reset, what comes out is silence instead of old contents
+                for (; i < numFrames && delayFilling != 0; ++i, --delayFilling)
+                {
+                    delay[0][pos] = left[i];
+                    delay[1][pos] = right[i];
+
+                    if (++pos == latency)
+                        pos = 0;
+
+                    g += gainIncrement;
+                    left[i] = right[i] = 0.f;
+                }
+
+                for (; i < numFrames; ++i)
+                {
+                    const float l = delay[0][pos];
+                    const float r = delay[1][pos];
+                    delay[0][pos] = left[i];
+                    delay[1][pos] = right[i];
+
+                    if (++pos == latency)
+                        pos = 0;
+
+                    g += gainIncrement;
+                    left[i] = l * g;
+                    right[i] = r * g;
+                }
+
+                delayPosition = pos;
+            }
+            else
+            {
+                for (uint32_t i = 0; i < numFrames; ++i)
+                {
+                    g += gainIncrement;
+                    left[i] *= g;
+                    right[i] *= g;
+                }
+            }
+
+            gain = g;
+            left += numFrames;
+            right += numFrames;
+            frames -= numFrames;
+
+            if ((stepCount += numFrames) == kStepFrames)
+            {
+                stepCount = 0;
+                step();
+            }
+        }
+    }
+
+private:
+    static constexpr const float kHoldSeconds = 0.1f;
+    static constexpr const float kBrakeAttackSeconds = 0.05f;
+    static constexpr const float kBrakeReleaseSeconds = 0.3f;
+    static constexpr const float kBrakeKnee = 12.f;
+    static constexpr const float kBrakeStrength = 2.f;
+    static constexpr const float kBrakeRange = -120.f;
+
+    LoudnessMeter meter;
+    SlidingMaximum levelHold;
+
+    float* delay[2] = {};
+    uint32_t bufferSize = 0;
+    uint32_t delayPosition = 0;
+    uint32_t delayFilling = 0;
+    uint32_t latency = 0;
+
+    double sampleRate = 48000.0;
+    float target = -18.f;
+    float speed = 0.03f;
+    float brakeThreshold = -14.f;
+    float maxPlus = 20.f;
+    float maxMinus = 20.f;
+    float inputGain = 1.f;
+    float bypassTarget = 0.f;
+
+    float brakeAttackPole = 0.f;
+    float brakeReleasePole = 0.f;
+    float bypassPole = 0.f;
+
+    uint32_t stepCount = 0;
+    float stepPeak = 0.f;
+    float brakeDb = 0.f;
+    float brake = 1.f;
+    // double, as slow speeds move it by less than a float can resolve (see precise_lp1 in master_me.dsp)
+    double gainDb = 0.0;
+    float bypass = 0.f;
+    float gain = 1.f;
+    float gainIncrement = 0.f;
+
+    uint32_t secondsToFrames(const float seconds) const noexcept
+    {
+        return static_cast<uint32_t>(std::lrint(seconds * sampleRate));
+    }
+
+    // ba.tau2pole, for one step
+    float stepPole(const float tau) const noexcept
+    {
+        return static_cast<float>(std::exp(-static_cast<double>(kStepFrames) / (tau * sampleRate)));
+    }
+
+    // control rate update, same as leveler_sc and its expander
+    void step() noexcept
+    {
+        // brake, from the held peak level of the incoming signal
+        const float level = 20.f * std::log10(std::max(1.17549435e-38f, levelHold.process(stepPeak * inputGain)));
+        stepPeak = 0.f;
+
+        float brakeTarget;
+        if (level > brakeThreshold + kBrakeKnee * 0.5f)
+            brakeTarget = 0.f;
+        else if (level > brakeThreshold - kBrakeKnee * 0.5f)
+            brakeTarget = -kBrakeStrength * std::pow(level - brakeThreshold - kBrakeKnee * 0.5f, 2.f) / (kBrakeKnee * 2.f);
+        else
+            brakeTarget = std::max(kBrakeRange, kBrakeStrength * (level - brakeThreshold));
+
+        brakeDb = brakeTarget + (brakeTarget > brakeDb ? brakeAttackPole : brakeReleasePole) * (brakeDb - brakeTarget);
+        brake = std::max(0.f, std::min(1.f, std::pow(10.f, brakeDb * 0.05f)));
+
+        // leveler gain, as the faust feedback loop would settle to
+        const float gainTarget = std::max(-maxMinus, std::min(maxPlus, target - meter.getLoudness()));
+        const double gainPole = std::exp(-2.0 * M_PI * speed * brake * kStepFrames / sampleRate);
+        gainDb = gainTarget + gainPole * (gainDb - gainTarget);
+
+        bypass = bypassTarget + bypassPole * (bypass - bypassTarget);
+
+        const float newGain = std::pow(10.f, static_cast<float>(gainDb) * 0.05f) * (1.f - bypass) + bypass;
+        gainIncrement = (newGain - gain) / kStepFrames;
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(LookaheadLeveler)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
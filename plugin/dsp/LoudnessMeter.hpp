@@ -0,0 +1,278 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cmath>
+#include <cstring>
+
+// Use compensated running sum for the loudness window, set to 0 for a plain running sum (for A/B testing)
+#ifndef MASTER_ME_LUFS_COMPENSATED
+#define MASTER_ME_LUFS_COMPENSATED 1
+#endif
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   ITU-R BS.1770 "K-weighting" prefilter, a high-shelf followed by a high-pass.
+   Same design as lib/ebur128.dsp, the biquads are constructed for arbitrary sample rates.
+ */
+struct KWeightingFilter {
+    float b0[2], b1[2], b2[2], a1[2], a2[2];
+    float s1[2], s2[2];
+
+    void setSampleRate(const double sampleRate) noexcept
+    {
+        // stage 1, high shelf
+        {
+            const double K = std::tan(M_PI * 1681.7632251028442 / sampleRate);
+            const double V0 = std::pow(10.0, 3.9997778685513232 / 20.0);
+            const double den = 1.0 + std::sqrt(2.0) * K + K * K;
+            b0[0] = (V0 + std::sqrt(2.0 * V0) * K + K * K) / den;
+            b1[0] = 2.0 * (K * K - V0) / den;
+            b2[0] = (V0 - std::sqrt(2.0 * V0) * K + K * K) / den;
+            a1[0] = 2.0 * (K * K - 1.0) / den;
+            a2[0] = (1.0 - std::sqrt(2.0) * K + K * K) / den;
+        }
+
+        // stage 2, high pass
+        {
+            const double K = std::tan(M_PI * 38.135470876002174 / sampleRate);
+            const double Q = 0.5003270373223665;
+            const double den = K * K * Q + K + Q;
+            b0[1] = Q / den;
+            b1[1] = -2.0 * Q / den;
+            b2[1] = Q / den;
+            a1[1] = 2.0 * Q * (K * K - 1.0) / den;
+            a2[1] = (K * K * Q - K + Q) / den;
+        }
+    }
+
+    void reset() noexcept
+    {
+        s1[0] = s1[1] = s2[0] = s2[1] = 0.f;
+    }
+
+    // transposed direct form II, matching faust's fi.tf22t
+    inline float process(float x) noexcept
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            const float y = b0[i] * x + s1[i];
+            s1[i] = b1[i] * x - a1[i] * y + s2[i];
+            s2[i] = b2[i] * x - a2[i] * y;
+            x = y;
+        }
+        return x;
+    }
+};
+
+/**
+   KWeightingFilter for several channels at once, one per lane.
+   Channels go through each stage side by side, so the per-channel loops vectorize across channels.
+   Results are the same as one KWeightingFilter per channel.
+ */
+template <uint kNumLanes>
+struct KWeightingFilterLanes {
+    // only the coefficients are used
+    KWeightingFilter coefs;
+    float s1[2][kNumLanes], s2[2][kNumLanes];
+
+    void setSampleRate(const double sampleRate) noexcept
+    {
+        coefs.setSampleRate(sampleRate);
+    }
+
+    void reset() noexcept
+    {
+        std::memset(s1, 0, sizeof(s1));
+        std::memset(s2, 0, sizeof(s2));
+    }
+
+    // processes one frame in place
+    inline void process(float x[kNumLanes]) noexcept
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            const float b0 = coefs.b0[i], b1 = coefs.b1[i], b2 = coefs.b2[i], a1 = coefs.a1[i], a2 = coefs.a2[i];
+
+            for (uint c = 0; c < kNumLanes; ++c)
+            {
+                const float y = b0 * x[c] + s1[i][c];
+                s1[i][c] = b1 * x[c] - a1 * y + s2[i][c];
+                s2[i][c] = b2 * x[c] - a2 * y;
+                x[c] = y;
+            }
+        }
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Stereo K-weighted loudness meter over a sliding window, in LUFS.
+
+   The window buffer is sized for the current sample rate and only reallocated when a higher rate requires more space,
+   so a 48kHz instance does not pay for the 192kHz worst-case.
+
+   The window energy is kept as a running sum, costing O(1) per sample regardless of the window size.
+   A plain running sum slowly drifts, as what gets subtracted is never exactly what was rounded in.
+   The compensated variant also accumulates every new window in a second, Kahan-compensated sum,
+   which replaces the running sum each time the ring wraps around, so errors never outlive one window.
+
+   Optionally applies an input gain before measuring, smoothed the same way as faust's si.smoo.
+   This allows to meter a signal after a gain stage without having access to it.
+ */
+template <bool compensated>
+class LoudnessMeterBase
+{
+public:
+    LoudnessMeterBase(const double sampleRate, const float windowInSeconds, const bool smoothInputGain = false)
+        : windowSeconds(windowInSeconds),
+          useInputGain(smoothInputGain)
+    {
+        setSampleRate(sampleRate);
+    }
+
+    ~LoudnessMeterBase()
+    {
+        delete[] energies;
+    }
+
+    /**
+       Change the sample rate, resetting the meter.
+       Allocates memory if the current buffer is not big enough, must not be called from the audio thread.
+     */
+    void setSampleRate(const double sampleRate)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        numSamples = std::max<uint32_t>(1, static_cast<uint32_t>(std::lrint(windowSeconds * sampleRate)));
+
+        if (numSamples > bufferSize)
+        {
+            delete[] energies;
+            energies = new float[numSamples];
+            bufferSize = numSamples;
+        }
+
+        gainPole = static_cast<float>(std::exp(-1.0 / (0.005 * sampleRate)));
+
+        for (int c = 0; c < 2; ++c)
+            kfilter[c].setSampleRate(sampleRate);
+
+        reset();
+    }
+
+    /**
+       Clear the meter history.
+     */
+    void reset() noexcept
+    {
+        std::memset(energies, 0, sizeof(float) * numSamples);
+        writePosition = 0;
+        sum = resum = resumCompensation = 0.0;
+        gain = useInputGain ? 0.f : 1.f;
+
+        for (int c = 0; c < 2; ++c)
+            kfilter[c].reset();
+    }
+
+    /**
+       Set the (linear) gain to apply before measuring.
+       Only used if the meter was created with @a smoothInputGain.
+     */
+    void setInputGain(const float value) noexcept
+    {
+        targetGain = value;
+    }
+
+    void process(const float* const left, const float* const right, const uint32_t frames) noexcept
+    {
+        const float gainCoef = useInputGain ? gainPole : 1.f;
+        const float gainTarget = useInputGain ? targetGain * (1.f - gainPole) : 0.f;
+
+        float g = gain;
+        uint32_t pos = writePosition;
+        double s = sum;
+        double rs = resum;
+        double rc = resumCompensation;
+
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            g = gainTarget + gainCoef * g;
+
+            const float l = kfilter[0].process(left[i] * g);
+            const float r = kfilter[1].process(right[i] * g);
+            const float energy = l * l + r * r;
+
+            s += static_cast<double>(energy) - static_cast<double>(energies[pos]);
+            energies[pos] = energy;
+
+            if (compensated)
+            {
+                // volatile prevents fast-math from folding the compensation term away
+                const double y = static_cast<double>(energy) - rc;
+                volatile const double t = rs + y;
+                rc = (t - rs) - y;
+                rs = t;
+            }
+
+            if (++pos == numSamples)
+            {
+                pos = 0;
+
+                if (compensated)
+                {
+                    // the ring now holds exactly the values accumulated since the last wrap
+                    s = rs;
+                    rs = rc = 0.0;
+                }
+            }
+        }
+
+        gain = g;
+        writePosition = pos;
+        sum = s;
+        resum = rs;
+        resumCompensation = rc;
+    }
+
+    /**
+       Get the loudness of the last window, in LUFS.
+     */
+    float getLoudness() const noexcept
+    {
+        return 10.f * std::log10(std::max(1e-12, sum / numSamples)) - 0.691f;
+    }
+
+private:
+    const float windowSeconds;
+    const bool useInputGain;
+
+    KWeightingFilter kfilter[2];
+
+    float* energies = nullptr;
+    uint32_t bufferSize = 0;
+    uint32_t numSamples = 0;
+    uint32_t writePosition = 0;
+    double sum = 0.0;
+    double resum = 0.0;
+    double resumCompensation = 0.0;
+
+    float gain = 1.f;
+    float gainPole = 0.f;
+    float targetGain = 1.f;
+
+    DISTRHO_DECLARE_NON_COPYABLE(LoudnessMeterBase)
+};
+
+typedef LoudnessMeterBase<MASTER_ME_LUFS_COMPENSATED != 0> LoudnessMeter;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,267 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+#include "FastMath.hpp"
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+# include <arm_neon.h>
+#endif
+
+// run the 16 mscomp gain computers as one SoA lane group, instead of the faust generated scalar code for each,
+// template/mscomp_kernel.py puts it into pregen/Plugin.cpp, in place of the gain computers of the 8-band mscomp
+#ifndef MASTER_ME_MSCOMP_KERNEL
+#define MASTER_ME_MSCOMP_KERNEL MASTER_ME_MSCOMP_FASTMATH
+#endif
+
+#if MASTER_ME_MSCOMP_KERNEL && ! MASTER_ME_MSCOMP_FASTMATH
+#error MASTER_ME_MSCOMP_KERNEL uses the approximated log2, it requires MASTER_ME_MSCOMP_FASTMATH
+#endif
+
+// --------------------------------------------------------------------------------------------------------------------
+// the few vector operations the kernel needs, with the same rounding as the scalar code they replace (no fma)
+
+namespace MscompSimd {
+
+#if defined(__AVX2__)
+static constexpr const unsigned kWidth = 8;
+typedef __m256 Vec;
+
+static inline Vec load(const float* const p) noexcept { return _mm256_load_ps(p); }
+static inline void store(float* const p, const Vec v) noexcept { _mm256_store_ps(p, v); }
+static inline Vec set1(const float x) noexcept { return _mm256_set1_ps(x); }
+static inline Vec add(const Vec a, const Vec b) noexcept { return _mm256_add_ps(a, b); }
+static inline Vec sub(const Vec a, const Vec b) noexcept { return _mm256_sub_ps(a, b); }
+static inline Vec mul(const Vec a, const Vec b) noexcept { return _mm256_mul_ps(a, b); }
+static inline Vec div(const Vec a, const Vec b) noexcept { return _mm256_div_ps(a, b); }
+// a > b ? a : b, and b < a ? b : a, as std::max(b, a) and std::min(a, b)
+static inline Vec max(const Vec a, const Vec b) noexcept { return _mm256_max_ps(a, b); }
+static inline Vec min(const Vec a, const Vec b) noexcept { return _mm256_min_ps(b, a); }
+typedef __m256 Mask;
+static inline Mask gt(const Vec a, const Vec b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+static inline Mask both(const Mask a, const Mask b) noexcept { return _mm256_and_ps(a, b); }
+static inline Mask either(const Mask a, const Mask b) noexcept { return _mm256_xor_ps(a, b); }
+static inline Vec select(const Mask mask, const Vec a, const Vec b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+
+// see master_me_fast_log2f
+static inline Vec log2(const Vec x) noexcept
+{
+    const __m256i bits = _mm256_castps_si256(x);
+    const __m256i exponent = _mm256_srai_epi32(_mm256_sub_epi32(bits, _mm256_set1_epi32(0x3f3504f3)), 23);
+    const Vec m = _mm256_castsi256_ps(_mm256_sub_epi32(bits, _mm256_slli_epi32(exponent, 23)));
+    const Vec s = div(sub(m, set1(1.f)), add(m, set1(1.f)));
+    const Vec s2 = mul(s, s);
+    const Vec p = add(set1(1.f), mul(s2, add(set1(1.f / 3.f), mul(s2, add(set1(1.f / 5.f), mul(s2, set1(1.f / 7.f)))))));
+    const Vec ln = mul(mul(set1(2.f), s), p);
+    return add(_mm256_cvtepi32_ps(exponent), mul(ln, set1(1.44269504088896f)));
+}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+static constexpr const unsigned kWidth = 4;
+typedef __m128 Vec;
+
+static inline Vec load(const float* const p) noexcept { return _mm_load_ps(p); }
+static inline void store(float* const p, const Vec v) noexcept { _mm_store_ps(p, v); }
+static inline Vec set1(const float x) noexcept { return _mm_set1_ps(x); }
+static inline Vec add(const Vec a, const Vec b) noexcept { return _mm_add_ps(a, b); }
+static inline Vec sub(const Vec a, const Vec b) noexcept { return _mm_sub_ps(a, b); }
+static inline Vec mul(const Vec a, const Vec b) noexcept { return _mm_mul_ps(a, b); }
+static inline Vec div(const Vec a, const Vec b) noexcept { return _mm_div_ps(a, b); }
+static inline Vec max(const Vec a, const Vec b) noexcept { return _mm_max_ps(a, b); }
+static inline Vec min(const Vec a, const Vec b) noexcept { return _mm_min_ps(b, a); }
+typedef __m128 Mask;
+static inline Mask gt(const Vec a, const Vec b) noexcept { return _mm_cmpgt_ps(a, b); }
+static inline Mask both(const Mask a, const Mask b) noexcept { return _mm_and_ps(a, b); }
+static inline Mask either(const Mask a, const Mask b) noexcept { return _mm_xor_ps(a, b); }
+static inline Vec select(const Mask mask, const Vec a, const Vec b) noexcept
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline Vec log2(const Vec x) noexcept
+{
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128i exponent = _mm_srai_epi32(_mm_sub_epi32(bits, _mm_set1_epi32(0x3f3504f3)), 23);
+    const Vec m = _mm_castsi128_ps(_mm_sub_epi32(bits, _mm_slli_epi32(exponent, 23)));
+    const Vec s = div(sub(m, set1(1.f)), add(m, set1(1.f)));
+    const Vec s2 = mul(s, s);
+    const Vec p = add(set1(1.f), mul(s2, add(set1(1.f / 3.f), mul(s2, add(set1(1.f / 5.f), mul(s2, set1(1.f / 7.f)))))));
+    const Vec ln = mul(mul(set1(2.f), s), p);
+    return add(_mm_cvtepi32_ps(exponent), mul(ln, set1(1.44269504088896f)));
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+// not compiled nor run on ARM so far, bench/mscompkernelcheck.cpp has to pass on the device before relying on it
+static constexpr const unsigned kWidth = 4;
+typedef float32x4_t Vec;
+
+static inline Vec load(const float* const p) noexcept { return vld1q_f32(p); }
+static inline void store(float* const p, const Vec v) noexcept { vst1q_f32(p, v); }
+static inline Vec set1(const float x) noexcept { return vdupq_n_f32(x); }
+static inline Vec add(const Vec a, const Vec b) noexcept { return vaddq_f32(a, b); }
+static inline Vec sub(const Vec a, const Vec b) noexcept { return vsubq_f32(a, b); }
+static inline Vec mul(const Vec a, const Vec b) noexcept { return vmulq_f32(a, b); }
+static inline Vec div(const Vec a, const Vec b) noexcept { return vdivq_f32(a, b); }
+typedef uint32x4_t Mask;
+static inline Mask gt(const Vec a, const Vec b) noexcept { return vcgtq_f32(a, b); }
+static inline Mask both(const Mask a, const Mask b) noexcept { return vandq_u32(a, b); }
+static inline Mask either(const Mask a, const Mask b) noexcept { return veorq_u32(a, b); }
+static inline Vec select(const Mask mask, const Vec a, const Vec b) noexcept { return vbslq_f32(mask, a, b); }
+// vmaxq/vminq differ from the scalar code for NaN and signed zeros, compare and select instead
+static inline Vec max(const Vec a, const Vec b) noexcept { return select(gt(a, b), a, b); }
+static inline Vec min(const Vec a, const Vec b) noexcept { return select(gt(a, b), b, a); }
+
+static inline Vec log2(const Vec x) noexcept
+{
+    const int32x4_t bits = vreinterpretq_s32_f32(x);
+    const int32x4_t exponent = vshrq_n_s32(vsubq_s32(bits, vdupq_n_s32(0x3f3504f3)), 23);
+    const Vec m = vreinterpretq_f32_s32(vsubq_s32(bits, vshlq_n_s32(exponent, 23)));
+    const Vec s = div(sub(m, set1(1.f)), add(m, set1(1.f)));
+    const Vec s2 = mul(s, s);
+    const Vec p = add(set1(1.f), mul(s2, add(set1(1.f / 3.f), mul(s2, add(set1(1.f / 5.f), mul(s2, set1(1.f / 7.f)))))));
+    const Vec ln = mul(mul(set1(2.f), s), p);
+    return add(vcvtq_f32_s32(exponent), mul(ln, set1(1.44269504088896f)));
+}
+#else
+// plain scalar code, one lane at a time
+static constexpr const unsigned kWidth = 1;
+typedef float Vec;
+
+static inline Vec load(const float* const p) noexcept { return *p; }
+static inline void store(float* const p, const Vec v) noexcept { *p = v; }
+static inline Vec set1(const float x) noexcept { return x; }
+static inline Vec add(const Vec a, const Vec b) noexcept { return a + b; }
+static inline Vec sub(const Vec a, const Vec b) noexcept { return a - b; }
+static inline Vec mul(const Vec a, const Vec b) noexcept { return a * b; }
+static inline Vec div(const Vec a, const Vec b) noexcept { return a / b; }
+static inline Vec max(const Vec a, const Vec b) noexcept { return a > b ? a : b; }
+static inline Vec min(const Vec a, const Vec b) noexcept { return b < a ? b : a; }
+typedef bool Mask;
+static inline Mask gt(const Vec a, const Vec b) noexcept { return a > b; }
+static inline Mask both(const Mask a, const Mask b) noexcept { return a && b; }
+static inline Mask either(const Mask a, const Mask b) noexcept { return a != b; }
+static inline Vec select(const Mask mask, const Vec a, const Vec b) noexcept { return mask ? a : b; }
+static inline Vec log2(const Vec x) noexcept { return master_me_fast_log2f(x); }
+#endif
+
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   The gain computers of the 8-band mscomp, for both channels, as one group of 16 SoA lanes (channel * 8 + band).
+
+   Does per sample what peak_compression_gain_N_chan_db_l2db in master_me.dsp does for each band:
+   level in dB through the approximated log2 (as mscomp_linear2db), knee and strength, attack/release smoothing
+   of the gain (si.onePoleSwitching, as with the prePost setting used by master_me), then the link between channels,
+   as a vector min of both channel lanes and a linear interpolation towards it.
+
+   The operations and their order are the same as in the faust generated code, so results match it,
+   with 4 (SSE2, NEON on aarch64) or 8 (AVX2) lanes per instruction instead of a single one.
+   Parameters come already converted from the faust dsp, once per block, see setBand().
+   State is all zeros after reset, so this can be part of a faust dsp created through createFaustDsp.
+ */
+class MscompGainKernel
+{
+public:
+    static constexpr const unsigned kNumBands = 8;
+    static constexpr const unsigned kNumChannels = 2;
+    static constexpr const unsigned kNumLanes = kNumBands * kNumChannels;
+
+    static_assert(kNumBands % MscompSimd::kWidth == 0, "vector width must divide the number of bands");
+
+    /**
+       Set the parameters of @a band for both channels, as computed by the faust dsp:
+       threshold, half the knee, the knee start and end levels, the knee curve scale (1 / (2 * knee)),
+       strength, the smoothing poles for a rising (release) and falling (attack) gain, and the link amount.
+     */
+    void setBand(const unsigned band,
+                 const float threshold, const float kneeHalf, const float kneeLow, const float kneeHigh,
+                 const float kneeScale, const float strength,
+                 const float releasePole, const float attackPole, const float link) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(band < kNumBands,);
+
+        for (unsigned c = 0; c < kNumChannels; ++c)
+        {
+            const unsigned lane = c * kNumBands + band;
+            thresholds[lane] = threshold;
+            kneeHalves[lane] = kneeHalf;
+            kneeLows[lane] = kneeLow;
+            kneeHighs[lane] = kneeHigh;
+            kneeScales[lane] = kneeScale;
+            strengths[lane] = strength;
+            releasePoles[lane] = releasePole;
+            attackPoles[lane] = attackPole;
+        }
+
+        links[band] = link;
+    }
+
+    void reset() noexcept
+    {
+        std::memset(gains, 0, sizeof(gains));
+    }
+
+    /**
+       Process one sample of all lanes.
+       @a levels are the absolute values from the analyzer, @a linkedGains gets the linked gains in dB.
+       Both have kNumLanes values and must be aligned to 32 bytes.
+     */
+    void process(const float* const levels, float* const linkedGains) noexcept
+    {
+        using namespace MscompSimd;
+
+        for (unsigned l = 0; l < kNumLanes; l += kWidth)
+        {
+            // mscomp_linear2db
+            const Vec level = mul(set1(6.02059991f), log2(max(load(levels + l), set1(1.17549435e-38f))));
+
+            // select3 of the gain computer, on the number of knee edges below the level:
+            // none is 0, one is within the knee, both is above it
+            const Vec overThreshold = sub(level, load(thresholds + l));
+            const Vec kneeOffset = add(load(kneeHalves + l), overThreshold);
+            const Vec kneeGain = mul(load(kneeScales + l), mul(kneeOffset, kneeOffset));
+            const Mask aboveLow = gt(level, load(kneeLows + l));
+            const Mask aboveHigh = gt(level, load(kneeHighs + l));
+            const Vec selected = select(either(aboveLow, aboveHigh), kneeGain,
+                                        select(both(aboveLow, aboveHigh), overThreshold, set1(0.f)));
+            const Vec gain = sub(set1(0.f), mul(load(strengths + l), max(selected, set1(0.f))));
+
+            // si.onePoleSwitching(rel, att)
+            const Vec previous = load(gains + l);
+            const Vec pole = select(gt(gain, previous), load(releasePoles + l), load(attackPoles + l));
+            store(gains + l, add(mul(gain, sub(set1(1.f), pole)), mul(previous, pole)));
+        }
+
+        // ba.parallelMin of the two channels, then it.interpolate_linear(link) towards it
+        for (unsigned b = 0; b < kNumBands; b += kWidth)
+        {
+            const Vec first = load(gains + b);
+            const Vec second = load(gains + kNumBands + b);
+            const Vec lowest = min(first, second);
+            const Vec link = load(links + b);
+            store(linkedGains + b, add(first, mul(link, sub(lowest, first))));
+            store(linkedGains + kNumBands + b, add(second, mul(link, sub(lowest, second))));
+        }
+    }
+
+private:
+    alignas(32) float thresholds[kNumLanes];
+    alignas(32) float kneeHalves[kNumLanes];
+    alignas(32) float kneeLows[kNumLanes];
+    alignas(32) float kneeHighs[kNumLanes];
+    alignas(32) float kneeScales[kNumLanes];
+    alignas(32) float strengths[kNumLanes];
+    alignas(32) float releasePoles[kNumLanes];
+    alignas(32) float attackPoles[kNumLanes];
+    alignas(32) float links[kNumBands];
+    // smoothed gain of each lane, before linking
+    alignas(32) float gains[kNumLanes];
+};
+
+// --------------------------------------------------------------------------------------------------------------------
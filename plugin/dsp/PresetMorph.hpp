@@ -0,0 +1,213 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cmath>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Gradual transition of a set of parameters from their current values to those of a preset.
+
+   All parameters follow the same S-shaped curve over the morph time, so they arrive together and without the
+   jumps of setting everything at once, as that does for parameters not smoothed inside the dsp.
+   The plugin advances it once per block, so faust gets one set of new values per block,
+   at the same cost as a block with no changes.
+
+   How each parameter moves depends on its kind:
+    - linear, for most of them
+    - logarithmic, for frequencies and times, so they sweep evenly in octaves
+    - integer, interpolated and rounded so it only takes valid values
+    - toggle, for switches, which flip halfway through
+
+   Everything is kept in fixed arrays, nothing allocates.
+   Not thread-safe, start() and process() must be called from the same thread.
+ */
+template <uint numParameters>
+class PresetMorph
+{
+public:
+    enum Kind {
+        kKindLinear,
+        kKindLogarithmic,
+        kKindInteger,
+        kKindToggle
+    };
+
+    PresetMorph() noexcept
+    {
+        for (uint i = 0; i < numParameters; ++i)
+        {
+            kinds[i] = kKindLinear;
+            from[i] = to[i] = 0.f;
+            morphing[i] = false;
+        }
+    }
+
+    void setKind(const uint index, const Kind kind) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(index < numParameters,);
+
+        kinds[index] = kind;
+    }
+
+    /**
+       Set the morph time, used from the next call to start().
+       A time of 0 makes start() apply values immediately.
+     */
+    void setTime(const double sampleRate, const float seconds) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        timeFrames = static_cast<uint32_t>(std::max(0.f, seconds) * sampleRate);
+    }
+
+    /**
+       Begin a new morph of all parameters flagged with @a start, from @a current to @a target values.
+       Parameters already morphing start from where they are now.
+       Returns false if the morph time is 0, in which case nothing is started and @a target should be applied directly.
+     */
+    bool start(const float* const current, const float* const target, const bool* const start) noexcept
+    {
+        if (timeFrames == 0)
+            return false;
+
+        const float position = getPosition();
+
+        durationFrames = timeFrames;
+
+        for (uint i = 0; i < numParameters; ++i)
+        {
+            if (! start[i])
+                continue;
+
+            from[i] = morphing[i] ? valueAt(i, position) : current[i];
+            to[i] = target[i];
+            morphing[i] = true;
+        }
+
+        elapsedFrames = 0;
+        active = true;
+        return true;
+    }
+
+    /**
+       Stop morphing a parameter, when set to a new value from outside during the morph.
+     */
+    void cancel(const uint index) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(index < numParameters,);
+
+        morphing[index] = false;
+    }
+
+    bool isActive() const noexcept
+    {
+        return active;
+    }
+
+    bool isMorphing(const uint index) const noexcept
+    {
+        return active && index < numParameters && morphing[index];
+    }
+
+    /**
+       Value the parameter is morphing to.
+     */
+    float getTarget(const uint index) const noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(index < numParameters, 0.f);
+
+        return to[index];
+    }
+
+    /**
+       Advance the morph by @a frames and call @a apply(index, value) for every parameter still morphing.
+       The last call of a morph sets the exact target values.
+     */
+    template <class Apply>
+    void process(const uint32_t frames, Apply&& apply)
+    {
+        if (! active)
+            return;
+
+        elapsedFrames = std::min(durationFrames, elapsedFrames + frames);
+
+        const float position = getPosition();
+        const bool finished = elapsedFrames >= durationFrames;
+
+        for (uint i = 0; i < numParameters; ++i)
+        {
+            if (! morphing[i])
+                continue;
+
+            apply(i, finished ? to[i] : valueAt(i, position));
+
+            if (finished)
+                morphing[i] = false;
+        }
+
+        active = ! finished;
+    }
+
+    /**
+       Jump to the end of the current morph, if any.
+     */
+    template <class Apply>
+    void finish(Apply&& apply)
+    {
+        process(durationFrames, apply);
+    }
+
+private:
+    Kind kinds[numParameters];
+    float from[numParameters];
+    float to[numParameters];
+    bool morphing[numParameters];
+    uint32_t timeFrames = 0;
+    uint32_t durationFrames = 0;
+    uint32_t elapsedFrames = 0;
+    bool active = false;
+
+    // smoothstep of the elapsed time, easing in and out so the morph does not start or end with a sudden change
+    float getPosition() const noexcept
+    {
+        if (durationFrames == 0)
+            return 1.f;
+
+        const float t = static_cast<float>(elapsedFrames) / static_cast<float>(durationFrames);
+        return t * t * (3.f - 2.f * t);
+    }
+
+    float valueAt(const uint index, const float position) const noexcept
+    {
+        const float a = from[index];
+        const float b = to[index];
+
+        switch (kinds[index])
+        {
+        case kKindLogarithmic:
+            // only between positive values, linear otherwise
+            if (a > 0.f && b > 0.f)
+                return a * std::pow(b / a, position);
+            break;
+        case kKindInteger:
+            return std::round(a + (b - a) * position);
+        case kKindToggle:
+            return position < 0.5f ? a : b;
+        case kKindLinear:
+            break;
+        }
+
+        return a + (b - a) * position;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
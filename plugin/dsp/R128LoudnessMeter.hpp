@@ -0,0 +1,377 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "ChannelLayout.hpp"
+#include "LoudnessMeter.hpp"
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   EBU R128 / ITU-R BS.1770 loudness meter working on 100ms sub-blocks, for stereo or one of the ChannelLayout ones.
+
+   K-weighted energy is accumulated per sample into the current sub-block, everything else runs once per sub-block:
+    - momentary loudness, from the last 4 sub-blocks (400ms)
+    - short-term loudness, from the last 30 sub-blocks (3s)
+    - gated integrated loudness, using the momentary blocks (400ms with 75% overlap) as gating blocks
+
+   Integrated loudness keeps a histogram of gating blocks (0.1 LU bins, energies kept exact per bin),
+   so it can run for any amount of time with constant memory and cost.
+   The only approximation is the relative gate threshold, which snaps to the bin grid.
+
+   Channels are K-weighted side by side (see KWeightingFilterLanes) and summed with their BS.1770 weights.
+
+   Like LoudnessMeter, it can optionally apply an input gain before measuring, smoothed the same way as faust's si.smoo.
+   There are no allocations, all buffers are fixed-size.
+ */
+template <uint kNumChannels>
+class R128LoudnessMeterBase
+{
+    static_assert(ChannelLayout::isSupported(kNumChannels), "supported channel layout");
+
+public:
+    static constexpr const uint kMomentarySubBlocks = 4;
+    static constexpr const uint kShortTermSubBlocks = 30;
+
+    R128LoudnessMeterBase(const double sampleRate, const bool smoothInputGain = false)
+        : useInputGain(smoothInputGain)
+    {
+        for (uint c = 0; c < kNumChannels; ++c)
+            weights[c] = ChannelLayout::getLoudnessWeight(kNumChannels, c);
+
+        setSampleRate(sampleRate);
+    }
+
+    /**
+       Change the sample rate, resetting the meter.
+     */
+    void setSampleRate(const double sampleRate) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        subBlockSize = std::max<uint32_t>(1, static_cast<uint32_t>(std::lrint(0.1 * sampleRate)));
+        gainPole = static_cast<float>(std::exp(-1.0 / (0.005 * sampleRate)));
+
+        kfilter.setSampleRate(sampleRate);
+
+        reset();
+    }
+
+    /**
+       Clear all the meter history, including integrated loudness.
+     */
+    void reset() noexcept
+    {
+        std::memset(subBlocks, 0, sizeof(subBlocks));
+        subBlockIndex = 0;
+        subBlockEnergy = 0.0;
+        subBlockRemaining = subBlockSize;
+        gain = useInputGain ? 0.f : 1.f;
+        momentary = shortTerm = kLoudnessFloor;
+
+        kfilter.reset();
+
+        resetIntegrated();
+    }
+
+    /**
+       Clear the integrated loudness measurement only.
+     */
+    void resetIntegrated() noexcept
+    {
+        std::memset(histogramEnergies, 0, sizeof(histogramEnergies));
+        std::memset(histogramCounts, 0, sizeof(histogramCounts));
+        numSubBlocksSeen = 0;
+        integrated = kLoudnessFloor;
+    }
+
+    /**
+       Set the (linear) gain to apply before measuring.
+       Only used if the meter was created with @a smoothInputGain.
+     */
+    void setInputGain(const float value) noexcept
+    {
+        targetGain = value;
+    }
+
+    /**
+       Process a block of audio, with kNumChannels buffers in @a channels.
+     */
+    void process(const float* const* const channels, uint32_t frames) noexcept
+    {
+        const float gainCoef = useInputGain ? gainPole : 1.f;
+        const float gainTarget = useInputGain ? targetGain * (1.f - gainPole) : 0.f;
+
+        const float* ins[kNumChannels];
+        for (uint c = 0; c < kNumChannels; ++c)
+            ins[c] = channels[c];
+
+        while (frames != 0)
+        {
+            const uint32_t todo = std::min(frames, subBlockRemaining);
+
+            float g = gain;
+            double energy = 0.0;
+
+            for (uint32_t i = 0; i < todo; ++i)
+            {
+                g = gainTarget + gainCoef * g;
+
+                float x[kNumChannels];
+                for (uint c = 0; c < kNumChannels; ++c)
+                    x[c] = ins[c][i] * g;
+
+                kfilter.process(x);
+
+                float sum = 0.f;
+                for (uint c = 0; c < kNumChannels; ++c)
+                    sum += weights[c] * x[c] * x[c];
+
+                energy += sum;
+            }
+
+            gain = g;
+            subBlockEnergy += energy;
+            frames -= todo;
+
+            for (uint c = 0; c < kNumChannels; ++c)
+                ins[c] += todo;
+
+            if ((subBlockRemaining -= todo) == 0)
+                finishSubBlock();
+        }
+    }
+
+    /**
+       Stereo version of the above.
+     */
+    void process(const float* const left, const float* const right, const uint32_t frames) noexcept
+    {
+        static_assert(kNumChannels == 2, "stereo meter");
+
+        const float* const channels[2] = { left, right };
+        process(channels, frames);
+    }
+
+    /**
+       Get the momentary loudness (400ms), in LUFS.
+     */
+    float getMomentaryLoudness() const noexcept
+    {
+        return momentary;
+    }
+
+    /**
+       Get the short-term loudness (3s), in LUFS.
+     */
+    float getShortTermLoudness() const noexcept
+    {
+        return shortTerm;
+    }
+
+    /**
+       Get the gated integrated loudness since the last reset, in LUFS.
+     */
+    float getIntegratedLoudness() const noexcept
+    {
+        return integrated;
+    }
+
+    /**
+       Runtime state of the meter, that is everything that changes while processing.
+       Coefficients and sizes derived from the sample rate are not part of it,
+       a state can only be restored into a meter running at the same sample rate.
+     */
+    struct State;
+
+    /**
+       Copy the current runtime state into @a state.
+     */
+    void saveState(State& state) const noexcept
+    {
+        std::memcpy(state.filterState1, kfilter.s1, sizeof(state.filterState1));
+        std::memcpy(state.filterState2, kfilter.s2, sizeof(state.filterState2));
+        std::memcpy(state.subBlocks, subBlocks, sizeof(state.subBlocks));
+        std::memcpy(state.histogramEnergies, histogramEnergies, sizeof(state.histogramEnergies));
+        std::memcpy(state.histogramCounts, histogramCounts, sizeof(state.histogramCounts));
+        state.subBlockEnergy = subBlockEnergy;
+        state.subBlockIndex = subBlockIndex;
+        state.subBlockRemaining = subBlockRemaining;
+        state.numSubBlocksSeen = numSubBlocksSeen;
+        state.momentary = momentary;
+        state.shortTerm = shortTerm;
+        state.integrated = integrated;
+        state.gain = gain;
+        state.reserved = 0;
+    }
+
+    /**
+       Continue from a runtime state previously saved with saveState, at the same sample rate.
+       A state with out of range positions (from a different sample rate, or corrupted) resets the meter instead,
+       returning false.
+     */
+    bool restoreState(const State& state) noexcept
+    {
+        if (state.subBlockIndex >= kShortTermSubBlocks ||
+            state.subBlockRemaining == 0 || state.subBlockRemaining > subBlockSize ||
+            state.numSubBlocksSeen > kMomentarySubBlocks)
+        {
+            reset();
+            return false;
+        }
+
+        std::memcpy(kfilter.s1, state.filterState1, sizeof(state.filterState1));
+        std::memcpy(kfilter.s2, state.filterState2, sizeof(state.filterState2));
+        std::memcpy(subBlocks, state.subBlocks, sizeof(state.subBlocks));
+        std::memcpy(histogramEnergies, state.histogramEnergies, sizeof(state.histogramEnergies));
+        std::memcpy(histogramCounts, state.histogramCounts, sizeof(state.histogramCounts));
+        subBlockEnergy = state.subBlockEnergy;
+        subBlockIndex = state.subBlockIndex;
+        subBlockRemaining = state.subBlockRemaining;
+        numSubBlocksSeen = state.numSubBlocksSeen;
+        momentary = state.momentary;
+        shortTerm = state.shortTerm;
+        integrated = state.integrated;
+        gain = state.gain;
+        return true;
+    }
+
+private:
+    // value reported when there is nothing to measure, matching the lufs meter range
+    static constexpr const float kLoudnessFloor = -70.f;
+
+    // histogram of gating block loudness, from the absolute gate up to +5 LUFS in 0.1 LU steps
+    static constexpr const float kHistogramMin = -70.f;
+    static constexpr const float kHistogramStep = 0.1f;
+    static constexpr const uint kHistogramSize = 750;
+
+public:
+    // plain data, so it can be stored as bytes (see WarmState.hpp), its size is a multiple of 8
+    struct State {
+        double subBlocks[kShortTermSubBlocks];
+        double subBlockEnergy;
+        double histogramEnergies[kHistogramSize];
+        uint64_t histogramCounts[kHistogramSize];
+        float filterState1[2][kNumChannels];
+        float filterState2[2][kNumChannels];
+        uint32_t subBlockIndex;
+        uint32_t subBlockRemaining;
+        uint32_t numSubBlocksSeen;
+        float momentary;
+        float shortTerm;
+        float integrated;
+        float gain;
+        uint32_t reserved;
+    };
+
+private:
+
+    static inline float energyToLoudness(const double meanSquare) noexcept
+    {
+        return 10.f * std::log10(std::max(1e-12, meanSquare)) - 0.691f;
+    }
+
+    void finishSubBlock() noexcept
+    {
+        subBlocks[subBlockIndex] = subBlockEnergy;
+        subBlockEnergy = 0.0;
+        subBlockRemaining = subBlockSize;
+
+        double momentarySum = 0.0, shortTermSum = 0.0;
+
+        for (uint i = 0; i < kShortTermSubBlocks; ++i)
+        {
+            const uint index = (subBlockIndex + kShortTermSubBlocks - i) % kShortTermSubBlocks;
+
+            if (i < kMomentarySubBlocks)
+                momentarySum += subBlocks[index];
+
+            shortTermSum += subBlocks[index];
+        }
+
+        if (++subBlockIndex == kShortTermSubBlocks)
+            subBlockIndex = 0;
+
+        const double momentaryMeanSquare = momentarySum / (kMomentarySubBlocks * subBlockSize);
+
+        momentary = energyToLoudness(momentaryMeanSquare);
+        shortTerm = energyToLoudness(shortTermSum / (kShortTermSubBlocks * subBlockSize));
+
+        // only complete gating blocks count towards integrated loudness
+        if (numSubBlocksSeen < kMomentarySubBlocks && ++numSubBlocksSeen < kMomentarySubBlocks)
+            return;
+
+        // absolute gate
+        if (momentary < kHistogramMin)
+            return;
+
+        const uint bin = std::min(kHistogramSize - 1, static_cast<uint>((momentary - kHistogramMin) / kHistogramStep));
+        histogramEnergies[bin] += momentaryMeanSquare;
+        ++histogramCounts[bin];
+
+        updateIntegrated();
+    }
+
+    void updateIntegrated() noexcept
+    {
+        double energy = 0.0;
+        uint64_t count = 0;
+
+        for (uint i = 0; i < kHistogramSize; ++i)
+        {
+            energy += histogramEnergies[i];
+            count += histogramCounts[i];
+        }
+
+        // relative gate, 10 LU below the absolute-gated loudness
+        const float relativeGate = energyToLoudness(energy / count) - 10.f;
+        const uint firstBin = relativeGate > kHistogramMin
+                            ? static_cast<uint>((relativeGate - kHistogramMin) / kHistogramStep)
+                            : 0;
+
+        energy = 0.0;
+        count = 0;
+
+        for (uint i = firstBin; i < kHistogramSize; ++i)
+        {
+            energy += histogramEnergies[i];
+            count += histogramCounts[i];
+        }
+
+        integrated = count != 0 ? energyToLoudness(energy / count) : kLoudnessFloor;
+    }
+
+    const bool useInputGain;
+
+    KWeightingFilterLanes<kNumChannels> kfilter;
+    float weights[kNumChannels];
+
+    double subBlocks[kShortTermSubBlocks];
+    uint subBlockIndex = 0;
+    double subBlockEnergy = 0.0;
+    uint32_t subBlockSize = 0;
+    uint32_t subBlockRemaining = 0;
+    uint numSubBlocksSeen = 0;
+
+    double histogramEnergies[kHistogramSize];
+    uint64_t histogramCounts[kHistogramSize];
+
+    float momentary = kLoudnessFloor;
+    float shortTerm = kLoudnessFloor;
+    float integrated = kLoudnessFloor;
+
+    float gain = 1.f;
+    float gainPole = 0.f;
+    float targetGain = 1.f;
+
+    DISTRHO_DECLARE_NON_COPYABLE(R128LoudnessMeterBase)
+};
+
+typedef R128LoudnessMeterBase<2> R128LoudnessMeter;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,192 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+#include "FastMath.hpp"
+
+#include <cmath>
+#include <cstring>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   The shelving filter cascade applying the 8 band gains of the mscomp to one channel,
+   shelfcascade in master_me.dsp, with cached coefficients.
+
+   Each crossover edge has 3 svf shelves (ls3/hs3, Q of 0.5, 0.707 and 2) for the band below and the one above it,
+   14 groups of 3 shelves in total. The faust code computes the gain terms of every group for every sample,
+   a pow and a sqrt each, and has 3 divisions in each shelf for every sample.
+   Here the edge frequencies are converted only when the crossover or the sample rate changes,
+   and the shelf coefficients only when a band gain changes, for all groups at once as arrays the compiler vectorizes.
+   Shelves run in the form of the svf without divisions (v1 = a1 ic1 + a2 v3, v2 = ic2 + a2 ic1 + a3 v3),
+   with the output mix folded into 3 coefficients, which leaves a few multiplications and additions per shelf.
+
+   This is the same filter, but rounding differs from the faust code, by about 1e-6 at most,
+   see bench/shelfcascadecheck.cpp.
+ */
+class ShelfCascade
+{
+public:
+    static constexpr const uint32_t kNumBands = 8;
+    static constexpr const uint32_t kNumEdges = kNumBands - 1;
+
+    explicit ShelfCascade(const double sampleRate)
+    {
+        // band 0 low shelf on edge 0, each middle band inverted below and regular above, band 7 high shelf on edge 6
+        for (uint32_t b = 1; b < kNumEdges; ++b)
+        {
+            groupBands[2 * b - 1] = groupBands[2 * b] = b;
+            groupSigns[2 * b - 1] = -1.f;
+        }
+        groupBands[kNumGroups - 1] = kNumEdges;
+        groupHigh[kNumGroups - 1] = true;
+
+        setSampleRate(sampleRate);
+        reset();
+    }
+
+    /**
+       Change the sample rate, with the same clamping as the faust dsp.
+       Resets the filters.
+     */
+    void setSampleRate(const double sampleRate)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        piOverSampleRate = 3.14159274f / std::min<float>(192000.0f, std::max<float>(1.0f, float(sampleRate)));
+        updateEdges();
+        reset();
+    }
+
+    /**
+       Set the lowest and highest crossover frequencies, the 5 others are spread logarithmically in between.
+       Does nothing if both stay the same.
+     */
+    void setCrossover(const float low, const float high) noexcept
+    {
+        if (low == lowFrequency && high == highFrequency)
+            return;
+
+        lowFrequency = low;
+        highFrequency = high;
+        updateEdges();
+    }
+
+    void reset() noexcept
+    {
+        std::memset(ic1, 0, sizeof(ic1));
+        std::memset(ic2, 0, sizeof(ic2));
+    }
+
+    /**
+       Process one sample, with the gain of each band in dB from low to high, as given by the mscomp.
+     */
+    float process(float x, const float gains[kNumBands]) noexcept
+    {
+        if (! valid || std::memcmp(gains, lastGains, sizeof(lastGains)) != 0)
+            updateCoefficients(gains);
+
+        for (uint32_t g = 0; g < kNumGroups; ++g)
+        {
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                const float v3 = x - ic2[i][g];
+                const float v1 = a1[i][g] * ic1[i][g] + a2[i][g] * v3;
+                const float v2 = ic2[i][g] + a2[i][g] * ic1[i][g] + a3[i][g] * v3;
+                ic1[i][g] = 2.0f * v1 - ic1[i][g];
+                ic2[i][g] = 2.0f * v2 - ic2[i][g];
+                x = m0[i][g] * x + m1[i][g] * v1 + m2[i][g] * v2;
+            }
+        }
+
+        return x;
+    }
+
+private:
+    static constexpr const uint32_t kNumGroups = 2 * kNumEdges;
+
+    // k (1/Q) of the 3 shelves in a group
+    static constexpr const float kK[3] = { 2.0f, 1.41442716f, 0.5f };
+
+    float piOverSampleRate = 0.f;
+    float lowFrequency = 60.f;
+    float highFrequency = 8000.f;
+
+    // per group: band, sign of its gain, high or low shelf, tan(pi f / SR) of its edge
+    uint32_t groupBands[kNumGroups] = {};
+    float groupSigns[kNumGroups] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+    bool groupHigh[kNumGroups] = {};
+    float groupG[kNumGroups];
+
+    // gain dependent, valid while gains are the same
+    bool valid = false;
+    float lastGains[kNumBands];
+    float a1[3][kNumGroups], a2[3][kNumGroups], a3[3][kNumGroups];
+    float m0[3][kNumGroups], m1[3][kNumGroups], m2[3][kNumGroups];
+
+    // state of each shelf
+    float ic1[3][kNumGroups];
+    float ic2[3][kNumGroups];
+
+    // LogArray(B-1,fl,fh) in master_me.dsp, as faust computes it
+    void updateEdges() noexcept
+    {
+        const float low = std::max<float>(1.1920929e-07f, lowFrequency);
+        const float ratio = std::pow(std::max<float>(1.1920929e-07f, highFrequency) / low, 0.166666672f);
+
+        float edges[kNumEdges];
+        edges[0] = std::tan(piOverSampleRate * low);
+
+        float power = ratio;
+        for (uint32_t e = 1; e < kNumEdges; ++e)
+        {
+            edges[e] = std::tan(piOverSampleRate * low * power);
+            power *= ratio;
+        }
+
+        groupG[0] = edges[0];
+        for (uint32_t b = 1; b < kNumEdges; ++b)
+        {
+            groupG[2 * b - 1] = edges[b - 1];
+            groupG[2 * b] = edges[b];
+        }
+        groupG[kNumGroups - 1] = edges[kNumEdges - 1];
+
+        valid = false;
+    }
+
+    // fi.svf.ls and fi.svf.hs: A = 10^(gain/40), g = tan(pi f / SR) divided (ls) or multiplied (hs) by sqrt(A)
+    void updateCoefficients(const float gains[kNumBands]) noexcept
+    {
+        valid = true;
+        std::memcpy(lastGains, gains, sizeof(lastGains));
+
+        for (uint32_t g = 0; g < kNumGroups; ++g)
+        {
+            // ls3/hs3 split the gain over 3 shelves, log2(10) / 120
+            const float gain = groupSigns[g] * gains[groupBands[g]] * 0.0276827341f;
+            const float a = master_me_fast_exp2f(gain);
+            const float tg = groupG[g] * master_me_fast_exp2f(groupHigh[g] ? 0.5f * gain : -0.5f * gain);
+
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                a1[i][g] = 1.0f / (1.0f + tg * (tg + kK[i]));
+                a2[i][g] = tg * a1[i][g];
+                a3[i][g] = tg * a2[i][g];
+                m0[i][g] = groupHigh[g] ? a * a : 1.0f;
+                m1[i][g] = groupHigh[g] ? kK[i] * (1.0f - a) * a : kK[i] * (a - 1.0f);
+                m2[i][g] = groupHigh[g] ? 1.0f - a * a : a * a - 1.0f;
+            }
+        }
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(ShelfCascade)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,126 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cmath>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Silence detector for any number of channels, used for skipping all processing while the input stays silent.
+
+   Silence means every sample is below kThreshold (-120 dBFS), which covers digital silence and very low dither.
+   Processing can only be skipped after the input has been silent for kHoldSeconds, long enough for every
+   envelope, filter and loudness window of the plugin to settle, and when the output has decayed to silence too.
+   The caller checks the latter with isSilent() on the processed output.
+
+   As soon as a block contains any signal, isSettled() becomes false and full processing resumes from that block.
+
+   Any latency (delay lines) in the processing is added to the hold time with setLatency(),
+   so that delayed audio is fully flushed out before processing stops.
+ */
+class SilenceDetector
+{
+public:
+    static constexpr const float kThreshold = 1e-6f;
+    static constexpr const double kHoldSeconds = 5.0;
+
+    SilenceDetector(const double sampleRate) noexcept
+    {
+        setSampleRate(sampleRate);
+    }
+
+    /**
+       Change the sample rate, resetting the detector.
+     */
+    void setSampleRate(const double sampleRate) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        baseHoldFrames = static_cast<uint64_t>(kHoldSeconds * sampleRate);
+        holdFrames = baseHoldFrames + latency;
+        reset();
+    }
+
+    /**
+       Set the processing latency in frames, which is added to the hold time.
+     */
+    void setLatency(const uint32_t frames) noexcept
+    {
+        latency = frames;
+        holdFrames = baseHoldFrames + latency;
+        silentFrames = std::min(holdFrames, silentFrames);
+    }
+
+    void reset() noexcept
+    {
+        silentFrames = 0;
+    }
+
+    /**
+       Check a block of input, returning true if it is silent.
+     */
+    bool process(const float* const* const channels, const uint numChannels, const uint32_t frames) noexcept
+    {
+        return processPeak(getPeak(channels, numChannels, frames), frames);
+    }
+
+    /**
+       Same as process(), for a block whose peak level the caller has measured already.
+     */
+    bool processPeak(const float peak, const uint32_t frames) noexcept
+    {
+        if (! (peak < kThreshold))
+        {
+            silentFrames = 0;
+            return false;
+        }
+
+        silentFrames = std::min(holdFrames, silentFrames + frames);
+        return true;
+    }
+
+    /**
+       Whether the input has been silent for long enough to skip processing.
+     */
+    bool isSettled() const noexcept
+    {
+        return silentFrames >= holdFrames;
+    }
+
+    static bool isSilent(const float* const* const channels, const uint numChannels, const uint32_t frames) noexcept
+    {
+        return getPeak(channels, numChannels, frames) < kThreshold;
+    }
+
+    static float getPeak(const float* const* const channels, const uint numChannels, const uint32_t frames) noexcept
+    {
+        // no early exit, so this can be vectorized
+        float peak = 0.f;
+
+        for (uint c = 0; c < numChannels; ++c)
+        {
+            const float* const in = channels[c];
+
+            for (uint32_t i = 0; i < frames; ++i)
+                peak = std::max(peak, std::abs(in[i]));
+        }
+
+        return peak;
+    }
+
+private:
+    uint64_t baseHoldFrames = 0;
+    uint64_t holdFrames = 0;
+    uint32_t latency = 0;
+    uint64_t silentFrames = 0;
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
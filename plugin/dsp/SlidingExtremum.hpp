@@ -0,0 +1,131 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <functional>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Sliding window maximum (or minimum) using a monotonic deque, as described by Daniel Lemire in
+   "Streaming Maximum-Minimum Filter Using No More than Three Comparisons per Element".
+
+   Only the values that can still become the extreme of the window are kept, in order, so the cost per sample is
+   constant (amortized) whatever the window length, unlike faust's ba.slidingMax whose cost grows with it.
+
+   Memory for the largest window is allocated up-front with setMaxWindowSize, the window size itself can then be
+   changed at any time without allocations.
+ */
+template <class Compare>
+class SlidingExtremum
+{
+public:
+    SlidingExtremum() noexcept {}
+
+    ~SlidingExtremum()
+    {
+        delete[] entries;
+    }
+
+    /**
+       Allocate memory for windows of up to @a size samples, resetting the current state.
+       Does nothing if the current allocation is already big enough, must not be called from the audio thread.
+     */
+    void setMaxWindowSize(const uint32_t size)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(size != 0,);
+
+        if (size > capacity)
+        {
+            delete[] entries;
+            entries = new Entry[size];
+            capacity = size;
+        }
+
+        windowSize = std::min(windowSize, capacity);
+        reset();
+    }
+
+    /**
+       Change the window size, clamped to the allocated maximum.
+     */
+    void setWindowSize(const uint32_t size) noexcept
+    {
+        windowSize = std::max<uint32_t>(1, std::min(size, capacity));
+    }
+
+    uint32_t getWindowSize() const noexcept
+    {
+        return windowSize;
+    }
+
+    void reset() noexcept
+    {
+        head = count = 0;
+        counter = 0;
+    }
+
+    /**
+       Push a new value and return the extreme of the last window size values.
+     */
+    inline float process(const float value) noexcept
+    {
+        // drop values that can never be the extreme anymore
+        while (count != 0 && ! compare(entries[back()].value, value))
+            --count;
+
+        // drop values that got out of the window
+        while (count != 0 && counter - entries[head].index >= windowSize)
+        {
+            if (++head == capacity)
+                head = 0;
+            --count;
+        }
+
+        const uint32_t pos = count != 0 ? next(back()) : head;
+        entries[pos].value = value;
+        entries[pos].index = counter++;
+        ++count;
+
+        return entries[head].value;
+    }
+
+private:
+    struct Entry {
+        float value;
+        uint32_t index;
+    };
+
+    Entry* entries = nullptr;
+    uint32_t capacity = 0;
+    uint32_t windowSize = 1;
+    uint32_t head = 0;
+    uint32_t count = 0;
+    uint32_t counter = 0;
+    Compare compare;
+
+    inline uint32_t back() const noexcept
+    {
+        const uint32_t pos = head + count - 1;
+        return pos >= capacity ? pos - capacity : pos;
+    }
+
+    inline uint32_t next(const uint32_t pos) const noexcept
+    {
+        return pos + 1 == capacity ? 0 : pos + 1;
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(SlidingExtremum)
+};
+
+typedef SlidingExtremum<std::greater<float>> SlidingMaximum;
+typedef SlidingExtremum<std::less<float>> SlidingMinimum;
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,129 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cmath>
+#include <cstring>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Stereo true-peak detector, as described in ITU-R BS.1770 annex 2.
+
+   Signal is upsampled 4x with a 48-tap polyphase FIR (12 taps per phase), the true peak being the highest absolute
+   value of all 4 interpolated samples of both channels.
+   The filter is a Kaiser-windowed sinc, with each phase normalized for unity gain at DC.
+
+   Coefficients are stored time-reversed and interleaved by phase, and the history of each channel is kept twice
+   in a row, so that each input sample is multiplied by one group of 4 coefficients and added to 4 accumulators,
+   one per phase. That maps to plain 4-wide multiply-adds with SSE and NEON alike,
+   without the horizontal sums that a dot product per phase would need.
+
+   Output is delayed by kLatency samples compared to the input.
+ */
+class TruePeakDetector
+{
+public:
+    static constexpr const uint kOversampling = 4;
+    static constexpr const uint kTapsPerPhase = 12;
+    static constexpr const uint kLatency = kTapsPerPhase / 2;
+
+    TruePeakDetector() noexcept
+    {
+        constexpr const uint numTaps = kOversampling * kTapsPerPhase;
+        constexpr const double center = (numTaps - 1) * 0.5;
+        constexpr const double beta = 7.0;
+
+        double taps[numTaps];
+
+        for (uint i = 0; i < numTaps; ++i)
+        {
+            const double x = (i - center) / kOversampling;
+            const double sinc = std::abs(x) < 1e-9 ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+            const double w = (i - center) / center;
+            taps[i] = sinc * bessel0(beta * std::sqrt(std::max(0.0, 1.0 - w * w))) / bessel0(beta);
+        }
+
+        for (uint p = 0; p < kOversampling; ++p)
+        {
+            double sum = 0.0;
+            for (uint k = 0; k < kTapsPerPhase; ++k)
+                sum += taps[kOversampling * k + p];
+
+            for (uint k = 0; k < kTapsPerPhase; ++k)
+                coefficients[kTapsPerPhase - 1 - k][p] = taps[kOversampling * k + p] / sum;
+        }
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::memset(history, 0, sizeof(history));
+        position = 0;
+    }
+
+    /**
+       Process one stereo frame, returning the (linear) true peak value found around it.
+     */
+    inline float process(const float left, const float right) noexcept
+    {
+        history[0][position] = history[0][position + kTapsPerPhase] = left;
+        history[1][position] = history[1][position + kTapsPerPhase] = right;
+
+        if (++position == kTapsPerPhase)
+            position = 0;
+
+        const float* const x0 = &history[0][position];
+        const float* const x1 = &history[1][position];
+
+        // both channels in the same loop, so each group of coefficients is loaded once
+        float y0[kOversampling] = {};
+        float y1[kOversampling] = {};
+
+        for (uint k = 0; k < kTapsPerPhase; ++k)
+        {
+            for (uint p = 0; p < kOversampling; ++p)
+            {
+                y0[p] += coefficients[k][p] * x0[k];
+                y1[p] += coefficients[k][p] * x1[k];
+            }
+        }
+
+        float peak = 0.f;
+        for (uint p = 0; p < kOversampling; ++p)
+            peak = std::max(peak, std::max(std::abs(y0[p]), std::abs(y1[p])));
+
+        return peak;
+    }
+
+private:
+    alignas(16) float coefficients[kTapsPerPhase][kOversampling];
+    alignas(16) float history[2][kTapsPerPhase * 2];
+    uint position;
+
+    // zeroth order modified bessel function of the first kind, for the kaiser window
+    static double bessel0(const double x) noexcept
+    {
+        double sum = 1.0, term = 1.0;
+
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(TruePeakDetector)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -1,6 +1,6 @@
 /*
  * DISTRHO Plugin Framework (DPF)
- * Copyright (C) 2012-2022 Filipe Coelho <falktx@falktx.com>
+ * Copyright (C) 2012-2024 Filipe Coelho <falktx@falktx.com>
  *
  * Permission to use, copy, modify, and/or distribute this software for any purpose with
  * or without fee is hereby granted, provided that the above copyright notice and this
@@ -19,31 +19,44 @@
 
 #include "DistrhoUtils.hpp"
 
+#include <atomic>
+
 START_NAMESPACE_DISTRHO
 
 // -----------------------------------------------------------------------
 
+/** Size of a cache line, used for keeping the reader and writer data apart. */
+static constexpr const uint32_t kFloatFifoCacheLineSize = 64;
+
 /**
-  Amount of float/audio samples in the buffer.
+   Float fifo data, meant to be placed in memory shared between the writer and the reader,
+   which can be different processes.
+
+   @a numSamples is the capacity, it must be a power of 2.
+   Positions increment forever and wrap around naturally, so the full capacity can be used.
+
+   Data must be zero-initialized, which shared memory always is, or cleared with FloatFifoControl::clearData.
  */
 template <uint32_t numSamples>
 struct FloatFifo {
-   /**
-      Fifo buffer data.
-    */
-    float buffer[numSamples];
+    static_assert(numSamples != 0 && (numSamples & (numSamples - 1)) == 0, "capacity must be a power of 2");
 
    /**
       Current reading position.
-      Increments when reading.
+      Only written by the reader, increments when reading.
     */
-    uint32_t readPosition;
+    alignas(kFloatFifoCacheLineSize) std::atomic<uint32_t> readPosition;
 
    /**
       Current writing position.
-      Increments when writing.
+      Only written by the writer, increments when writing.
+    */
+    alignas(kFloatFifoCacheLineSize) std::atomic<uint32_t> writePosition;
+
+   /**
+      Fifo buffer data.
     */
-    uint32_t writePosition;
+    alignas(kFloatFifoCacheLineSize) float buffer[numSamples];
 };
 
 // -----------------------------------------------------------------------
@@ -53,13 +66,14 @@ struct FloatFifo {
    FloatFifoControl takes one fifo struct to take control over, and operates over it.
 
    This is meant for single-writer, single-reader type of control.
-   Writing and reading is wait and lock-free.
+   Writing and reading is wait and lock-free, positions are exchanged with acquire/release ordering.
+   When the fifo is full, new values are dropped instead of overwriting unread ones.
 
    Typically usage involves:
    ```
    // definition
-   FloatFifo fifoData;
-   FloatFifoControl fifo;
+   FloatFifo<128> fifoData;
+   FloatFifoControl<128> fifo;
 
    // assign fifo and clear data
    fifo.setFloatFifo(&fifoData, true);
@@ -69,12 +83,13 @@ struct FloatFifo {
    fifo.write(0.5f);
    fifo.write(1.0f);
 
+   // or many at once
+   fifo.writeN(values, numValues);
+
    // reading data
-   if (fifo.readSpace())
-   {
-      const float value = fifo.read();
-      // do something with "value"
-   }
+   float values[128];
+   const uint32_t numValues = fifo.readN(values, 128);
+   // do something with "values"
    ```
 
    @see FloatFifo
@@ -82,6 +97,8 @@ struct FloatFifo {
 template <uint32_t numSamples>
 class FloatFifoControl
 {
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "fifo positions must be lock-free");
+
 public:
     /*
      * Constructor for unitialized float fifo.
@@ -101,7 +118,33 @@ public:
 
     inline bool canRead() const noexcept
     {
-        return fifoPtr != nullptr && fifoPtr->readPosition != fifoPtr->writePosition;
+        return readSpace() != 0;
+    }
+
+    /*
+     * Amount of samples available for reading.
+     * Must only be called from the reader side.
+     */
+    inline uint32_t readSpace() const noexcept
+    {
+        if (fifoPtr == nullptr)
+            return 0;
+
+        return fifoPtr->writePosition.load(std::memory_order_acquire)
+             - fifoPtr->readPosition.load(std::memory_order_relaxed);
+    }
+
+    /*
+     * Amount of samples that can be written without dropping any.
+     * Must only be called from the writer side.
+     */
+    inline uint32_t writeSpace() const noexcept
+    {
+        if (fifoPtr == nullptr)
+            return 0;
+
+        return numSamples - (fifoPtr->writePosition.load(std::memory_order_relaxed)
+                           - fifoPtr->readPosition.load(std::memory_order_acquire));
     }
 
     // -------------------------------------------------------------------
@@ -110,13 +153,15 @@ public:
     /*
      * Clear the entire float fifo data, marking the fifo as empty.
      * Requires a fifo struct tied to this class.
+     * Must not be called while the other side is reading or writing.
      */
     void clearData() noexcept
     {
         DISTRHO_SAFE_ASSERT_RETURN(fifoPtr != nullptr,);
 
-        fifoPtr->readPosition = fifoPtr->writePosition = 0;
         std::memset(fifoPtr->buffer, 0, sizeof(float)*numSamples);
+        fifoPtr->readPosition.store(0, std::memory_order_relaxed);
+        fifoPtr->writePosition.store(0, std::memory_order_release);
     }
 
     // -------------------------------------------------------------------
@@ -138,36 +183,75 @@ public:
 
     /*
      * Read one single sample.
+     * Returns 0 if there is nothing to read.
      */
     float read()
     {
-        DISTRHO_SAFE_ASSERT_RETURN(fifoPtr != nullptr, 0.0f);
+        float value = 0.0f;
+        readN(&value, 1);
+        return value;
+    }
+
+    /*
+     * Read up to @a count samples into @a values, returning the amount read.
+     */
+    uint32_t readN(float* const values, const uint32_t count)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(fifoPtr != nullptr, 0);
+
+        const uint32_t readPosition = fifoPtr->readPosition.load(std::memory_order_relaxed);
+        const uint32_t available = fifoPtr->writePosition.load(std::memory_order_acquire) - readPosition;
+        const uint32_t numRead = std::min(count, available);
 
-        uint32_t readPosition = fifoPtr->readPosition;
-        const float ret = *(fifoPtr->buffer + readPosition);
+        if (numRead == 0)
+            return 0;
 
-        if (++readPosition == numSamples)
-            readPosition = 0;
+        const uint32_t offset = readPosition & (numSamples - 1);
+        const uint32_t firstPart = std::min(numRead, numSamples - offset);
 
-        fifoPtr->readPosition = readPosition;
-        return ret;
+        std::memcpy(values, fifoPtr->buffer + offset, sizeof(float)*firstPart);
+
+        if (firstPart != numRead)
+            std::memcpy(values + firstPart, fifoPtr->buffer, sizeof(float)*(numRead - firstPart));
+
+        fifoPtr->readPosition.store(readPosition + numRead, std::memory_order_release);
+        return numRead;
     }
 
     /*
      * Write one single sample.
+     * Returns false if the fifo is full, in which case the sample is dropped.
      */
-    void write(const float value)
+    bool write(const float value)
     {
-        DISTRHO_SAFE_ASSERT_RETURN(fifoPtr != nullptr,);
+        return writeN(&value, 1) == 1;
+    }
+
+    /*
+     * Write up to @a count samples from @a values, returning the amount written.
+     * Samples that do not fit are dropped.
+     */
+    uint32_t writeN(const float* const values, const uint32_t count)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(fifoPtr != nullptr, 0);
+
+        const uint32_t writePosition = fifoPtr->writePosition.load(std::memory_order_relaxed);
+        const uint32_t space = numSamples - (writePosition - fifoPtr->readPosition.load(std::memory_order_acquire));
+        const uint32_t numWritten = std::min(count, space);
+
+        if (numWritten == 0)
+            return 0;
 
-        uint32_t writePosition = fifoPtr->writePosition;
+        const uint32_t offset = writePosition & (numSamples - 1);
+        const uint32_t firstPart = std::min(numWritten, numSamples - offset);
 
-        *(fifoPtr->buffer + writePosition) = value;
+        std::memcpy(fifoPtr->buffer + offset, values, sizeof(float)*firstPart);
 
-        if (++writePosition == numSamples)
-            writePosition = 0;
+        if (firstPart != numWritten)
+            std::memcpy(fifoPtr->buffer, values + firstPart, sizeof(float)*(numWritten - firstPart));
 
-        fifoPtr->writePosition = writePosition;
+        fifoPtr->writePosition.store(writePosition + numWritten, std::memory_order_release);
+        return numWritten;
     }
 
     // -------------------------------------------------------------------
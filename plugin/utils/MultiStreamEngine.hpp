@@ -0,0 +1,134 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "WorkerPool.hpp"
+#include "ZeroPages.hpp"
+
+#include <memory>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Many independent stereo streams processed by one engine, each one with its own faust dsp instance.
+
+   Meant for servers running one master_me per stream (like radio playout), in a single process.
+   One call to process() runs every stream for the same amount of frames, with the streams spread over a WorkerPool.
+   Streams are split into contiguous shards, one per thread, so each thread keeps working on the same dsp instances
+   and their state stays in that core cache between calls.
+
+   DSP is the faust generated mydsp class (from pregen/Plugin.cpp), parameters are set per stream with
+   getFaustParameterZone(engine.getStream(i), index).
+   Allocations only happen in the constructor and in setSampleRate.
+
+   Parallelism is only across threads: each stream still runs its own compute(), vectorized over time by faust -vec.
+   State is not laid out across streams, so K streams cost K times the work of one on every core they share,
+   and nothing here runs in SIMD lanes across streams. That would need faust to generate the whole graph
+   with a stream dimension in every loop, which it does not do.
+   The scaling with the number of threads has not been measured on a multi-core machine yet, see bench/streambench.cpp.
+ */
+template <class DSP>
+class MultiStreamEngine
+{
+public:
+    MultiStreamEngine(const uint numStreams, const double sampleRate, const uint numThreads)
+        : streams(numStreams),
+          pool(std::max(1u, std::min(numThreads, numStreams)))
+    {
+        setSampleRate(sampleRate);
+    }
+
+    uint getNumStreams() const noexcept
+    {
+        return static_cast<uint>(streams.size());
+    }
+
+    uint getNumThreads() const noexcept
+    {
+        return pool.getNumThreads();
+    }
+
+    /**
+       Access a stream dsp instance, for changing its parameters or reading its meters.
+       Must not be called while processing.
+     */
+    DSP* getStream(const uint index) const noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(index < streams.size(), nullptr);
+
+        return streams[index].get();
+    }
+
+    /**
+       Change the sample rate of all streams, resetting their state and parameters.
+       Every stream gets a new dsp instance, which only takes memory as it gets used (see createFaustDsp),
+       so starting many streams at once is quick and does not go through all of their state.
+     */
+    void setSampleRate(const double sampleRate)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        // each dsp is a few MiB, allocated separately so every stream state is contiguous
+        pool.run(getNumShards(), [this, sampleRate](const uint shard) {
+            for (uint i = getShardStart(shard), end = getShardStart(shard + 1); i < end; ++i)
+                streams[i].reset(createFaustDsp<DSP>(static_cast<int>(sampleRate)));
+        });
+    }
+
+    /**
+       Clear the state of one stream, keeping its parameters.
+       Useful for reusing a stream slot for a new source.
+       Unlike setSampleRate this clears the existing state in place, which the compiler turns into a memset per array.
+     */
+    void reset(const uint index)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(index < streams.size(),);
+
+        streams[index]->instanceClear();
+    }
+
+    /**
+       Process all streams.
+       @a inputs and @a outputs have 2 channels per stream, left and right of stream N at [N * 2] and [N * 2 + 1].
+       Inputs and outputs can use the same buffers.
+     */
+    void process(const float* const* const inputs, float* const* const outputs, const uint32_t frames)
+    {
+        pool.run(getNumShards(), [this, inputs, outputs, frames](const uint shard) {
+            for (uint i = getShardStart(shard), end = getShardStart(shard + 1); i < end; ++i)
+            {
+                float* ins[2] = { const_cast<float*>(inputs[i * 2]), const_cast<float*>(inputs[i * 2 + 1]) };
+                float* outs[2] = { outputs[i * 2], outputs[i * 2 + 1] };
+                streams[i]->compute(static_cast<int>(frames), ins, outs);
+            }
+        });
+    }
+
+private:
+    std::vector<std::unique_ptr<DSP, FaustDspDeleter<DSP>>> streams;
+    WorkerPool pool;
+
+    uint getNumShards() const noexcept
+    {
+        return std::min(pool.getNumThreads(), getNumStreams());
+    }
+
+    // first stream of a shard, remaining streams go one each to the first shards
+    uint getShardStart(const uint shard) const noexcept
+    {
+        const uint numShards = getNumShards();
+        const uint perShard = getNumStreams() / numShards;
+        const uint remainder = getNumStreams() % numShards;
+
+        return shard * perShard + std::min(shard, remainder);
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(MultiStreamEngine)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,296 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <atomic>
+#include <thread>
+
+#if defined(DISTRHO_OS_WINDOWS)
+# define WIN32_LEAN_AND_MEAN
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <winsock2.h>
+# include <windows.h>
+#elif defined(DISTRHO_OS_MAC)
+# include <dispatch/dispatch.h>
+# include <mach/mach.h>
+# include <mach/thread_policy.h>
+# include <pthread.h>
+#else
+# include <pthread.h>
+# include <semaphore.h>
+#endif
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   A single worker thread running one job at a time for the audio thread, which does other work in the meantime.
+
+   Starting a job only posts a semaphore, which is safe to do from the audio thread, unlike condition variables.
+   Waiting for it spins on an atomic instead, since by then the job is usually done or about to be,
+   sleeping would add a wake-up delay each block.
+
+   The audio thread is stuck while waiting, so the worker needs the same real-time scheduling as it has,
+   see matchCallerPriority(), which must be called and succeed before the first job:
+    - Linux and other POSIX systems copy the pthread scheduling policy and priority
+    - macOS copies the mach time-constraint policy that CoreAudio threads have, or the pthread one otherwise;
+      the worker does not join the audio workgroup of the device, plugins have no access to it through DPF
+    - Windows joins the "Pro Audio" MMCSS task, as audio threads of ASIO and WASAPI hosts do,
+      and takes the priority of the caller
+ */
+class PipelineThread
+{
+public:
+    PipelineThread()
+        : thread([this] { workerLoop(); }) {}
+
+    ~PipelineThread()
+    {
+        quit.store(true, std::memory_order_relaxed);
+        wakeSemaphore.post();
+        thread.join();
+    }
+
+    /**
+       Start running @a func() in the worker thread, which must be followed by wait() before starting another job.
+       @a func must stay valid until then.
+     */
+    template <class Func>
+    void start(Func& func) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(priorityMatched,);
+
+        post(func);
+    }
+
+    /**
+       Wait for the job given to start() to finish.
+     */
+    void wait() noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(job.ptr != nullptr,);
+
+        for (uint spins = 0; finishedGeneration.load(std::memory_order_acquire) != generation; ++spins)
+        {
+            if (spins >= kMaxSpinsBeforeYield)
+                std::this_thread::yield();
+        }
+
+        job.ptr = nullptr;
+    }
+
+    /**
+       Give the worker the same scheduling as the calling thread, which must be the one starting jobs.
+       Returns false if that failed, for example without permission for real-time scheduling,
+       the worker must not be used from an audio thread then.
+       Only the first call does the work, later ones return its result.
+     */
+    bool matchCallerPriority() noexcept
+    {
+        if (priorityChecked)
+            return priorityMatched;
+
+        priorityChecked = true;
+
+        // the caller side, looked up here as the worker has no access to it
+        CallerPriority caller;
+       #if defined(DISTRHO_OS_WINDOWS)
+        caller.priority = ::GetThreadPriority(::GetCurrentThread());
+        if (caller.priority == THREAD_PRIORITY_ERROR_RETURN)
+            return false;
+       #else
+        if (::pthread_getschedparam(::pthread_self(), &caller.policy, &caller.param) != 0)
+            return false;
+       #endif
+       #if defined(DISTRHO_OS_MAC)
+        mach_msg_type_number_t count = THREAD_TIME_CONSTRAINT_POLICY_COUNT;
+        boolean_t isDefault = FALSE;
+        caller.timeConstraint = ::thread_policy_get(::pthread_mach_thread_np(::pthread_self()),
+                                                    THREAD_TIME_CONSTRAINT_POLICY,
+                                                    reinterpret_cast<thread_policy_t>(&caller.timeConstraintPolicy),
+                                                    &count, &isDefault) == KERN_SUCCESS && ! isDefault;
+       #endif
+
+        // some of it can only be applied by the worker to itself, so it runs as a job
+        bool matched = false;
+        auto priorityJob = [&caller, &matched] { matched = applyPriority(caller); };
+
+        post(priorityJob);
+        wait();
+        priorityMatched = matched;
+
+        return matched;
+    }
+
+private:
+    static constexpr const uint kMaxSpinsBeforeYield = 1000;
+
+    // wake-up semaphore of the worker, posting never blocks
+    class Semaphore
+    {
+    public:
+        Semaphore() noexcept
+        {
+           #if defined(DISTRHO_OS_WINDOWS)
+            handle = ::CreateSemaphoreA(nullptr, 0, 0x7fffffff, nullptr);
+           #elif defined(DISTRHO_OS_MAC)
+            handle = ::dispatch_semaphore_create(0);
+           #else
+            ::sem_init(&handle, 0, 0);
+           #endif
+        }
+
+        ~Semaphore() noexcept
+        {
+           #if defined(DISTRHO_OS_WINDOWS)
+            ::CloseHandle(handle);
+           #elif defined(DISTRHO_OS_MAC)
+            ::dispatch_release(handle);
+           #else
+            ::sem_destroy(&handle);
+           #endif
+        }
+
+        void post() noexcept
+        {
+           #if defined(DISTRHO_OS_WINDOWS)
+            ::ReleaseSemaphore(handle, 1, nullptr);
+           #elif defined(DISTRHO_OS_MAC)
+            ::dispatch_semaphore_signal(handle);
+           #else
+            ::sem_post(&handle);
+           #endif
+        }
+
+        void wait() noexcept
+        {
+           #if defined(DISTRHO_OS_WINDOWS)
+            ::WaitForSingleObject(handle, INFINITE);
+           #elif defined(DISTRHO_OS_MAC)
+            ::dispatch_semaphore_wait(handle, DISPATCH_TIME_FOREVER);
+           #else
+            // retry if interrupted by a signal
+            while (::sem_wait(&handle) != 0) {}
+           #endif
+        }
+
+    private:
+       #if defined(DISTRHO_OS_WINDOWS)
+        HANDLE handle;
+       #elif defined(DISTRHO_OS_MAC)
+        dispatch_semaphore_t handle;
+       #else
+        sem_t handle;
+       #endif
+
+        DISTRHO_DECLARE_NON_COPYABLE(Semaphore)
+    };
+
+    struct Job {
+        void (*invoke)(void*) = nullptr;
+        void* ptr = nullptr;
+    };
+
+    struct CallerPriority {
+       #if defined(DISTRHO_OS_WINDOWS)
+        int priority;
+       #else
+        int policy;
+        sched_param param;
+       #endif
+       #if defined(DISTRHO_OS_MAC)
+        bool timeConstraint;
+        thread_time_constraint_policy_data_t timeConstraintPolicy;
+       #endif
+    };
+
+    // written by the starting thread only, read by the worker after each wake-up
+    Job job;
+    uint32_t generation = 0;
+    bool priorityChecked = false;
+    bool priorityMatched = false;
+
+    Semaphore wakeSemaphore;
+    std::atomic<uint32_t> finishedGeneration { 0 };
+    std::atomic<bool> quit { false };
+
+    // last, so everything above exists before the worker starts
+    std::thread thread;
+
+    template <class Func>
+    void post(Func& func) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(job.ptr == nullptr,);
+
+        job.invoke = [](void* const ptr) { (*static_cast<Func*>(ptr))(); };
+        job.ptr = &func;
+        ++generation;
+
+        // publishes the job, the worker acquires it through the semaphore
+        wakeSemaphore.post();
+    }
+
+    // worker side of matchCallerPriority
+    static bool applyPriority(const CallerPriority& caller) noexcept
+    {
+       #if defined(DISTRHO_OS_WINDOWS)
+        // below audio priority there is nothing to match
+        if (caller.priority < THREAD_PRIORITY_HIGHEST)
+            return ::SetThreadPriority(::GetCurrentThread(), caller.priority) != FALSE;
+
+        // avrt is loaded at runtime, so the plugin does not need to link to it
+        typedef HANDLE (WINAPI* AvSetMmThreadCharacteristicsFn)(LPCWSTR, LPDWORD);
+
+        if (HMODULE const avrt = ::LoadLibraryW(L"avrt.dll"))
+        {
+            const AvSetMmThreadCharacteristicsFn avSetMmThreadCharacteristics =
+                reinterpret_cast<AvSetMmThreadCharacteristicsFn>(::GetProcAddress(avrt, "AvSetMmThreadCharacteristicsW"));
+
+            DWORD taskIndex = 0;
+            if (avSetMmThreadCharacteristics != nullptr && avSetMmThreadCharacteristics(L"Pro Audio", &taskIndex) != nullptr)
+                return true;
+        }
+
+        return ::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != FALSE;
+       #else
+       #if defined(DISTRHO_OS_MAC)
+        if (caller.timeConstraint)
+        {
+            thread_time_constraint_policy_data_t policy = caller.timeConstraintPolicy;
+            return ::thread_policy_set(::pthread_mach_thread_np(::pthread_self()),
+                                       THREAD_TIME_CONSTRAINT_POLICY,
+                                       reinterpret_cast<thread_policy_t>(&policy),
+                                       THREAD_TIME_CONSTRAINT_POLICY_COUNT) == KERN_SUCCESS;
+        }
+       #endif
+        return ::pthread_setschedparam(::pthread_self(), caller.policy, &caller.param) == 0;
+       #endif
+    }
+
+    void workerLoop() noexcept
+    {
+        for (;;)
+        {
+            wakeSemaphore.wait();
+
+            if (quit.load(std::memory_order_relaxed))
+                break;
+
+            job.invoke(job.ptr);
+
+            finishedGeneration.store(generation, std::memory_order_release);
+        }
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(PipelineThread)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
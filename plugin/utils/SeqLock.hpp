@@ -0,0 +1,83 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <atomic>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Block of float values written by one thread and read by others, protected by a sequence lock.
+
+   The writer never waits: it makes the sequence odd, writes all values and makes it even again.
+   Readers copy the values and retry if the sequence was odd or changed in the meantime,
+   so they always get a consistent snapshot of a single write.
+
+   Meant to be placed in memory shared between processes, everything is lock-free and address-free.
+   Data must be zero-initialized, which shared memory always is.
+ */
+template <uint32_t numValues>
+struct SeqLockFloats {
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "sequence must be lock-free");
+    static_assert(std::atomic<float>::is_always_lock_free, "values must be lock-free");
+
+   /**
+      Incremented before and after each write, odd while writing.
+    */
+    std::atomic<uint32_t> sequence;
+
+   /**
+      Values, accessed with relaxed ordering, the sequence takes care of the rest.
+    */
+    std::atomic<float> values[numValues];
+
+   /**
+      Write all values, from the single writer thread.
+    */
+    void write(const float* const newValues) noexcept
+    {
+        const uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (uint32_t i = 0; i < numValues; ++i)
+            values[i].store(newValues[i], std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+   /**
+      Read a consistent snapshot of all values, returning its sequence number.
+      Gives up after @a maxTries writes happened while reading, returning 0 and leaving @a outValues incomplete.
+      The sequence number can be compared against the previous one to know if anything changed.
+    */
+    uint32_t read(float* const outValues, const uint maxTries = 8) const noexcept
+    {
+        for (uint t = 0; t < maxTries; ++t)
+        {
+            const uint32_t seq = sequence.load(std::memory_order_acquire);
+
+            if (seq & 1)
+                continue;
+
+            for (uint32_t i = 0; i < numValues; ++i)
+                outValues[i] = values[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == seq)
+                return seq;
+        }
+
+        return 0;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,205 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <chrono>
+#include <cmath>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <uint numStages>
+class StageTimes;
+
+/**
+   Realtime-safe timing of the processing stages of an audio block.
+
+   Usage per block is begin(), then mark(stage) right after each stage is done, then finish(frames).
+   The time between two marks goes to the stage of the second one, stages can be marked more than once per block.
+   Stages running in another thread are timed there with a StageTimes, and added to a block with add().
+
+   Every block adds the cost of each stage, in nanoseconds per sample, to a per-stage histogram with
+   kBucketsPerOctave logarithmic buckets, no allocations or sorting needed.
+   Every kReportSeconds the 50th and 99th percentiles are computed from the histograms, which then start over.
+   Results are p50 and p99 for each stage in order, 0 for stages that did not run.
+ */
+template <uint numStages>
+class StageProfiler
+{
+public:
+    static constexpr const double kReportSeconds = 1.0;
+    static constexpr const uint kBucketsPerOctave = 8;
+    static constexpr const uint kNumOctaves = 22;
+    // lowest bucket edge, in nanoseconds per sample
+    static constexpr const double kMinValue = 1.0 / 64;
+
+    StageProfiler(const double sampleRate) noexcept
+    {
+        setSampleRate(sampleRate);
+    }
+
+    void setSampleRate(const double sampleRate) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(sampleRate > 0.0,);
+
+        reportFrames = static_cast<uint32_t>(kReportSeconds * sampleRate);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::memset(buckets, 0, sizeof(buckets));
+        std::memset(numBlocks, 0, sizeof(numBlocks));
+        std::memset(elapsed, 0, sizeof(elapsed));
+        framesSinceReport = 0;
+    }
+
+    inline void begin() noexcept
+    {
+        last = Clock::now();
+    }
+
+    inline void mark(const uint stage) noexcept
+    {
+        const Clock::time_point now = Clock::now();
+        elapsed[stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count();
+        last = now;
+    }
+
+    /**
+       Add the stage times taken in another thread to the current block, resetting them.
+       Must not be called while that thread is still marking them.
+     */
+    void add(StageTimes<numStages>& times) noexcept
+    {
+        for (uint s = 0; s < numStages; ++s)
+            elapsed[s] += times.elapsed[s];
+
+        times.reset();
+    }
+
+    /**
+       Finish a block of @a frames, returning true when new results are available.
+     */
+    bool finish(const uint32_t frames) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(frames != 0, false);
+
+        for (uint s = 0; s < numStages; ++s)
+        {
+            if (elapsed[s] == 0)
+                continue;
+
+            const double value = static_cast<double>(elapsed[s]) / frames;
+            const int bucket = static_cast<int>(std::log2(value / kMinValue) * kBucketsPerOctave);
+
+            ++buckets[s][std::max(0, std::min<int>(kNumBuckets - 1, bucket))];
+            ++numBlocks[s];
+            elapsed[s] = 0;
+        }
+
+        if ((framesSinceReport += frames) < reportFrames)
+            return false;
+
+        for (uint s = 0; s < numStages; ++s)
+        {
+            results[s * 2] = getPercentile(s, 0.5);
+            results[s * 2 + 1] = getPercentile(s, 0.99);
+        }
+
+        reset();
+        return true;
+    }
+
+    /**
+       Latest results, p50 and p99 in nanoseconds per sample for each stage.
+     */
+    const float* getResults() const noexcept
+    {
+        return results;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+    static constexpr const uint kNumBuckets = kBucketsPerOctave * kNumOctaves;
+
+    uint32_t buckets[numStages][kNumBuckets];
+    uint32_t numBlocks[numStages];
+    int64_t elapsed[numStages];
+    float results[numStages * 2] = {};
+
+    Clock::time_point last;
+    uint32_t framesSinceReport = 0;
+    uint32_t reportFrames = 0;
+
+    // geometric center of the bucket containing the percentile
+    float getPercentile(const uint stage, const double percentile) const noexcept
+    {
+        if (numBlocks[stage] == 0)
+            return 0.f;
+
+        const uint32_t rank = static_cast<uint32_t>(percentile * (numBlocks[stage] - 1));
+
+        for (uint b = 0, count = 0; b < kNumBuckets; ++b)
+        {
+            if ((count += buckets[stage][b]) > rank)
+                return static_cast<float>(kMinValue * std::exp2((b + 0.5) / kBucketsPerOctave));
+        }
+
+        return 0.f;
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(StageProfiler)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   The timing part of StageProfiler alone, for stages running in another thread.
+
+   Used the same way, with begin() and mark(stage), the times add up until given to StageProfiler::add().
+ */
+template <uint numStages>
+class StageTimes
+{
+public:
+    StageTimes() noexcept
+    {
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        std::memset(elapsed, 0, sizeof(elapsed));
+    }
+
+    inline void begin() noexcept
+    {
+        last = Clock::now();
+    }
+
+    inline void mark(const uint stage) noexcept
+    {
+        const Clock::time_point now = Clock::now();
+        elapsed[stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count();
+        last = now;
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    int64_t elapsed[numStages];
+    Clock::time_point last;
+
+    friend class StageProfiler<numStages>;
+
+    DISTRHO_DECLARE_NON_COPYABLE(StageTimes)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,194 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "FloatFifo.hpp"
+#include "SeqLock.hpp"
+#include "UdpSender.hpp"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Header of each telemetry export datagram, followed by numMeters meter values,
+   then numLufsIn and numLufsOut histogram values, all as 32-bit floats.
+   Everything is in the byte order of the sending machine, little-endian on all supported ones.
+ */
+struct TelemetryExportHeader {
+    // kTelemetryExportMagic
+    uint32_t magic;
+    // kTelemetryExportVersion, bumped on any change to the datagram layout
+    uint16_t version;
+    uint16_t numMeters;
+    // random, chosen by each instance on creation, so collectors can tell them apart
+    uint32_t instanceId;
+    // incremented on each datagram, for detecting lost ones
+    uint32_t sequence;
+    // NaN and Inf input samples replaced by silence so far, wraps around
+    uint32_t badInputSamples;
+    // histogram values since the previous datagram, one every histogram buffer size
+    uint16_t numLufsIn;
+    uint16_t numLufsOut;
+};
+
+static_assert(sizeof(TelemetryExportHeader) == 24, "telemetry export header has no padding");
+
+static constexpr const uint32_t kTelemetryExportMagic = 0x58544d4d; // "MMTX"
+static constexpr const uint16_t kTelemetryExportVersion = 1;
+
+/**
+   Headless telemetry, sending all meters and histogram values over UDP at a fixed interval, without any UI.
+
+   The audio thread side is the same as for the UI telemetry: meters go in a sequence lock and histogram values
+   in float fifos, both wait-free, with no allocations nor system calls.
+   A separate thread reads them and sends one datagram per interval, meant for collectors gathering data from
+   many instances, which can use the source address or the instance id to tell instances apart.
+   A datagram is sent even if nothing changed, so collectors can also notice instances going away.
+ */
+template <uint numMeters, uint32_t fifoSize>
+class TelemetryExporter
+{
+    static_assert(fifoSize <= 0xffff, "histogram value counts fit in the header");
+
+public:
+    TelemetryExporter()
+        : data(new Data())
+    {
+        lufsInFifo.setFloatFifo(&data->lufsIn);
+        lufsOutFifo.setFloatFifo(&data->lufsOut);
+
+        std::random_device rd;
+        instanceId = rd();
+    }
+
+    ~TelemetryExporter()
+    {
+        stop();
+    }
+
+    /**
+       Start sending to @a destination, as "host:port", every @a intervalMs milliseconds.
+       Needs to resolve @a destination, not meant for the audio thread.
+     */
+    bool start(const char* const destination, const uint intervalMs)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(! thread.joinable(), false);
+        DISTRHO_SAFE_ASSERT_RETURN(intervalMs != 0, false);
+
+        if (! sender.open(destination))
+            return false;
+
+        interval = std::chrono::milliseconds(intervalMs);
+        quit = false;
+        thread = std::thread([this] { exportLoop(); });
+        return true;
+    }
+
+    void stop()
+    {
+        if (! thread.joinable())
+            return;
+
+        {
+            const std::lock_guard<std::mutex> clg(mutex);
+            quit = true;
+        }
+
+        quitCondition.notify_one();
+        thread.join();
+        sender.close();
+    }
+
+   /* -----------------------------------------------------------------------------------------------------------------
+    * audio thread side */
+
+    void writeMeters(const float* const values, const uint32_t badInputSamples) noexcept
+    {
+        data->meters.write(values);
+        data->badInputSamples.store(badInputSamples, std::memory_order_relaxed);
+    }
+
+    void writeHistogram(const float lufsIn, const float lufsOut) noexcept
+    {
+        lufsInFifo.write(lufsIn);
+        lufsOutFifo.write(lufsOut);
+    }
+
+private:
+    struct Data {
+        SeqLockFloats<numMeters> meters;
+        FloatFifo<fifoSize> lufsIn;
+        FloatFifo<fifoSize> lufsOut;
+        std::atomic<uint32_t> badInputSamples;
+    };
+
+    struct Datagram {
+        TelemetryExportHeader header;
+        float values[numMeters + fifoSize * 2];
+    };
+
+    // value-initialized, so zeroed as its members expect
+    const std::unique_ptr<Data> data;
+    FloatFifoControl<fifoSize> lufsInFifo;
+    FloatFifoControl<fifoSize> lufsOutFifo;
+
+    // everything below belongs to the export thread
+    UdpSender sender;
+    Datagram datagram;
+    float lastMeters[numMeters] = {};
+    uint32_t instanceId = 0;
+    uint32_t sequence = 0;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable quitCondition;
+    std::chrono::milliseconds interval;
+    bool quit = false;
+
+    void exportLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (! quitCondition.wait_for(lock, interval, [this] { return quit; }))
+            sendDatagram();
+    }
+
+    void sendDatagram() noexcept
+    {
+        // keep the previous values if the audio thread kept writing while reading
+        if (data->meters.read(datagram.values) != 0)
+            std::memcpy(lastMeters, datagram.values, sizeof(lastMeters));
+        else
+            std::memcpy(datagram.values, lastMeters, sizeof(lastMeters));
+
+        float* const lufsIn = datagram.values + numMeters;
+        const uint32_t numLufsIn = lufsInFifo.readN(lufsIn, fifoSize);
+        const uint32_t numLufsOut = lufsOutFifo.readN(lufsIn + numLufsIn, fifoSize);
+
+        TelemetryExportHeader& header(datagram.header);
+        header.magic = kTelemetryExportMagic;
+        header.version = kTelemetryExportVersion;
+        header.numMeters = numMeters;
+        header.instanceId = instanceId;
+        header.sequence = ++sequence;
+        header.badInputSamples = data->badInputSamples.load(std::memory_order_relaxed);
+        header.numLufsIn = static_cast<uint16_t>(numLufsIn);
+        header.numLufsOut = static_cast<uint16_t>(numLufsOut);
+
+        sender.send(&datagram, sizeof(header) + sizeof(float) * (numMeters + numLufsIn + numLufsOut));
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(TelemetryExporter)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
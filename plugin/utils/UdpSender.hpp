@@ -0,0 +1,183 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cstring>
+#include <string>
+
+#if defined(DISTRHO_OS_WINDOWS)
+# define WIN32_LEAN_AND_MEAN
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <winsock2.h>
+# include <ws2tcpip.h>
+#else
+# include <netdb.h>
+# include <sys/socket.h>
+# include <sys/types.h>
+# include <unistd.h>
+#endif
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Sending side of a UDP socket, tied to a single destination.
+
+   Sending never blocks, datagrams that do not fit in the socket buffer are dropped.
+   Resolving the destination may take a while, open() is not meant for the audio thread, and neither is send().
+ */
+class UdpSender
+{
+public:
+    UdpSender() noexcept {}
+
+    ~UdpSender() noexcept
+    {
+        close();
+    }
+
+    /**
+       Open a socket for sending to @a destination, as "host:port", with host a name, an IPv4 address or
+       an IPv6 address in brackets.
+     */
+    bool open(const char* const destination)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(destination != nullptr && destination[0] != '\0', false);
+
+        close();
+
+        // split at the last colon, IPv6 addresses have them too
+        const char* const sep = std::strrchr(destination, ':');
+        if (sep == nullptr || sep == destination || sep[1] == '\0')
+        {
+            d_stderr("UdpSender::open: invalid destination '%s', expected host:port", destination);
+            return false;
+        }
+
+        std::string host(destination, sep);
+        if (host.size() > 2 && host.front() == '[' && host.back() == ']')
+            host = host.substr(1, host.size() - 2);
+
+       #ifdef DISTRHO_OS_WINDOWS
+        WSADATA wsaData;
+        if (::WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+            return false;
+        wsaStarted = true;
+       #endif
+
+        addrinfo hints = {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_DGRAM;
+
+        addrinfo* addresses = nullptr;
+        if (const int error = ::getaddrinfo(host.c_str(), sep + 1, &hints, &addresses))
+        {
+            d_stderr("UdpSender::open: cannot resolve '%s', %s", destination, ::gai_strerror(error));
+            close();
+            return false;
+        }
+
+        for (addrinfo* addr = addresses; addr != nullptr; addr = addr->ai_next)
+        {
+            fd = ::socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+
+            if (fd == kInvalidSocket)
+                continue;
+
+            // connected, so the destination does not have to be given on every send
+            if (::connect(fd, addr->ai_addr, static_cast<int>(addr->ai_addrlen)) == 0)
+                break;
+
+            closeSocket();
+        }
+
+        ::freeaddrinfo(addresses);
+
+        if (fd == kInvalidSocket)
+        {
+            d_stderr("UdpSender::open: cannot connect to '%s'", destination);
+            close();
+            return false;
+        }
+
+       #ifdef DISTRHO_OS_WINDOWS
+        u_long nonBlocking = 1;
+        ::ioctlsocket(fd, FIONBIO, &nonBlocking);
+       #endif
+
+        return true;
+    }
+
+    void close() noexcept
+    {
+        closeSocket();
+
+       #ifdef DISTRHO_OS_WINDOWS
+        if (wsaStarted)
+        {
+            wsaStarted = false;
+            ::WSACleanup();
+        }
+       #endif
+    }
+
+    bool isOpen() const noexcept
+    {
+        return fd != kInvalidSocket;
+    }
+
+    /**
+       Send one datagram, returning false if it could not be sent right now.
+     */
+    bool send(const void* const data, const size_t size) noexcept
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(fd != kInvalidSocket, false);
+
+       #ifdef DISTRHO_OS_WINDOWS
+        return ::send(fd, static_cast<const char*>(data), static_cast<int>(size), 0) == static_cast<int>(size);
+       #else
+        int flags = MSG_DONTWAIT;
+       #ifdef MSG_NOSIGNAL
+        flags |= MSG_NOSIGNAL;
+       #endif
+        return ::send(fd, data, size, flags) == static_cast<ssize_t>(size);
+       #endif
+    }
+
+private:
+   #ifdef DISTRHO_OS_WINDOWS
+    typedef SOCKET Socket;
+    static constexpr const Socket kInvalidSocket = INVALID_SOCKET;
+    bool wsaStarted = false;
+   #else
+    typedef int Socket;
+    static constexpr const Socket kInvalidSocket = -1;
+   #endif
+
+    Socket fd = kInvalidSocket;
+
+    void closeSocket() noexcept
+    {
+        if (fd == kInvalidSocket)
+            return;
+
+       #ifdef DISTRHO_OS_WINDOWS
+        ::closesocket(fd);
+       #else
+        ::close(fd);
+       #endif
+        fd = kInvalidSocket;
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(UdpSender)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,194 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cstring>
+#include <vector>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Binary snapshot of the runtime state of the plugin (filters, envelopes, loudness windows, leveler gain),
+   so a fresh instance can continue right where another one was, without the usual seconds of warm-up.
+
+   The blob is a small header followed by tagged sections, each holding the raw bytes of one object.
+   Objects are stored as-is, so a blob is only valid for the same build on the same CPU architecture,
+   which size checks on every section and the header catch most of the time.
+   Most of the faust dsp is delay lines sized for the highest sample rate, which stay zero at lower ones,
+   so sections are stored as runs of zero and non-zero 32-bit words, skipping the zeros.
+
+   Writing and reading allocate, neither is meant for the audio thread.
+ */
+class WarmStateWriter
+{
+public:
+    static constexpr const uint32_t kWarmStateMagic = 0x53576d4d; // "MmWS"
+    static constexpr const uint32_t kWarmStateVersion = 1;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t numChannels;
+        uint32_t reserved;
+        double sampleRate;
+    };
+
+    WarmStateWriter(const uint32_t numChannels, const double sampleRate)
+    {
+        Header header;
+        header.magic = kWarmStateMagic;
+        header.version = kWarmStateVersion;
+        header.numChannels = numChannels;
+        header.reserved = 0;
+        header.sampleRate = sampleRate;
+        append(&header, sizeof(header));
+    }
+
+    /**
+       Add a section with the @a size bytes at @a ptr, which must be a multiple of 4.
+     */
+    void addSection(const uint32_t tag, const void* const ptr, const uint32_t size)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(size % sizeof(uint32_t) == 0,);
+
+        const uint32_t sectionHeader[2] = { tag, size };
+        append(sectionHeader, sizeof(sectionHeader));
+
+        const uint8_t* const bytes = static_cast<const uint8_t*>(ptr);
+        const uint32_t numWords = size / sizeof(uint32_t);
+
+        for (uint32_t pos = 0; pos < numWords;)
+        {
+            uint32_t run[2] = { 0, 0 };
+
+            while (pos < numWords && isZero(bytes, pos))
+                ++run[0], ++pos;
+
+            // a single zero word in between literals costs less as a literal than as a new run
+            const uint32_t start = pos;
+            while (pos < numWords && ! (isZero(bytes, pos) && (pos + 1 == numWords || isZero(bytes, pos + 1))))
+                ++pos;
+            run[1] = pos - start;
+
+            append(run, sizeof(run));
+            append(bytes + start * sizeof(uint32_t), run[1] * sizeof(uint32_t));
+        }
+    }
+
+    const std::vector<uint8_t>& getData() const noexcept
+    {
+        return data;
+    }
+
+private:
+    std::vector<uint8_t> data;
+
+    static bool isZero(const uint8_t* const bytes, const uint32_t word) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, bytes + word * sizeof(uint32_t), sizeof(value));
+        return value == 0;
+    }
+
+    void append(const void* const ptr, const size_t size)
+    {
+        const uint8_t* const bytes = static_cast<const uint8_t*>(ptr);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Reader side of WarmStateWriter, decoding sections in the order they were written.
+   Every check failing makes the whole blob invalid, so nothing is restored from a partly broken one.
+ */
+class WarmStateReader
+{
+public:
+    /**
+       Start reading @a size bytes at @a ptr, which must stay valid while reading.
+       Returns false if the blob does not match @a numChannels and @a sampleRate, or is not a warm state at all.
+     */
+    bool open(const void* const ptr, const size_t size, const uint32_t numChannels, const double sampleRate) noexcept
+    {
+        data = static_cast<const uint8_t*>(ptr);
+        end = data + size;
+
+        WarmStateWriter::Header header;
+        if (! read(&header, sizeof(header)))
+            return false;
+
+        return header.magic == WarmStateWriter::kWarmStateMagic &&
+               header.version == WarmStateWriter::kWarmStateVersion &&
+               header.numChannels == numChannels &&
+               d_isEqual(header.sampleRate, sampleRate);
+    }
+
+    /**
+       Decode the next section into @a size bytes at @a ptr, failing if it has a different tag or size.
+       With @a zeroed set the memory at @a ptr must be all zeros already, only the non-zero runs are written then,
+       which keeps untouched zero pages (see ZeroPages.hpp) from being faulted in.
+     */
+    bool readSection(const uint32_t tag, void* const ptr, const uint32_t size, const bool zeroed = false) noexcept
+    {
+        uint32_t sectionHeader[2];
+        if (! read(sectionHeader, sizeof(sectionHeader)))
+            return false;
+        if (sectionHeader[0] != tag || sectionHeader[1] != size)
+            return false;
+
+        uint8_t* const bytes = static_cast<uint8_t*>(ptr);
+        const uint32_t numWords = size / sizeof(uint32_t);
+
+        for (uint32_t pos = 0; pos < numWords;)
+        {
+            uint32_t run[2];
+            if (! read(run, sizeof(run)))
+                return false;
+            if (run[0] + run[1] == 0 || run[0] > numWords - pos || run[1] > numWords - pos - run[0])
+                return false;
+
+            if (! zeroed)
+                std::memset(bytes + pos * sizeof(uint32_t), 0, run[0] * sizeof(uint32_t));
+            pos += run[0];
+
+            if (! read(bytes + pos * sizeof(uint32_t), run[1] * sizeof(uint32_t)))
+                return false;
+            pos += run[1];
+        }
+
+        return true;
+    }
+
+    /**
+       Whether the whole blob has been read, with no trailing data.
+     */
+    bool isAtEnd() const noexcept
+    {
+        return data == end;
+    }
+
+private:
+    const uint8_t* data = nullptr;
+    const uint8_t* end = nullptr;
+
+    bool read(void* const ptr, const size_t size) noexcept
+    {
+        if (static_cast<size_t>(end - data) < size)
+            return false;
+
+        std::memcpy(ptr, data, size);
+        data += size;
+        return true;
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
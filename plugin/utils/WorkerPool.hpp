@@ -0,0 +1,169 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Fixed set of worker threads for running a number of independent tasks in parallel, waiting for all of them to finish.
+
+   The calling thread takes part in the work too, so a pool of N threads only creates N - 1 extra ones.
+   Tasks are taken in order by whichever thread is free, so uneven tasks still spread well across threads.
+
+   Waking up and waiting for the workers uses a mutex and condition variables,
+   so this is meant for offline or server use and not for a plugin audio thread.
+ */
+class WorkerPool
+{
+public:
+    explicit WorkerPool(const uint numThreads)
+    {
+        const uint extraThreads = std::max(1u, numThreads) - 1;
+
+        threads.reserve(extraThreads);
+        for (uint i = 0; i < extraThreads; ++i)
+            threads.emplace_back([this] { workerLoop(); });
+    }
+
+    ~WorkerPool()
+    {
+        {
+            const std::lock_guard<std::mutex> clg(mutex);
+            quit = true;
+        }
+
+        wakeCondition.notify_all();
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    /**
+       Number of threads used for running tasks, including the calling one.
+     */
+    uint getNumThreads() const noexcept
+    {
+        return static_cast<uint>(threads.size()) + 1;
+    }
+
+    /**
+       Run @a func(task) for every task in [0, numTasks), returning once all of them are done.
+       Must not be called from more than one thread at a time.
+     */
+    template <class Func>
+    void run(const uint numTasks, Func&& func)
+    {
+        if (numTasks == 0)
+            return;
+
+        if (threads.empty() || numTasks == 1)
+        {
+            for (uint i = 0; i < numTasks; ++i)
+                func(i);
+            return;
+        }
+
+        {
+            const std::lock_guard<std::mutex> clg(mutex);
+            job.invoke = [](void* const ptr, const uint task) { (*static_cast<Func*>(ptr))(task); };
+            job.ptr = &func;
+            job.numTasks = numTasks;
+            nextTask = 0;
+            finishedTasks = 0;
+            ++generation;
+        }
+
+        wakeCondition.notify_all();
+
+        runTasks(job);
+
+        // wait for the tasks still running and for every worker to be done with this job
+        std::unique_lock<std::mutex> ulk(mutex);
+        doneCondition.wait(ulk, [this, numTasks] { return finishedTasks == numTasks && busyWorkers == 0; });
+        job = Job();
+    }
+
+private:
+    struct Job {
+        void (*invoke)(void*, uint) = nullptr;
+        void* ptr = nullptr;
+        uint numTasks = 0;
+    };
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+
+    // protected by mutex
+    Job job;
+    uint64_t generation = 0;
+    uint busyWorkers = 0;
+    bool quit = false;
+
+    std::atomic<uint> nextTask { 0 };
+    std::atomic<uint> finishedTasks { 0 };
+
+    void runTasks(const Job& current)
+    {
+        for (uint task; (task = nextTask++) < current.numTasks;)
+        {
+            current.invoke(current.ptr, task);
+
+            if (++finishedTasks == current.numTasks)
+            {
+                const std::lock_guard<std::mutex> clg(mutex);
+                doneCondition.notify_all();
+            }
+        }
+    }
+
+    void workerLoop()
+    {
+        uint64_t lastGeneration = 0;
+
+        std::unique_lock<std::mutex> ulk(mutex);
+
+        for (;;)
+        {
+            wakeCondition.wait(ulk, [this, lastGeneration] { return quit || generation != lastGeneration; });
+
+            if (quit)
+                break;
+
+            lastGeneration = generation;
+
+            // woke up too late, the caller already finished this job and might soon reset nextTask for the next one
+            if (job.ptr == nullptr)
+                continue;
+
+            // the caller resets the job only after all busy workers are done with it
+            const Job current = job;
+            ++busyWorkers;
+            ulk.unlock();
+
+            runTasks(current);
+
+            ulk.lock();
+            if (--busyWorkers == 0)
+                doneCondition.notify_all();
+        }
+    }
+
+    DISTRHO_DECLARE_NON_COPYABLE(WorkerPool)
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -0,0 +1,113 @@
+// Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DistrhoUtils.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#ifndef DISTRHO_OS_WINDOWS
+# include <sys/mman.h>
+#endif
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Allocate @a size bytes of zeroed memory straight from the OS, as anonymous private pages.
+
+   The OS maps every page to a shared zero page until first written, so allocating costs no writes
+   and pages never touched are never backed by real memory.
+   Plain calloc only does this for the first few big allocations, glibc raises its mmap threshold after each free
+   so later ones come from the heap and need a full memset.
+   On Windows this is calloc, which uses the same kind of pages (VirtualAlloc) for big allocations.
+
+   Returns null if out of memory, the result must be freed with freeZeroPages using the same @a size.
+ */
+static inline void* allocateZeroPages(const size_t size) noexcept
+{
+   #ifdef DISTRHO_OS_WINDOWS
+    return std::calloc(1, size);
+   #else
+    void* const ptr = ::mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    return ptr != MAP_FAILED ? ptr : nullptr;
+   #endif
+}
+
+static inline void freeZeroPages(void* const ptr, const size_t size) noexcept
+{
+    DISTRHO_SAFE_ASSERT_RETURN(ptr != nullptr,);
+
+   #ifdef DISTRHO_OS_WINDOWS
+    std::free(ptr);
+    // unused
+    (void)size;
+   #else
+    ::munmap(ptr, size);
+   #endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Create a faust dsp instance ready to run at @a sampleRate, same as `new DSP` followed by `init(sampleRate)`.
+
+   faust dsp classes keep all their state as plain member arrays, a few MiB of delay lines and loudness windows
+   for master_me, which instanceClear sets to zero one by one.
+   Here the instance is placed in zero pages instead and instanceClear is skipped, there is nothing left for it to do.
+   Memory then only becomes resident as the dsp reaches into it, and does so in the thread processing the instance.
+   This makes creating many instances at once (like on a playout server failover) close to free.
+
+   A new instance is also how to change the sample rate of an existing one, see FaustGeneratedPlugin::sampleRateChanged.
+
+   There is no "valid since reset" tracking of the history buffers, as the plugin never clears an instance in place:
+   sample rate changes and warm state restores both get a new instance, so clearing is already lazy, per page.
+   The only in-place clear is MultiStreamEngine::reset, explicitly asked for and done with instanceClear.
+   An instance is all zeros (after the constants and parameters) only until its first compute call,
+   code relying on that (WarmStateReader::readSection with zeroed set) must write into it right after creating it.
+
+   Returns null if out of memory, the result must be destroyed with destroyFaustDsp.
+ */
+template <class DSP>
+static inline DSP* createFaustDsp(const int sampleRate) noexcept
+{
+    void* const ptr = allocateZeroPages(sizeof(DSP));
+    DISTRHO_SAFE_ASSERT_RETURN(ptr != nullptr, nullptr);
+
+    // default-initialization, faust classes have no constructor so only the vtable pointer gets written
+    DSP* const dsp = new (ptr) DSP;
+
+    // init() without instanceClear
+    DSP::classInit(sampleRate);
+    dsp->instanceConstants(sampleRate);
+    dsp->instanceResetUserInterface();
+    return dsp;
+}
+
+template <class DSP>
+static inline void destroyFaustDsp(DSP* const dsp) noexcept
+{
+    if (dsp == nullptr)
+        return;
+
+    dsp->~DSP();
+    freeZeroPages(dsp, sizeof(DSP));
+}
+
+/**
+   Deleter for keeping instances from createFaustDsp in a std::unique_ptr.
+ */
+template <class DSP>
+struct FaustDspDeleter {
+    void operator()(DSP* const dsp) const noexcept
+    {
+        destroyFaustDsp(dsp);
+    }
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
@@ -22,25 +22,75 @@
 #include "implot/implot.h"
 #include "src/DistrhoDefines.h"
 
+#include <cstdio>
+
 START_NAMESPACE_DGL
 
 // --------------------------------------------------------------------------------------------------------------------
 
+// timelines that can be picked in the histogram, in seconds
+static constexpr const uint kHistogramTimelines[] = { 30, 60, 300, 600, 1800, 3600 };
+static constexpr const uint kNumHistogramTimelines = sizeof(kHistogramTimelines) / sizeof(kHistogramTimelines[0]);
+
+/**
+   Loudness over time, for the last numSecsInHistogram seconds.
+
+   Besides the ring of values, each series keeps a pyramid of min/max rings, each level with half the points
+   of the previous one, all updated as values come in.
+   Drawing uses the finest level that fits the widget width, so long timelines cost about the same as short ones,
+   the points of a level going up and down between min and max so peaks stay visible.
+
+   The buttons on the bottom right pick one of kHistogramTimelines, changes are reported through Callback.
+ */
 class Histogram : public ImGuiSubWidget
 {
+public:
+    struct Callback {
+        virtual ~Callback() {}
+        virtual void histogramTimelineChanged(Histogram* widget, uint seconds) = 0;
+    };
+
+private:
     ImPlotContext* const context;
+    Callback* callback = nullptr;
 
     uint bufferSize = 0;
     double sampleRate = 0.0;
+    uint numSecsInHistogram = 30;
     int numPointsInDataBuffer = 0;
+    uint numLevels = 0;
+
+    // levels of the pyramid, each one halving the number of points of the previous
+    static constexpr const uint kMaxLevels = 20;
+    // coarser levels are not made once they have less points than this
+    static constexpr const int kMinPointsInLevel = 64;
+
+    struct Level {
+        int head = 0;
+        int written = 0; // up to size
+        int size = 0;
+        uint numTicksInBucket = 0;
+        uint64_t numBuckets = 0; // completed since setup
+        uint pending = 0; // ticks in the bucket being filled
+        float pendingMin = 0.f;
+        float pendingMax = 0.f;
+        float* min = nullptr;
+        float* max = nullptr;
+    };
 
     struct Data {
         int head = 0;
         int written = 0; // up to numPointsInDataBuffer
+        uint64_t numTicks = 0; // since setup
         float* buffer = nullptr;
+        Level levels[kMaxLevels];
+        // what is being drawn, see prepareDraw()
+        uint64_t drawFirstBucket = 0;
+        int drawNumBuckets = 0;
     } dataLufsIn, dataLufsOut;
 
-    static constexpr const uint numSecsInHistogram = 30;
+    // level drawn in the current frame, 0 for the full ring, then pyramid levels starting from 1
+    uint drawLevel = 0;
 
 public:
     explicit Histogram(TopLevelWidget* const parent)
@@ -58,8 +108,8 @@ public:
     ~Histogram() override
     {
         ImPlot::DestroyContext(context);
-        delete[] dataLufsIn.buffer;
-        delete[] dataLufsOut.buffer;
+        freeData(dataLufsIn);
+        freeData(dataLufsOut);
     }
 
     void setup(const uint bufSize, const double srate)
@@ -70,18 +120,9 @@ public:
         if (bufferSize == bufSize && d_isEqual(sampleRate, srate))
             return;
 
-        delete[] dataLufsIn.buffer;
-        delete[] dataLufsOut.buffer;
-
         bufferSize = bufSize;
         sampleRate = srate;
-        numPointsInDataBuffer = (sampleRate / bufSize) * numSecsInHistogram;
-        dataLufsIn.buffer = new float[numPointsInDataBuffer];
-        dataLufsOut.buffer = new float[numPointsInDataBuffer];
-        dataLufsIn.head = dataLufsIn.written = dataLufsOut.head = dataLufsOut.written = 0;
-
-        std::memset(dataLufsIn.buffer, 0, sizeof(float)*numPointsInDataBuffer);
-        std::memset(dataLufsOut.buffer, 0, sizeof(float)*numPointsInDataBuffer);
+        allocateData();
     }
 
     void setSampleRate(const double srate)
@@ -89,6 +130,32 @@ public:
         setup(bufferSize, srate);
     }
 
+    void setCallback(Callback* const cb)
+    {
+        callback = cb;
+    }
+
+    uint getTimeline() const noexcept
+    {
+        return numSecsInHistogram;
+    }
+
+    /**
+       Change how many seconds of history are shown, which clears the current one.
+     */
+    void setTimeline(const uint seconds)
+    {
+        DISTRHO_SAFE_ASSERT_RETURN(seconds != 0,);
+
+        if (numSecsInHistogram == seconds)
+            return;
+
+        numSecsInHistogram = seconds;
+
+        if (bufferSize != 0)
+            allocateData();
+    }
+
     void tick(const bool output, const float value)
     {
         DISTRHO_SAFE_ASSERT_RETURN(numPointsInDataBuffer != 0,);
@@ -102,6 +169,38 @@ public:
 
         if (d.written != numPointsInDataBuffer)
             ++d.written;
+
+        ++d.numTicks;
+
+        for (uint i = 0; i < numLevels; ++i)
+        {
+            Level& l(d.levels[i]);
+
+            if (l.pending++ == 0)
+            {
+                l.pendingMin = l.pendingMax = value;
+            }
+            else
+            {
+                l.pendingMin = std::min(l.pendingMin, value);
+                l.pendingMax = std::max(l.pendingMax, value);
+            }
+
+            if (l.pending != l.numTicksInBucket)
+                continue;
+
+            l.min[l.head] = l.pendingMin;
+            l.max[l.head] = l.pendingMax;
+
+            if (++l.head == l.size)
+                l.head = 0;
+
+            if (l.written != l.size)
+                ++l.written;
+
+            ++l.numBuckets;
+            l.pending = 0;
+        }
     }
 
 protected:
@@ -149,35 +248,190 @@ protected:
             ImPlot::SetupLegend(ImPlotLocation_NorthWest, legendFlags);
             ImPlot::SetupFinish();
 
+            drawLevel = getLevelForWidth(getWidth());
+
             // ImPlot::PlotShadedG("lufs in+out", imPlotIn, this, imPlotOut, this, 0); // std::min(dataLufsIn.written, dataLufsOut.written));
-            ImPlot::PlotLineG("lufs in", imPlotIn, this, dataLufsIn.written);
-            ImPlot::PlotLineG("lufs out", imPlotOut, this, dataLufsOut.written);
+            ImPlot::PlotLineG("lufs in", imPlotIn, this, prepareDraw(dataLufsIn));
+            ImPlot::PlotLineG("lufs out", imPlotOut, this, prepareDraw(dataLufsOut));
 
             ImPlot::EndPlot();
         }
 
+        drawTimelineButtons();
+
         ImGui::End();
     }
 
 private:
+    // one small button per timeline on the bottom right, the current one highlighted
+    void drawTimelineButtons()
+    {
+        const ImGuiStyle& style(ImGui::GetStyle());
+        char labels[kNumHistogramTimelines][8];
+        float width = 0.f;
+
+        for (uint i = 0; i < kNumHistogramTimelines; ++i)
+        {
+            if (kHistogramTimelines[i] < 60)
+                std::snprintf(labels[i], sizeof(labels[i]), "%us", kHistogramTimelines[i]);
+            else
+                std::snprintf(labels[i], sizeof(labels[i]), "%um", kHistogramTimelines[i] / 60);
+
+            width += ImGui::CalcTextSize(labels[i]).x + style.FramePadding.x * 2 + style.ItemSpacing.x;
+        }
+
+        ImGui::SetCursorPos(ImVec2(getWidth() - width - style.ItemSpacing.x,
+                                   getHeight() - ImGui::GetTextLineHeight() - style.ItemSpacing.y * 4));
+
+        for (uint i = 0; i < kNumHistogramTimelines; ++i)
+        {
+            const bool current = kHistogramTimelines[i] == numSecsInHistogram;
+
+            if (i != 0)
+                ImGui::SameLine();
+
+            if (current)
+                ImGui::PushStyleColor(ImGuiCol_Button, style.Colors[ImGuiCol_ButtonActive]);
+
+            if (ImGui::SmallButton(labels[i]) && ! current)
+            {
+                setTimeline(kHistogramTimelines[i]);
+
+                if (callback != nullptr)
+                    callback->histogramTimelineChanged(this, kHistogramTimelines[i]);
+            }
+
+            if (current)
+                ImGui::PopStyleColor();
+        }
+    }
+
+    void allocateData()
+    {
+        freeData(dataLufsIn);
+        freeData(dataLufsOut);
+
+        numPointsInDataBuffer = (sampleRate / bufferSize) * numSecsInHistogram;
+        DISTRHO_SAFE_ASSERT_RETURN(numPointsInDataBuffer > 0,);
+
+        numLevels = 0;
+        while (numLevels < kMaxLevels && (numPointsInDataBuffer >> (numLevels + 1)) >= kMinPointsInLevel)
+            ++numLevels;
+
+        allocateData(dataLufsIn);
+        allocateData(dataLufsOut);
+        drawLevel = 0;
+    }
+
+    void allocateData(Data& d)
+    {
+        d.head = d.written = 0;
+        d.numTicks = 0;
+        d.buffer = new float[numPointsInDataBuffer];
+        std::memset(d.buffer, 0, sizeof(float)*numPointsInDataBuffer);
+
+        for (uint i = 0; i < numLevels; ++i)
+        {
+            Level& l(d.levels[i]);
+            l.head = l.written = 0;
+            l.numTicksInBucket = 2u << i;
+            // one more, buckets are not aligned with the oldest point of the full ring
+            l.size = (numPointsInDataBuffer >> (i + 1)) + 1;
+            l.numBuckets = 0;
+            l.pending = 0;
+            l.min = new float[l.size];
+            l.max = new float[l.size];
+        }
+    }
+
+    static void freeData(Data& d)
+    {
+        delete[] d.buffer;
+        d.buffer = nullptr;
+
+        for (uint i = 0; i < kMaxLevels; ++i)
+        {
+            delete[] d.levels[i].min;
+            delete[] d.levels[i].max;
+            d.levels[i].min = d.levels[i].max = nullptr;
+        }
+    }
+
+    // finest level with no more points than pixels, each min/max pair being drawn over about 1 pixel
+    uint getLevelForWidth(const uint width) const noexcept
+    {
+        uint level = 0;
+        while (level < numLevels && (numPointsInDataBuffer >> level) > static_cast<int>(width))
+            ++level;
+
+        return level;
+    }
+
+    // get the number of points to draw for @a d at drawLevel, setting up the range of buckets to draw
+    int prepareDraw(Data& d) const noexcept
+    {
+        if (drawLevel == 0)
+            return d.written;
+
+        const Level& l(d.levels[drawLevel - 1]);
+        const uint64_t firstTick = d.numTicks - d.written;
+
+        // skip the buckets that started before the oldest point of the full ring
+        const uint64_t firstBucket = std::max<uint64_t>(l.numBuckets - l.written,
+                                                        (firstTick + l.numTicksInBucket - 1) / l.numTicksInBucket);
+
+        d.drawFirstBucket = firstBucket;
+        d.drawNumBuckets = static_cast<int>(l.numBuckets - std::min(firstBucket, l.numBuckets));
+
+        return (d.drawNumBuckets + (l.pending != 0 ? 1 : 0)) * 2;
+    }
+
+    ImPlotPoint getPoint(const Data& d, const int idx) const noexcept
+    {
+        const uint64_t firstTick = d.numTicks - d.written;
+        double tick;
+        float value;
+
+        if (drawLevel == 0)
+        {
+            const uint bufPos = d.written != numPointsInDataBuffer ? idx : (idx + d.head) % numPointsInDataBuffer;
+            tick = firstTick + idx;
+            value = d.buffer[bufPos];
+        }
+        else
+        {
+            const Level& l(d.levels[drawLevel - 1]);
+            const int bucket = idx / 2;
+            const bool second = idx % 2 != 0;
+
+            if (bucket < d.drawNumBuckets)
+            {
+                const uint64_t absBucket = d.drawFirstBucket + bucket;
+                const int bufPos = static_cast<int>((l.head + l.size - static_cast<int>(l.numBuckets - absBucket)) % l.size);
+                tick = absBucket * l.numTicksInBucket + (second ? l.numTicksInBucket / 2 : 0);
+                value = second ? l.max[bufPos] : l.min[bufPos];
+            }
+            else
+            {
+                tick = l.numBuckets * l.numTicksInBucket + (second ? l.pending / 2 : 0);
+                value = second ? l.pendingMax : l.pendingMin;
+            }
+        }
+
+        const double time = (tick - firstTick) / numPointsInDataBuffer * numSecsInHistogram;
+        return { time, value };
+    }
+
     static ImPlotPoint imPlotIn(const int idx, void* const arg)
     {
         Histogram* const self = static_cast<Histogram*>(arg);
-        Data& d(self->dataLufsIn);
-
-        const uint bufPos = d.written != self->numPointsInDataBuffer ? idx : (idx + d.head) % self->numPointsInDataBuffer;
-        const double time = static_cast<double>(idx) / self->numPointsInDataBuffer * numSecsInHistogram;
-        return { time, d.buffer[bufPos] };
+        return self->getPoint(self->dataLufsIn, idx);
     }
 
     static ImPlotPoint imPlotOut(const int idx, void* const arg)
     {
         Histogram* const self = static_cast<Histogram*>(arg);
-        Data& d(self->dataLufsOut);
-
-        const uint bufPos = d.written != self->numPointsInDataBuffer ? idx : (idx + d.head) % self->numPointsInDataBuffer;
-        const double time = static_cast<double>(idx) / self->numPointsInDataBuffer * numSecsInHistogram;
-        return { time, d.buffer[bufPos] };
+        return self->getPoint(self->dataLufsOut, idx);
     }
 };
 
@@ -35,6 +35,12 @@ class InspectorWindow : public ImGuiTopLevelWidget
     QuantumTheme& theme;
     QuantumThemeCallback* const themeChangeCallback;
 
+    const char* const* profileNames = nullptr;
+    const float* profileValues = nullptr;
+    uint numProfileStages = 0;
+
+    const uint32_t* badInputSamples = nullptr;
+
 public:
     bool isOpen = true;
     double userScaling = 1;
@@ -50,6 +56,26 @@ public:
         onResize(ev);
     }
 
+    /**
+       Show per-stage timings, @a values has p50 and p99 for each stage, in ns per sample.
+       Pointers must remain valid for the lifetime of this window, values can change at any time.
+     */
+    void setProfile(const char* const* const names, const float* const values, const uint numStages)
+    {
+        profileNames = names;
+        profileValues = values;
+        numProfileStages = numStages;
+    }
+
+    /**
+       Show the number of broken input samples replaced by silence so far.
+       Pointer must remain valid for the lifetime of this window.
+     */
+    void setBadInputSamples(const uint32_t* const count)
+    {
+        badInputSamples = count;
+    }
+
 protected:
     void onImGuiDisplay() override
     {
@@ -165,6 +191,30 @@ protected:
         changedColors |= ImGui::ColorEdit4("Text Mid", theme.textMidColor.rgba);
         changedColors |= ImGui::ColorEdit4("Text Dark", theme.textDarkColor.rgba);
 
+        if (badInputSamples != nullptr)
+        {
+            ImGui::Separator();
+            ImGui::Text("Broken input samples (NaN/Inf) replaced by silence: %u", *badInputSamples);
+        }
+
+        if (numProfileStages != 0)
+        {
+            ImGui::Separator();
+            ImGui::TextUnformatted("Profile (ns per sample, p50 / p99)");
+
+            float total50 = 0.f;
+            float total99 = 0.f;
+
+            for (uint i = 0; i < numProfileStages; ++i)
+            {
+                ImGui::Text("%-32s %9.2f %9.2f", profileNames[i], profileValues[i * 2], profileValues[i * 2 + 1]);
+                total50 += profileValues[i * 2];
+                total99 += profileValues[i * 2 + 1];
+            }
+
+            ImGui::Text("%-32s %9.2f %9.2f", "total (sum of stages)", total50, total99);
+        }
+
         ImGui::Separator();
         ImGui::TextUnformatted("Widgets");
         displaySubWidget(subwidgets);
@@ -14,7 +14,9 @@
 
 
 #include "DistrhoPlugin.hpp"
-#include "extra/ScopedPointer.hpp"
+#include "utils/ZeroPages.hpp"
+
+#include <memory>
 
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -97,6 +99,8 @@ FAUSTPP_BEGIN_NAMESPACE
 #endif 
 
 FAUSTPP_END_NAMESPACE
+#include "dsp/FastMath.hpp"
+#include "dsp/MscompGainKernel.hpp"
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
@@ -173,81 +177,17 @@ class mydsp : public dsp {
 	float fConst8;
 	float fConst9;
 	float fConst10;
-	float fYec1_perm[4];
 	float fConst11;
 	float fConst13;
 	float fConst14;
-	float fRec25_perm[4];
-	float fRec24_perm[4];
 	float fConst18;
 	float fConst19;
 	float fConst20;
-	float fYec2_perm[4];
 	float fConst21;
-	float fRec23_perm[4];
-	float fRec22_perm[4];
 	FAUSTFLOAT fVbargraph1;
 	float fYec3_perm[4];
-	float fYec4_perm[4];
-	float fRec29_perm[4];
-	float fRec28_perm[4];
-	float fYec5_perm[4];
-	float fRec27_perm[4];
-	float fRec26_perm[4];
 	float fConst23;
 	int iConst24;
-	float fYec6_perm[4];
-	float fYec7_perm[4];
-	float fYec8_perm[8];
-	float fYec9_perm[16];
-	float fYec10[64];
-	int fYec10_idx;
-	int fYec10_idx_save;
-	float fYec11[128];
-	int fYec11_idx;
-	int fYec11_idx_save;
-	float fYec12[256];
-	int fYec12_idx;
-	int fYec12_idx_save;
-	float fYec13[512];
-	int fYec13_idx;
-	int fYec13_idx_save;
-	float fYec14[1024];
-	int fYec14_idx;
-	int fYec14_idx_save;
-	float fYec15[2048];
-	int fYec15_idx;
-	int fYec15_idx_save;
-	float fYec16[4096];
-	int fYec16_idx;
-	int fYec16_idx_save;
-	float fYec17[8192];
-	int fYec17_idx;
-	int fYec17_idx_save;
-	float fYec18[16384];
-	int fYec18_idx;
-	int fYec18_idx_save;
-	float fYec19[32768];
-	int fYec19_idx;
-	int fYec19_idx_save;
-	float fYec20[65536];
-	int fYec20_idx;
-	int fYec20_idx_save;
-	float fYec21[131072];
-	int fYec21_idx;
-	int fYec21_idx_save;
-	float fYec22[262144];
-	int fYec22_idx;
-	int fYec22_idx_save;
-	float fYec23[524288];
-	int fYec23_idx;
-	int fYec23_idx_save;
-	float fYec24[1048576];
-	int fYec24_idx;
-	int fYec24_idx_save;
-	float fYec25[2097152];
-	int fYec25_idx;
-	int fYec25_idx_save;
 	int iConst61;
 	int iConst62;
 	int iConst63;
@@ -285,58 +225,6 @@ class mydsp : public dsp {
 	int iConst95;
 	int iConst96;
 	int iConst97;
-	float fYec26_perm[4];
-	float fYec27_perm[4];
-	float fYec28_perm[8];
-	float fYec29_perm[16];
-	float fYec30[64];
-	int fYec30_idx;
-	int fYec30_idx_save;
-	float fYec31[128];
-	int fYec31_idx;
-	int fYec31_idx_save;
-	float fYec32[256];
-	int fYec32_idx;
-	int fYec32_idx_save;
-	float fYec33[512];
-	int fYec33_idx;
-	int fYec33_idx_save;
-	float fYec34[1024];
-	int fYec34_idx;
-	int fYec34_idx_save;
-	float fYec35[2048];
-	int fYec35_idx;
-	int fYec35_idx_save;
-	float fYec36[4096];
-	int fYec36_idx;
-	int fYec36_idx_save;
-	float fYec37[8192];
-	int fYec37_idx;
-	int fYec37_idx_save;
-	float fYec38[16384];
-	int fYec38_idx;
-	int fYec38_idx_save;
-	float fYec39[32768];
-	int fYec39_idx;
-	int fYec39_idx_save;
-	float fYec40[65536];
-	int fYec40_idx;
-	int fYec40_idx_save;
-	float fYec41[131072];
-	int fYec41_idx;
-	int fYec41_idx_save;
-	float fYec42[262144];
-	int fYec42_idx;
-	int fYec42_idx_save;
-	float fYec43[524288];
-	int fYec43_idx;
-	int fYec43_idx_save;
-	float fYec44[1048576];
-	int fYec44_idx;
-	int fYec44_idx_save;
-	float fYec45[2097152];
-	int fYec45_idx;
-	int fYec45_idx_save;
 	FAUSTFLOAT fVbargraph2;
 	float fYec46_perm[4];
 	float fRec20_perm[4];
@@ -387,7 +275,6 @@ class mydsp : public dsp {
 	float fRec52_perm[4];
 	float fRec54_perm[4];
 	FAUSTFLOAT fVslider6;
-	float fRec55_perm[4];
 	float fYec50_perm[4];
 	float fRec51_perm[4];
 	float fRec56_perm[4];
@@ -399,7 +286,6 @@ class mydsp : public dsp {
 	float fRec57_perm[4];
 	float fRec61_perm[4];
 	FAUSTFLOAT fVslider7;
-	float fRec70_perm[4];
 	FAUSTFLOAT fVslider8;
 	FAUSTFLOAT fVslider9;
 	float fRec66_perm[4];
@@ -407,70 +293,16 @@ class mydsp : public dsp {
 	float fRec62_perm[4];
 	float fRec63_perm[4];
 	int iConst112;
-	float fYec53_perm[4];
-	int iConst114;
-	float fYec54_perm[4];
-	int iConst116;
-	float fYec55_perm[8];
-	int iConst118;
-	int iConst120;
-	float fYec56_perm[16];
-	int iConst122;
-	int iConst124;
-	float fYec57[64];
-	int fYec57_idx;
-	int fYec57_idx_save;
-	int iConst126;
-	int iConst128;
-	float fYec58[128];
-	int fYec58_idx;
-	int fYec58_idx_save;
-	int iConst130;
-	int iConst132;
-	float fYec59[256];
-	int fYec59_idx;
-	int fYec59_idx_save;
-	int iConst134;
-	int iConst136;
-	float fYec60[512];
-	int fYec60_idx;
-	int fYec60_idx_save;
-	int iConst138;
-	int iConst140;
-	float fYec61[1024];
-	int fYec61_idx;
-	int fYec61_idx_save;
-	int iConst142;
-	int iConst144;
-	float fYec62[2048];
-	int fYec62_idx;
-	int fYec62_idx_save;
-	int iConst146;
-	int iConst148;
-	float fYec63[4096];
-	int fYec63_idx;
-	int fYec63_idx_save;
-	int iConst150;
-	int iConst152;
-	float fYec64[8192];
-	int fYec64_idx;
-	int fYec64_idx_save;
-	int iConst154;
-	int iConst156;
-	float fYec65[16384];
-	int fYec65_idx;
-	int fYec65_idx_save;
-	int iConst158;
-	int iConst160;
-	float fYec66[32768];
-	int fYec66_idx;
-	int fYec66_idx_save;
-	int iConst162;
-	int iConst163;
-	float fYec67[65536];
-	int fYec67_idx;
-	int fYec67_idx_save;
-	int iConst164;
+	int iRec51_perm[4];
+	float fRec612_perm[4];
+	float fRec613_perm[4];
+	float fRec614_perm[4];
+	float fRec615_perm[4];
+	float fRec616_perm[4];
+	float fRec617_perm[4];
+	float fRec618_perm[4];
+	float fRec619_perm[4];
+	float fRec620_perm[4];
 	FAUSTFLOAT fVslider10;
 	float fConst165;
 	float fConst166;
@@ -612,6 +444,7 @@ class mydsp : public dsp {
 	int fYec105_idx;
 	int fYec105_idx_save;
 	float fRec10_perm[4];
+	float fRec621_perm[4];
 	FAUSTFLOAT fVbargraph5;
 	float fRec9_perm[4];
 	float fConst231;
@@ -654,6 +487,9 @@ class mydsp : public dsp {
 	FAUSTFLOAT fVslider33;
 	FAUSTFLOAT fVslider34;
 	float fRec87_perm[4];
+#if MASTER_ME_MSCOMP_KERNEL
+	MscompGainKernel fMscompKernel;
+#endif
 	float fRec94_perm[4];
 	float fRec93_perm[4];
 	float fRec92_perm[4];
@@ -959,123 +795,7 @@ class mydsp : public dsp {
 	float fYec106_perm[4];
 	float fRec602_perm[4];
 	FAUSTFLOAT fVbargraph26;
-	float fYec107_perm[4];
-	float fRec606_perm[4];
-	float fRec605_perm[4];
-	float fYec108_perm[4];
-	float fRec604_perm[4];
-	float fRec603_perm[4];
 	float fYec109_perm[4];
-	float fYec110_perm[4];
-	float fRec610_perm[4];
-	float fRec609_perm[4];
-	float fYec111_perm[4];
-	float fRec608_perm[4];
-	float fRec607_perm[4];
-	float fYec112_perm[4];
-	float fYec113_perm[4];
-	float fYec114_perm[8];
-	float fYec115_perm[16];
-	float fYec116[64];
-	int fYec116_idx;
-	int fYec116_idx_save;
-	float fYec117[128];
-	int fYec117_idx;
-	int fYec117_idx_save;
-	float fYec118[256];
-	int fYec118_idx;
-	int fYec118_idx_save;
-	float fYec119[512];
-	int fYec119_idx;
-	int fYec119_idx_save;
-	float fYec120[1024];
-	int fYec120_idx;
-	int fYec120_idx_save;
-	float fYec121[2048];
-	int fYec121_idx;
-	int fYec121_idx_save;
-	float fYec122[4096];
-	int fYec122_idx;
-	int fYec122_idx_save;
-	float fYec123[8192];
-	int fYec123_idx;
-	int fYec123_idx_save;
-	float fYec124[16384];
-	int fYec124_idx;
-	int fYec124_idx_save;
-	float fYec125[32768];
-	int fYec125_idx;
-	int fYec125_idx_save;
-	float fYec126[65536];
-	int fYec126_idx;
-	int fYec126_idx_save;
-	float fYec127[131072];
-	int fYec127_idx;
-	int fYec127_idx_save;
-	float fYec128[262144];
-	int fYec128_idx;
-	int fYec128_idx_save;
-	float fYec129[524288];
-	int fYec129_idx;
-	int fYec129_idx_save;
-	float fYec130[1048576];
-	int fYec130_idx;
-	int fYec130_idx_save;
-	float fYec131[2097152];
-	int fYec131_idx;
-	int fYec131_idx_save;
-	float fYec132_perm[4];
-	float fYec133_perm[4];
-	float fYec134_perm[8];
-	float fYec135_perm[16];
-	float fYec136[64];
-	int fYec136_idx;
-	int fYec136_idx_save;
-	float fYec137[128];
-	int fYec137_idx;
-	int fYec137_idx_save;
-	float fYec138[256];
-	int fYec138_idx;
-	int fYec138_idx_save;
-	float fYec139[512];
-	int fYec139_idx;
-	int fYec139_idx_save;
-	float fYec140[1024];
-	int fYec140_idx;
-	int fYec140_idx_save;
-	float fYec141[2048];
-	int fYec141_idx;
-	int fYec141_idx_save;
-	float fYec142[4096];
-	int fYec142_idx;
-	int fYec142_idx_save;
-	float fYec143[8192];
-	int fYec143_idx;
-	int fYec143_idx_save;
-	float fYec144[16384];
-	int fYec144_idx;
-	int fYec144_idx_save;
-	float fYec145[32768];
-	int fYec145_idx;
-	int fYec145_idx_save;
-	float fYec146[65536];
-	int fYec146_idx;
-	int fYec146_idx_save;
-	float fYec147[131072];
-	int fYec147_idx;
-	int fYec147_idx_save;
-	float fYec148[262144];
-	int fYec148_idx;
-	int fYec148_idx_save;
-	float fYec149[524288];
-	int fYec149_idx;
-	int fYec149_idx_save;
-	float fYec150[1048576];
-	int fYec150_idx;
-	int fYec150_idx_save;
-	float fYec151[2097152];
-	int fYec151_idx;
-	int fYec151_idx_save;
 	FAUSTFLOAT fVbargraph27;
 	float fRec611_perm[4];
 	FAUSTFLOAT fVbargraph28;
@@ -1321,60 +1041,7 @@ class mydsp : public dsp {
 		fConst108 = 0.0f - 1.0f / (fConst105 * fConst107);
 		fConst109 = 1.0f / fConst107;
 		fConst110 = 1.0f - fConst106;
-		int iConst111 = int(std::floor(0.100000001f * fConst0)) % 2;
-		iConst112 = iConst111;
-		int iConst113 = int(std::floor(0.0500000007f * fConst0)) % 2;
-		iConst114 = iConst113;
-		int iConst115 = int(std::floor(0.0250000004f * fConst0)) % 2;
-		iConst116 = iConst115;
-		int iConst117 = iConst111 + 2 * iConst113;
-		iConst118 = iConst117;
-		int iConst119 = int(std::floor(0.0125000002f * fConst0)) % 2;
-		iConst120 = iConst119;
-		int iConst121 = iConst117 + 4 * iConst115;
-		iConst122 = iConst121;
-		int iConst123 = int(std::floor(0.00625000009f * fConst0)) % 2;
-		iConst124 = iConst123;
-		int iConst125 = iConst121 + 8 * iConst119;
-		iConst126 = iConst125;
-		int iConst127 = int(std::floor(0.00312500005f * fConst0)) % 2;
-		iConst128 = iConst127;
-		int iConst129 = iConst125 + 16 * iConst123;
-		iConst130 = iConst129;
-		int iConst131 = int(std::floor(0.00156250002f * fConst0)) % 2;
-		iConst132 = iConst131;
-		int iConst133 = iConst129 + 32 * iConst127;
-		iConst134 = iConst133;
-		int iConst135 = int(std::floor(0.000781250012f * fConst0)) % 2;
-		iConst136 = iConst135;
-		int iConst137 = iConst133 + 64 * iConst131;
-		iConst138 = iConst137;
-		int iConst139 = int(std::floor(0.000390625006f * fConst0)) % 2;
-		iConst140 = iConst139;
-		int iConst141 = iConst137 + 128 * iConst135;
-		iConst142 = iConst141;
-		int iConst143 = int(std::floor(0.000195312503f * fConst0)) % 2;
-		iConst144 = iConst143;
-		int iConst145 = iConst141 + 256 * iConst139;
-		iConst146 = iConst145;
-		int iConst147 = int(std::floor(9.76562515e-05f * fConst0)) % 2;
-		iConst148 = iConst147;
-		int iConst149 = iConst145 + 512 * iConst143;
-		iConst150 = iConst149;
-		int iConst151 = int(std::floor(4.88281257e-05f * fConst0)) % 2;
-		iConst152 = iConst151;
-		int iConst153 = iConst149 + 1024 * iConst147;
-		iConst154 = iConst153;
-		int iConst155 = int(std::floor(2.44140629e-05f * fConst0)) % 2;
-		iConst156 = iConst155;
-		int iConst157 = iConst153 + 2048 * iConst151;
-		iConst158 = iConst157;
-		int iConst159 = int(std::floor(1.22070314e-05f * fConst0)) % 2;
-		iConst160 = iConst159;
-		int iConst161 = iConst157 + 4096 * iConst155;
-		iConst162 = iConst161;
-		iConst163 = int(std::floor(6.10351572e-06f * fConst0)) % 2;
-		iConst164 = iConst161 + 8192 * iConst159;
+		iConst112 = std::max<int>(1, int(std::ceil(0.125f * std::min<float>(19200.0f, 0.100000001f * fConst0))));
 		fConst165 = std::exp(0.0f - 3.33333325f / fConst0);
 		fConst166 = std::exp(0.0f - 20.0f / fConst0);
 		float fConst167 = std::rint(0.400000006f * fConst0);
@@ -1509,6 +1176,9 @@ class mydsp : public dsp {
 	}
 	
 	FAUSTPP_VIRTUAL void instanceClear() {
+#if MASTER_ME_MSCOMP_KERNEL
+		fMscompKernel.reset();
+#endif
 		for (int l0 = 0; l0 < 4; l0 = l0 + 1) {
 			fRec0_perm[l0] = 0.0f;
 		}
@@ -1548,229 +1218,9 @@ class mydsp : public dsp {
 		for (int l12 = 0; l12 < 4; l12 = l12 + 1) {
 			fRec21_perm[l12] = 0.0f;
 		}
-		for (int l13 = 0; l13 < 4; l13 = l13 + 1) {
-			fYec1_perm[l13] = 0.0f;
-		}
-		for (int l14 = 0; l14 < 4; l14 = l14 + 1) {
-			fRec25_perm[l14] = 0.0f;
-		}
-		for (int l15 = 0; l15 < 4; l15 = l15 + 1) {
-			fRec24_perm[l15] = 0.0f;
-		}
-		for (int l16 = 0; l16 < 4; l16 = l16 + 1) {
-			fYec2_perm[l16] = 0.0f;
-		}
-		for (int l17 = 0; l17 < 4; l17 = l17 + 1) {
-			fRec23_perm[l17] = 0.0f;
-		}
-		for (int l18 = 0; l18 < 4; l18 = l18 + 1) {
-			fRec22_perm[l18] = 0.0f;
-		}
 		for (int l19 = 0; l19 < 4; l19 = l19 + 1) {
 			fYec3_perm[l19] = 0.0f;
 		}
-		for (int l20 = 0; l20 < 4; l20 = l20 + 1) {
-			fYec4_perm[l20] = 0.0f;
-		}
-		for (int l21 = 0; l21 < 4; l21 = l21 + 1) {
-			fRec29_perm[l21] = 0.0f;
-		}
-		for (int l22 = 0; l22 < 4; l22 = l22 + 1) {
-			fRec28_perm[l22] = 0.0f;
-		}
-		for (int l23 = 0; l23 < 4; l23 = l23 + 1) {
-			fYec5_perm[l23] = 0.0f;
-		}
-		for (int l24 = 0; l24 < 4; l24 = l24 + 1) {
-			fRec27_perm[l24] = 0.0f;
-		}
-		for (int l25 = 0; l25 < 4; l25 = l25 + 1) {
-			fRec26_perm[l25] = 0.0f;
-		}
-		for (int l26 = 0; l26 < 4; l26 = l26 + 1) {
-			fYec6_perm[l26] = 0.0f;
-		}
-		for (int l27 = 0; l27 < 4; l27 = l27 + 1) {
-			fYec7_perm[l27] = 0.0f;
-		}
-		for (int l28 = 0; l28 < 8; l28 = l28 + 1) {
-			fYec8_perm[l28] = 0.0f;
-		}
-		for (int l29 = 0; l29 < 16; l29 = l29 + 1) {
-			fYec9_perm[l29] = 0.0f;
-		}
-		for (int l30 = 0; l30 < 64; l30 = l30 + 1) {
-			fYec10[l30] = 0.0f;
-		}
-		fYec10_idx = 0;
-		fYec10_idx_save = 0;
-		for (int l31 = 0; l31 < 128; l31 = l31 + 1) {
-			fYec11[l31] = 0.0f;
-		}
-		fYec11_idx = 0;
-		fYec11_idx_save = 0;
-		for (int l32 = 0; l32 < 256; l32 = l32 + 1) {
-			fYec12[l32] = 0.0f;
-		}
-		fYec12_idx = 0;
-		fYec12_idx_save = 0;
-		for (int l33 = 0; l33 < 512; l33 = l33 + 1) {
-			fYec13[l33] = 0.0f;
-		}
-		fYec13_idx = 0;
-		fYec13_idx_save = 0;
-		for (int l34 = 0; l34 < 1024; l34 = l34 + 1) {
-			fYec14[l34] = 0.0f;
-		}
-		fYec14_idx = 0;
-		fYec14_idx_save = 0;
-		for (int l35 = 0; l35 < 2048; l35 = l35 + 1) {
-			fYec15[l35] = 0.0f;
-		}
-		fYec15_idx = 0;
-		fYec15_idx_save = 0;
-		for (int l36 = 0; l36 < 4096; l36 = l36 + 1) {
-			fYec16[l36] = 0.0f;
-		}
-		fYec16_idx = 0;
-		fYec16_idx_save = 0;
-		for (int l37 = 0; l37 < 8192; l37 = l37 + 1) {
-			fYec17[l37] = 0.0f;
-		}
-		fYec17_idx = 0;
-		fYec17_idx_save = 0;
-		for (int l38 = 0; l38 < 16384; l38 = l38 + 1) {
-			fYec18[l38] = 0.0f;
-		}
-		fYec18_idx = 0;
-		fYec18_idx_save = 0;
-		for (int l39 = 0; l39 < 32768; l39 = l39 + 1) {
-			fYec19[l39] = 0.0f;
-		}
-		fYec19_idx = 0;
-		fYec19_idx_save = 0;
-		for (int l40 = 0; l40 < 65536; l40 = l40 + 1) {
-			fYec20[l40] = 0.0f;
-		}
-		fYec20_idx = 0;
-		fYec20_idx_save = 0;
-		for (int l41 = 0; l41 < 131072; l41 = l41 + 1) {
-			fYec21[l41] = 0.0f;
-		}
-		fYec21_idx = 0;
-		fYec21_idx_save = 0;
-		for (int l42 = 0; l42 < 262144; l42 = l42 + 1) {
-			fYec22[l42] = 0.0f;
-		}
-		fYec22_idx = 0;
-		fYec22_idx_save = 0;
-		for (int l43 = 0; l43 < 524288; l43 = l43 + 1) {
-			fYec23[l43] = 0.0f;
-		}
-		fYec23_idx = 0;
-		fYec23_idx_save = 0;
-		for (int l44 = 0; l44 < 1048576; l44 = l44 + 1) {
-			fYec24[l44] = 0.0f;
-		}
-		fYec24_idx = 0;
-		fYec24_idx_save = 0;
-		for (int l45 = 0; l45 < 2097152; l45 = l45 + 1) {
-			fYec25[l45] = 0.0f;
-		}
-		fYec25_idx = 0;
-		fYec25_idx_save = 0;
-		for (int l46 = 0; l46 < 4; l46 = l46 + 1) {
-			fYec26_perm[l46] = 0.0f;
-		}
-		for (int l47 = 0; l47 < 4; l47 = l47 + 1) {
-			fYec27_perm[l47] = 0.0f;
-		}
-		for (int l48 = 0; l48 < 8; l48 = l48 + 1) {
-			fYec28_perm[l48] = 0.0f;
-		}
-		for (int l49 = 0; l49 < 16; l49 = l49 + 1) {
-			fYec29_perm[l49] = 0.0f;
-		}
-		for (int l50 = 0; l50 < 64; l50 = l50 + 1) {
-			fYec30[l50] = 0.0f;
-		}
-		fYec30_idx = 0;
-		fYec30_idx_save = 0;
-		for (int l51 = 0; l51 < 128; l51 = l51 + 1) {
-			fYec31[l51] = 0.0f;
-		}
-		fYec31_idx = 0;
-		fYec31_idx_save = 0;
-		for (int l52 = 0; l52 < 256; l52 = l52 + 1) {
-			fYec32[l52] = 0.0f;
-		}
-		fYec32_idx = 0;
-		fYec32_idx_save = 0;
-		for (int l53 = 0; l53 < 512; l53 = l53 + 1) {
-			fYec33[l53] = 0.0f;
-		}
-		fYec33_idx = 0;
-		fYec33_idx_save = 0;
-		for (int l54 = 0; l54 < 1024; l54 = l54 + 1) {
-			fYec34[l54] = 0.0f;
-		}
-		fYec34_idx = 0;
-		fYec34_idx_save = 0;
-		for (int l55 = 0; l55 < 2048; l55 = l55 + 1) {
-			fYec35[l55] = 0.0f;
-		}
-		fYec35_idx = 0;
-		fYec35_idx_save = 0;
-		for (int l56 = 0; l56 < 4096; l56 = l56 + 1) {
-			fYec36[l56] = 0.0f;
-		}
-		fYec36_idx = 0;
-		fYec36_idx_save = 0;
-		for (int l57 = 0; l57 < 8192; l57 = l57 + 1) {
-			fYec37[l57] = 0.0f;
-		}
-		fYec37_idx = 0;
-		fYec37_idx_save = 0;
-		for (int l58 = 0; l58 < 16384; l58 = l58 + 1) {
-			fYec38[l58] = 0.0f;
-		}
-		fYec38_idx = 0;
-		fYec38_idx_save = 0;
-		for (int l59 = 0; l59 < 32768; l59 = l59 + 1) {
-			fYec39[l59] = 0.0f;
-		}
-		fYec39_idx = 0;
-		fYec39_idx_save = 0;
-		for (int l60 = 0; l60 < 65536; l60 = l60 + 1) {
-			fYec40[l60] = 0.0f;
-		}
-		fYec40_idx = 0;
-		fYec40_idx_save = 0;
-		for (int l61 = 0; l61 < 131072; l61 = l61 + 1) {
-			fYec41[l61] = 0.0f;
-		}
-		fYec41_idx = 0;
-		fYec41_idx_save = 0;
-		for (int l62 = 0; l62 < 262144; l62 = l62 + 1) {
-			fYec42[l62] = 0.0f;
-		}
-		fYec42_idx = 0;
-		fYec42_idx_save = 0;
-		for (int l63 = 0; l63 < 524288; l63 = l63 + 1) {
-			fYec43[l63] = 0.0f;
-		}
-		fYec43_idx = 0;
-		fYec43_idx_save = 0;
-		for (int l64 = 0; l64 < 1048576; l64 = l64 + 1) {
-			fYec44[l64] = 0.0f;
-		}
-		fYec44_idx = 0;
-		fYec44_idx_save = 0;
-		for (int l65 = 0; l65 < 2097152; l65 = l65 + 1) {
-			fYec45[l65] = 0.0f;
-		}
-		fYec45_idx = 0;
-		fYec45_idx_save = 0;
 		for (int l66 = 0; l66 < 4; l66 = l66 + 1) {
 			fYec46_perm[l66] = 0.0f;
 		}
@@ -1858,9 +1308,6 @@ class mydsp : public dsp {
 		for (int l94 = 0; l94 < 4; l94 = l94 + 1) {
 			fRec54_perm[l94] = 0.0f;
 		}
-		for (int l95 = 0; l95 < 4; l95 = l95 + 1) {
-			fRec55_perm[l95] = 0.0f;
-		}
 		for (int l96 = 0; l96 < 4; l96 = l96 + 1) {
 			fYec50_perm[l96] = 0.0f;
 		}
@@ -1891,9 +1338,6 @@ class mydsp : public dsp {
 		for (int l105 = 0; l105 < 4; l105 = l105 + 1) {
 			fRec61_perm[l105] = 0.0f;
 		}
-		for (int l106 = 0; l106 < 4; l106 = l106 + 1) {
-			fRec70_perm[l106] = 0.0f;
-		}
 		for (int l107 = 0; l107 < 4; l107 = l107 + 1) {
 			fRec66_perm[l107] = 0.0f;
 		}
@@ -1907,72 +1351,35 @@ class mydsp : public dsp {
 			fRec63_perm[l110] = 0.0f;
 		}
 		for (int l111 = 0; l111 < 4; l111 = l111 + 1) {
-			fYec53_perm[l111] = 0.0f;
+			iRec51_perm[l111] = 0;
 		}
 		for (int l112 = 0; l112 < 4; l112 = l112 + 1) {
-			fYec54_perm[l112] = 0.0f;
-		}
-		for (int l113 = 0; l113 < 8; l113 = l113 + 1) {
-			fYec55_perm[l113] = 0.0f;
-		}
-		for (int l114 = 0; l114 < 16; l114 = l114 + 1) {
-			fYec56_perm[l114] = 0.0f;
-		}
-		for (int l115 = 0; l115 < 64; l115 = l115 + 1) {
-			fYec57[l115] = 0.0f;
-		}
-		fYec57_idx = 0;
-		fYec57_idx_save = 0;
-		for (int l116 = 0; l116 < 128; l116 = l116 + 1) {
-			fYec58[l116] = 0.0f;
-		}
-		fYec58_idx = 0;
-		fYec58_idx_save = 0;
-		for (int l117 = 0; l117 < 256; l117 = l117 + 1) {
-			fYec59[l117] = 0.0f;
-		}
-		fYec59_idx = 0;
-		fYec59_idx_save = 0;
-		for (int l118 = 0; l118 < 512; l118 = l118 + 1) {
-			fYec60[l118] = 0.0f;
-		}
-		fYec60_idx = 0;
-		fYec60_idx_save = 0;
-		for (int l119 = 0; l119 < 1024; l119 = l119 + 1) {
-			fYec61[l119] = 0.0f;
-		}
-		fYec61_idx = 0;
-		fYec61_idx_save = 0;
-		for (int l120 = 0; l120 < 2048; l120 = l120 + 1) {
-			fYec62[l120] = 0.0f;
-		}
-		fYec62_idx = 0;
-		fYec62_idx_save = 0;
-		for (int l121 = 0; l121 < 4096; l121 = l121 + 1) {
-			fYec63[l121] = 0.0f;
-		}
-		fYec63_idx = 0;
-		fYec63_idx_save = 0;
-		for (int l122 = 0; l122 < 8192; l122 = l122 + 1) {
-			fYec64[l122] = 0.0f;
-		}
-		fYec64_idx = 0;
-		fYec64_idx_save = 0;
-		for (int l123 = 0; l123 < 16384; l123 = l123 + 1) {
-			fYec65[l123] = 0.0f;
-		}
-		fYec65_idx = 0;
-		fYec65_idx_save = 0;
-		for (int l124 = 0; l124 < 32768; l124 = l124 + 1) {
-			fYec66[l124] = 0.0f;
-		}
-		fYec66_idx = 0;
-		fYec66_idx_save = 0;
-		for (int l125 = 0; l125 < 65536; l125 = l125 + 1) {
-			fYec67[l125] = 0.0f;
-		}
-		fYec67_idx = 0;
-		fYec67_idx_save = 0;
+			fRec612_perm[l112] = 0.0f;
+		}
+		for (int l113 = 0; l113 < 4; l113 = l113 + 1) {
+			fRec613_perm[l113] = 0.0f;
+		}
+		for (int l114 = 0; l114 < 4; l114 = l114 + 1) {
+			fRec614_perm[l114] = 0.0f;
+		}
+		for (int l115 = 0; l115 < 4; l115 = l115 + 1) {
+			fRec615_perm[l115] = 0.0f;
+		}
+		for (int l116 = 0; l116 < 4; l116 = l116 + 1) {
+			fRec616_perm[l116] = 0.0f;
+		}
+		for (int l117 = 0; l117 < 4; l117 = l117 + 1) {
+			fRec617_perm[l117] = 0.0f;
+		}
+		for (int l118 = 0; l118 < 4; l118 = l118 + 1) {
+			fRec618_perm[l118] = 0.0f;
+		}
+		for (int l119 = 0; l119 < 4; l119 = l119 + 1) {
+			fRec619_perm[l119] = 0.0f;
+		}
+		for (int l120 = 0; l120 < 4; l120 = l120 + 1) {
+			fRec620_perm[l120] = 0.0f;
+		}
 		for (int l126 = 0; l126 < 4; l126 = l126 + 1) {
 			fRec11_perm[l126] = 0.0f;
 		}
@@ -2169,6 +1576,9 @@ class mydsp : public dsp {
 		for (int l173 = 0; l173 < 4; l173 = l173 + 1) {
 			fRec10_perm[l173] = 0.0f;
 		}
+		for (int l508 = 0; l508 < 4; l508 = l508 + 1) {
+			fRec621_perm[l508] = 0.0f;
+		}
 		for (int l174 = 0; l174 < 4; l174 = l174 + 1) {
 			fRec9_perm[l174] = 0.0f;
 		}
@@ -2821,8 +2231,8 @@ class mydsp : public dsp {
 		for (int l389 = 0; l389 < 4; l389 = l389 + 1) {
 			fRec498_perm[l389] = 0.0f;
 		}
-		for (int l390 = 0; l390 < 4; l390 = l390 + 1) {
-			fRec499_perm[l390] = 0.0f;
+		for (int l508 = 0; l508 < 4; l508 = l508 + 1) {
+			fRec499_perm[l508] = 0.0f;
 		}
 		for (int l391 = 0; l391 < 4; l391 = l391 + 1) {
 			fRec493_perm[l391] = 0.0f;
@@ -3017,229 +2427,9 @@ class mydsp : public dsp {
 		for (int l453 = 0; l453 < 4; l453 = l453 + 1) {
 			fRec602_perm[l453] = 0.0f;
 		}
-		for (int l454 = 0; l454 < 4; l454 = l454 + 1) {
-			fYec107_perm[l454] = 0.0f;
-		}
-		for (int l455 = 0; l455 < 4; l455 = l455 + 1) {
-			fRec606_perm[l455] = 0.0f;
-		}
-		for (int l456 = 0; l456 < 4; l456 = l456 + 1) {
-			fRec605_perm[l456] = 0.0f;
-		}
-		for (int l457 = 0; l457 < 4; l457 = l457 + 1) {
-			fYec108_perm[l457] = 0.0f;
-		}
-		for (int l458 = 0; l458 < 4; l458 = l458 + 1) {
-			fRec604_perm[l458] = 0.0f;
-		}
-		for (int l459 = 0; l459 < 4; l459 = l459 + 1) {
-			fRec603_perm[l459] = 0.0f;
-		}
 		for (int l460 = 0; l460 < 4; l460 = l460 + 1) {
 			fYec109_perm[l460] = 0.0f;
 		}
-		for (int l461 = 0; l461 < 4; l461 = l461 + 1) {
-			fYec110_perm[l461] = 0.0f;
-		}
-		for (int l462 = 0; l462 < 4; l462 = l462 + 1) {
-			fRec610_perm[l462] = 0.0f;
-		}
-		for (int l463 = 0; l463 < 4; l463 = l463 + 1) {
-			fRec609_perm[l463] = 0.0f;
-		}
-		for (int l464 = 0; l464 < 4; l464 = l464 + 1) {
-			fYec111_perm[l464] = 0.0f;
-		}
-		for (int l465 = 0; l465 < 4; l465 = l465 + 1) {
-			fRec608_perm[l465] = 0.0f;
-		}
-		for (int l466 = 0; l466 < 4; l466 = l466 + 1) {
-			fRec607_perm[l466] = 0.0f;
-		}
-		for (int l467 = 0; l467 < 4; l467 = l467 + 1) {
-			fYec112_perm[l467] = 0.0f;
-		}
-		for (int l468 = 0; l468 < 4; l468 = l468 + 1) {
-			fYec113_perm[l468] = 0.0f;
-		}
-		for (int l469 = 0; l469 < 8; l469 = l469 + 1) {
-			fYec114_perm[l469] = 0.0f;
-		}
-		for (int l470 = 0; l470 < 16; l470 = l470 + 1) {
-			fYec115_perm[l470] = 0.0f;
-		}
-		for (int l471 = 0; l471 < 64; l471 = l471 + 1) {
-			fYec116[l471] = 0.0f;
-		}
-		fYec116_idx = 0;
-		fYec116_idx_save = 0;
-		for (int l472 = 0; l472 < 128; l472 = l472 + 1) {
-			fYec117[l472] = 0.0f;
-		}
-		fYec117_idx = 0;
-		fYec117_idx_save = 0;
-		for (int l473 = 0; l473 < 256; l473 = l473 + 1) {
-			fYec118[l473] = 0.0f;
-		}
-		fYec118_idx = 0;
-		fYec118_idx_save = 0;
-		for (int l474 = 0; l474 < 512; l474 = l474 + 1) {
-			fYec119[l474] = 0.0f;
-		}
-		fYec119_idx = 0;
-		fYec119_idx_save = 0;
-		for (int l475 = 0; l475 < 1024; l475 = l475 + 1) {
-			fYec120[l475] = 0.0f;
-		}
-		fYec120_idx = 0;
-		fYec120_idx_save = 0;
-		for (int l476 = 0; l476 < 2048; l476 = l476 + 1) {
-			fYec121[l476] = 0.0f;
-		}
-		fYec121_idx = 0;
-		fYec121_idx_save = 0;
-		for (int l477 = 0; l477 < 4096; l477 = l477 + 1) {
-			fYec122[l477] = 0.0f;
-		}
-		fYec122_idx = 0;
-		fYec122_idx_save = 0;
-		for (int l478 = 0; l478 < 8192; l478 = l478 + 1) {
-			fYec123[l478] = 0.0f;
-		}
-		fYec123_idx = 0;
-		fYec123_idx_save = 0;
-		for (int l479 = 0; l479 < 16384; l479 = l479 + 1) {
-			fYec124[l479] = 0.0f;
-		}
-		fYec124_idx = 0;
-		fYec124_idx_save = 0;
-		for (int l480 = 0; l480 < 32768; l480 = l480 + 1) {
-			fYec125[l480] = 0.0f;
-		}
-		fYec125_idx = 0;
-		fYec125_idx_save = 0;
-		for (int l481 = 0; l481 < 65536; l481 = l481 + 1) {
-			fYec126[l481] = 0.0f;
-		}
-		fYec126_idx = 0;
-		fYec126_idx_save = 0;
-		for (int l482 = 0; l482 < 131072; l482 = l482 + 1) {
-			fYec127[l482] = 0.0f;
-		}
-		fYec127_idx = 0;
-		fYec127_idx_save = 0;
-		for (int l483 = 0; l483 < 262144; l483 = l483 + 1) {
-			fYec128[l483] = 0.0f;
-		}
-		fYec128_idx = 0;
-		fYec128_idx_save = 0;
-		for (int l484 = 0; l484 < 524288; l484 = l484 + 1) {
-			fYec129[l484] = 0.0f;
-		}
-		fYec129_idx = 0;
-		fYec129_idx_save = 0;
-		for (int l485 = 0; l485 < 1048576; l485 = l485 + 1) {
-			fYec130[l485] = 0.0f;
-		}
-		fYec130_idx = 0;
-		fYec130_idx_save = 0;
-		for (int l486 = 0; l486 < 2097152; l486 = l486 + 1) {
-			fYec131[l486] = 0.0f;
-		}
-		fYec131_idx = 0;
-		fYec131_idx_save = 0;
-		for (int l487 = 0; l487 < 4; l487 = l487 + 1) {
-			fYec132_perm[l487] = 0.0f;
-		}
-		for (int l488 = 0; l488 < 4; l488 = l488 + 1) {
-			fYec133_perm[l488] = 0.0f;
-		}
-		for (int l489 = 0; l489 < 8; l489 = l489 + 1) {
-			fYec134_perm[l489] = 0.0f;
-		}
-		for (int l490 = 0; l490 < 16; l490 = l490 + 1) {
-			fYec135_perm[l490] = 0.0f;
-		}
-		for (int l491 = 0; l491 < 64; l491 = l491 + 1) {
-			fYec136[l491] = 0.0f;
-		}
-		fYec136_idx = 0;
-		fYec136_idx_save = 0;
-		for (int l492 = 0; l492 < 128; l492 = l492 + 1) {
-			fYec137[l492] = 0.0f;
-		}
-		fYec137_idx = 0;
-		fYec137_idx_save = 0;
-		for (int l493 = 0; l493 < 256; l493 = l493 + 1) {
-			fYec138[l493] = 0.0f;
-		}
-		fYec138_idx = 0;
-		fYec138_idx_save = 0;
-		for (int l494 = 0; l494 < 512; l494 = l494 + 1) {
-			fYec139[l494] = 0.0f;
-		}
-		fYec139_idx = 0;
-		fYec139_idx_save = 0;
-		for (int l495 = 0; l495 < 1024; l495 = l495 + 1) {
-			fYec140[l495] = 0.0f;
-		}
-		fYec140_idx = 0;
-		fYec140_idx_save = 0;
-		for (int l496 = 0; l496 < 2048; l496 = l496 + 1) {
-			fYec141[l496] = 0.0f;
-		}
-		fYec141_idx = 0;
-		fYec141_idx_save = 0;
-		for (int l497 = 0; l497 < 4096; l497 = l497 + 1) {
-			fYec142[l497] = 0.0f;
-		}
-		fYec142_idx = 0;
-		fYec142_idx_save = 0;
-		for (int l498 = 0; l498 < 8192; l498 = l498 + 1) {
-			fYec143[l498] = 0.0f;
-		}
-		fYec143_idx = 0;
-		fYec143_idx_save = 0;
-		for (int l499 = 0; l499 < 16384; l499 = l499 + 1) {
-			fYec144[l499] = 0.0f;
-		}
-		fYec144_idx = 0;
-		fYec144_idx_save = 0;
-		for (int l500 = 0; l500 < 32768; l500 = l500 + 1) {
-			fYec145[l500] = 0.0f;
-		}
-		fYec145_idx = 0;
-		fYec145_idx_save = 0;
-		for (int l501 = 0; l501 < 65536; l501 = l501 + 1) {
-			fYec146[l501] = 0.0f;
-		}
-		fYec146_idx = 0;
-		fYec146_idx_save = 0;
-		for (int l502 = 0; l502 < 131072; l502 = l502 + 1) {
-			fYec147[l502] = 0.0f;
-		}
-		fYec147_idx = 0;
-		fYec147_idx_save = 0;
-		for (int l503 = 0; l503 < 262144; l503 = l503 + 1) {
-			fYec148[l503] = 0.0f;
-		}
-		fYec148_idx = 0;
-		fYec148_idx_save = 0;
-		for (int l504 = 0; l504 < 524288; l504 = l504 + 1) {
-			fYec149[l504] = 0.0f;
-		}
-		fYec149_idx = 0;
-		fYec149_idx_save = 0;
-		for (int l505 = 0; l505 < 1048576; l505 = l505 + 1) {
-			fYec150[l505] = 0.0f;
-		}
-		fYec150_idx = 0;
-		fYec150_idx_save = 0;
-		for (int l506 = 0; l506 < 2097152; l506 = l506 + 1) {
-			fYec151[l506] = 0.0f;
-		}
-		fYec151_idx = 0;
-		fYec151_idx_save = 0;
 		for (int l507 = 0; l507 < 4; l507 = l507 + 1) {
 			fRec611_perm[l507] = 0.0f;
 		}
@@ -3739,48 +2929,8 @@ class mydsp : public dsp {
 		float fZec1[8];
 		float fRec21_tmp[12];
 		float* fRec21 = &fRec21_tmp[4];
-		float fYec1_tmp[12];
-		float* fYec1 = &fYec1_tmp[4];
-		float fRec25_tmp[12];
-		float* fRec25 = &fRec25_tmp[4];
-		float fRec24_tmp[12];
-		float* fRec24 = &fRec24_tmp[4];
-		float fYec2_tmp[12];
-		float* fYec2 = &fYec2_tmp[4];
-		float fRec23_tmp[12];
-		float* fRec23 = &fRec23_tmp[4];
-		float fRec22_tmp[12];
-		float* fRec22 = &fRec22_tmp[4];
 		float fYec3_tmp[12];
 		float* fYec3 = &fYec3_tmp[4];
-		float fYec4_tmp[12];
-		float* fYec4 = &fYec4_tmp[4];
-		float fRec29_tmp[12];
-		float* fRec29 = &fRec29_tmp[4];
-		float fRec28_tmp[12];
-		float* fRec28 = &fRec28_tmp[4];
-		float fYec5_tmp[12];
-		float* fYec5 = &fYec5_tmp[4];
-		float fRec27_tmp[12];
-		float* fRec27 = &fRec27_tmp[4];
-		float fRec26_tmp[12];
-		float* fRec26 = &fRec26_tmp[4];
-		float fYec6_tmp[12];
-		float* fYec6 = &fYec6_tmp[4];
-		float fYec7_tmp[12];
-		float* fYec7 = &fYec7_tmp[4];
-		float fYec8_tmp[16];
-		float* fYec8 = &fYec8_tmp[8];
-		float fYec9_tmp[24];
-		float* fYec9 = &fYec9_tmp[16];
-		float fYec26_tmp[12];
-		float* fYec26 = &fYec26_tmp[4];
-		float fYec27_tmp[12];
-		float* fYec27 = &fYec27_tmp[4];
-		float fYec28_tmp[16];
-		float* fYec28 = &fYec28_tmp[8];
-		float fYec29_tmp[24];
-		float* fYec29 = &fYec29_tmp[16];
 		float fYec46_tmp[12];
 		float* fYec46 = &fYec46_tmp[4];
 		float fRec20_tmp[12];
@@ -3888,11 +3038,8 @@ class mydsp : public dsp {
 		float* fRec52 = &fRec52_tmp[4];
 		float fRec54_tmp[12];
 		float* fRec54 = &fRec54_tmp[4];
-		float fSlow31 = fConst1 * float(fVslider6);
-		float fRec55_tmp[12];
-		float* fRec55 = &fRec55_tmp[4];
-		float fZec26[8];
-		float fZec27[8];
+		float fSlow31 = 0.0500000007f * float(fVslider6);
+		float fSlow302 = std::pow(10.0f, 0.0f - fSlow31);
 		float fYec50_tmp[12];
 		float* fYec50 = &fYec50_tmp[4];
 		float fRec51_tmp[12];
@@ -3914,22 +3061,25 @@ class mydsp : public dsp {
 		float* fRec57 = &fRec57_tmp[4];
 		float fRec61_tmp[12];
 		float* fRec61 = &fRec61_tmp[4];
-		float fSlow32 = fConst1 * float(fVslider7);
-		float fRec70_tmp[12];
-		float* fRec70 = &fRec70_tmp[4];
+		float fSlow32 = 0.0250000004f * float(fVslider7);
+		float fSlow303 = std::pow(10.0f, fSlow31);
+		float fSlow304 = std::pow(10.0f, 0.0f - fSlow32);
+		float fSlow305 = std::sqrt(fSlow304);
+		float fSlow306 = fSlow304 + -1.0f;
+		float fSlow307 = mydsp_faustpower2_f(fSlow304) + -1.0f;
+		float fSlow308 = std::pow(10.0f, fSlow32);
+		float fSlow309 = std::sqrt(fSlow308);
+		float fSlow310 = mydsp_faustpower2_f(fSlow308) + -1.0f;
+		float fSlow311 = fSlow308 + -1.0f;
 		float fSlow33 = float(fVslider8);
 		float fSlow34 = float(fVslider9);
 		float fSlow35 = std::tan(fConst104 * std::max<float>(50.0f, fSlow33 * (1.0f - fSlow34)));
-		float fZec29[8];
+		float fSlow312 = fSlow35 * (fSlow35 / fSlow305 + 1.42857146f) / fSlow305 + 1.0f;
 		float fZec30[8];
 		float fZec31[8];
 		float fZec32[8];
 		float fZec33[8];
-		float fZec34[8];
-		float fZec35[8];
-		float fZec36[8];
 		float fZec37[8];
-		float fZec38[8];
 		float fZec39[8];
 		float fRec66_tmp[12];
 		float* fRec66 = &fRec66_tmp[4];
@@ -3939,13 +3089,11 @@ class mydsp : public dsp {
 		float fRec68[8];
 		float fRec69[8];
 		float fSlow36 = std::tan(fConst104 * std::min<float>(8000.0f, fSlow33 * (fSlow34 + 1.0f)));
+		float fSlow313 = fSlow36 * (fSlow36 / fSlow309 + 1.42857146f) / fSlow309 + 1.0f;
 		float fZec41[8];
 		float fZec42[8];
 		float fZec43[8];
-		float fZec44[8];
-		float fZec45[8];
 		float fZec46[8];
-		float fZec47[8];
 		float fZec48[8];
 		float fRec62_tmp[12];
 		float* fRec62 = &fRec62_tmp[4];
@@ -3959,14 +3107,28 @@ class mydsp : public dsp {
 		float fZec52[8];
 		float fZec53[8];
 		float fZec54[8];
-		float fYec53_tmp[12];
-		float* fYec53 = &fYec53_tmp[4];
-		float fYec54_tmp[12];
-		float* fYec54 = &fYec54_tmp[4];
-		float fYec55_tmp[16];
-		float* fYec55 = &fYec55_tmp[8];
-		float fYec56_tmp[24];
-		float* fYec56 = &fYec56_tmp[16];
+		float fZec801[8];
+		int iRec51_tmp[12];
+		int* iRec51 = &iRec51_tmp[4];
+		int iZec802[8];
+		float fRec612_tmp[12];
+		float* fRec612 = &fRec612_tmp[4];
+		float fRec613_tmp[12];
+		float* fRec613 = &fRec613_tmp[4];
+		float fRec614_tmp[12];
+		float* fRec614 = &fRec614_tmp[4];
+		float fRec615_tmp[12];
+		float* fRec615 = &fRec615_tmp[4];
+		float fRec616_tmp[12];
+		float* fRec616 = &fRec616_tmp[4];
+		float fRec617_tmp[12];
+		float* fRec617 = &fRec617_tmp[4];
+		float fRec618_tmp[12];
+		float* fRec618 = &fRec618_tmp[4];
+		float fRec619_tmp[12];
+		float* fRec619 = &fRec619_tmp[4];
+		float fRec620_tmp[12];
+		float* fRec620 = &fRec620_tmp[4];
 		float fZec55[8];
 		float fSlow37 = float(fVslider10);
 		float fSlow38 = fSlow37 + -6.0f;
@@ -4000,7 +3162,7 @@ class mydsp : public dsp {
 		float* fRec76 = &fRec76_tmp[4];
 		float fRec75_tmp[12];
 		float* fRec75 = &fRec75_tmp[4];
-		float fSlow40 = 106.103294f / float(fVslider11);
+		float fSlow40 = 0.00942477796f * fConst102 * float(fVslider11);
 		float fZec59[8];
 		float fZec60[8];
 		int iZec61[8];
@@ -4026,6 +3188,8 @@ class mydsp : public dsp {
 		float* fYec92 = &fYec92_tmp[16];
 		float fRec10_tmp[12];
 		float* fRec10 = &fRec10_tmp[4];
+		float fRec621_tmp[12];
+		float* fRec621 = &fRec621_tmp[4];
 		float fRec9_tmp[12];
 		float* fRec9 = &fRec9_tmp[4];
 		float fSlow44 = fConst231 * float(fVslider15);
@@ -4112,17 +3276,25 @@ class mydsp : public dsp {
 		float fSlow80 = float(fVslider27);
 		float fSlow81 = float(fVslider28) - fSlow80;
 		float fSlow82 = 0.00999999978f * (fSlow80 + fSlow81);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec89[8];
+#endif
 		float fSlow83 = float(fVslider29);
 		float fSlow84 = fSlow43 + fSlow83;
 		float fSlow85 = float(fVslider30);
 		float fSlow86 = 0.5f * fSlow85;
 		float fSlow87 = fSlow84 - fSlow86;
 		float fSlow88 = fSlow43 + fSlow83 + fSlow86;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec90[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec91[8];
+#endif
 		float fSlow89 = 0.5f / std::max<float>(1.1920929e-07f, fSlow85);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec92[8];
+#endif
 		float fSlow90 = std::max<float>(1.1920929e-07f, 0.00100000005f * float(fVslider31));
 		float fSlow91 = std::pow(std::max<float>(1.1920929e-07f, 0.00100000005f * float(fVslider32)) / fSlow90, 0.142857149f);
 		float fSlow92 = fSlow90 * mydsp_faustpower7_f(fSlow91);
@@ -4135,9 +3307,13 @@ class mydsp : public dsp {
 		int iSlow98 = std::fabs(fSlow97) < 1.1920929e-07f;
 		float fThen115 = std::exp(0.0f - fConst102 / ((iSlow98) ? 1.0f : fSlow97));
 		float fSlow99 = ((iSlow98) ? 0.0f : fThen115);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec93[8];
+#endif
 		float fRec87_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec87 = &fRec87_tmp[4];
+#endif
 		float fZec94[8];
 		float fRec94_tmp[12];
 		float* fRec94 = &fRec94_tmp[4];
@@ -4145,13 +3321,25 @@ class mydsp : public dsp {
 		float* fRec93 = &fRec93_tmp[4];
 		float fRec92_tmp[12];
 		float* fRec92 = &fRec92_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec95[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec96[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec97[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec98[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec99[8];
+#endif
 		float fRec91_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec91 = &fRec91_tmp[4];
+#endif
 		float fRec325_tmp[12];
 		float* fRec325 = &fRec325_tmp[4];
 		float fRec324_tmp[12];
@@ -4259,26 +3447,38 @@ class mydsp : public dsp {
 		float fRec306_tmp[12];
 		float* fRec306 = &fRec306_tmp[4];
 		float fSlow166 = 0.00999999978f * fSlow80;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec100[8];
+#endif
 		float fSlow167 = float(fVslider35);
 		float fSlow168 = fSlow43 + fSlow167;
 		float fSlow169 = float(fVslider36);
 		float fSlow170 = 0.5f * fSlow169;
 		float fSlow171 = fSlow168 - fSlow170;
 		float fSlow172 = fSlow43 + fSlow167 + fSlow170;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec101[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec102[8];
+#endif
 		float fSlow173 = 0.5f / std::max<float>(1.1920929e-07f, fSlow169);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec103[8];
+#endif
 		int iSlow174 = std::fabs(fSlow90) < 1.1920929e-07f;
 		float fThen123 = std::exp(0.0f - fConst102 / ((iSlow174) ? 1.0f : fSlow90));
 		float fSlow175 = ((iSlow174) ? 0.0f : fThen123);
 		int iSlow176 = std::fabs(fSlow95) < 1.1920929e-07f;
 		float fThen125 = std::exp(0.0f - fConst102 / ((iSlow176) ? 1.0f : fSlow95));
 		float fSlow177 = ((iSlow176) ? 0.0f : fThen125);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec104[8];
+#endif
 		float fRec305_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec305 = &fRec305_tmp[4];
+#endif
 		float fRec346_tmp[12];
 		float* fRec346 = &fRec346_tmp[4];
 		float fRec345_tmp[12];
@@ -4319,16 +3519,30 @@ class mydsp : public dsp {
 		float* fRec328 = &fRec328_tmp[4];
 		float fRec327_tmp[12];
 		float* fRec327 = &fRec327_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec105[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec106[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec107[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec108[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec109[8];
+#endif
 		float fRec326_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec326 = &fRec326_tmp[4];
+#endif
 		float fSlow178 = float(fVslider37);
 		float fSlow179 = 0.00999999978f * fSlow178;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec110[8];
+#endif
 		float fZec111[8];
 		float fZec112[8];
 		float fZec113[8];
@@ -4376,7 +3590,9 @@ class mydsp : public dsp {
 		float fRec348_tmp[12];
 		float* fRec348 = &fRec348_tmp[4];
 		float fSlow181 = fSlow166 + 0.00142857141f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec131[8];
+#endif
 		float fSlow182 = fSlow83 - fSlow167;
 		float fSlow183 = 0.142857149f * fSlow182;
 		float fSlow184 = fSlow43 + fSlow167 + fSlow183;
@@ -4385,10 +3601,16 @@ class mydsp : public dsp {
 		float fSlow187 = 0.5f * fSlow186;
 		float fSlow188 = fSlow184 - fSlow187;
 		float fSlow189 = fSlow43 + fSlow167 + fSlow183 + fSlow187;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec132[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec133[8];
+#endif
 		float fSlow190 = 0.5f / std::max<float>(1.1920929e-07f, fSlow186);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec134[8];
+#endif
 		float fSlow191 = fSlow90 * fSlow91;
 		int iSlow192 = std::fabs(fSlow191) < 1.1920929e-07f;
 		float fThen133 = std::exp(0.0f - fConst102 / ((iSlow192) ? 1.0f : fSlow191));
@@ -4397,24 +3619,42 @@ class mydsp : public dsp {
 		int iSlow195 = std::fabs(fSlow194) < 1.1920929e-07f;
 		float fThen135 = std::exp(0.0f - fConst102 / ((iSlow195) ? 1.0f : fSlow194));
 		float fSlow196 = ((iSlow195) ? 0.0f : fThen135);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec135[8];
+#endif
 		float fRec347_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec347 = &fRec347_tmp[4];
+#endif
 		float fRec352_tmp[12];
 		float* fRec352 = &fRec352_tmp[4];
 		float fRec351_tmp[12];
 		float* fRec351 = &fRec351_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec136[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec137[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec138[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec139[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec140[8];
+#endif
 		float fRec350_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec350 = &fRec350_tmp[4];
+#endif
 		float fZec141[8];
 		float fSlow197 = float(fVslider38) - fSlow178;
 		float fSlow198 = fSlow179 + 0.00142857141f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec142[8];
+#endif
 		float fZec143[8];
 		float fZec144[8];
 		float fZec145[8];
@@ -4504,17 +3744,25 @@ class mydsp : public dsp {
 		float fRec354_tmp[12];
 		float* fRec354 = &fRec354_tmp[4];
 		float fSlow200 = fSlow166 + 0.00285714283f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec184[8];
+#endif
 		float fSlow201 = 0.285714298f * fSlow182;
 		float fSlow202 = fSlow43 + fSlow167 + fSlow201;
 		float fSlow203 = fSlow169 + 0.285714298f * fSlow185;
 		float fSlow204 = 0.5f * fSlow203;
 		float fSlow205 = fSlow202 - fSlow204;
 		float fSlow206 = fSlow43 + fSlow167 + fSlow201 + fSlow204;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec185[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec186[8];
+#endif
 		float fSlow207 = 0.5f / std::max<float>(1.1920929e-07f, fSlow203);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec187[8];
+#endif
 		float fSlow208 = fSlow90 * mydsp_faustpower2_f(fSlow91);
 		int iSlow209 = std::fabs(fSlow208) < 1.1920929e-07f;
 		float fThen143 = std::exp(0.0f - fConst102 / ((iSlow209) ? 1.0f : fSlow208));
@@ -4523,23 +3771,41 @@ class mydsp : public dsp {
 		int iSlow212 = std::fabs(fSlow211) < 1.1920929e-07f;
 		float fThen145 = std::exp(0.0f - fConst102 / ((iSlow212) ? 1.0f : fSlow211));
 		float fSlow213 = ((iSlow212) ? 0.0f : fThen145);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec188[8];
+#endif
 		float fRec353_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec353 = &fRec353_tmp[4];
+#endif
 		float fRec358_tmp[12];
 		float* fRec358 = &fRec358_tmp[4];
 		float fRec357_tmp[12];
 		float* fRec357 = &fRec357_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec189[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec190[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec191[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec192[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec193[8];
+#endif
 		float fRec356_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec356 = &fRec356_tmp[4];
+#endif
 		float fZec194[8];
 		float fSlow214 = fSlow179 + 0.00285714283f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec195[8];
+#endif
 		float fZec196[8];
 		float fZec197[8];
 		float fZec198[8];
@@ -4629,17 +3895,25 @@ class mydsp : public dsp {
 		float fRec360_tmp[12];
 		float* fRec360 = &fRec360_tmp[4];
 		float fSlow216 = fSlow166 + 0.00428571412f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec237[8];
+#endif
 		float fSlow217 = 0.428571433f * fSlow182;
 		float fSlow218 = fSlow43 + fSlow167 + fSlow217;
 		float fSlow219 = fSlow169 + 0.428571433f * fSlow185;
 		float fSlow220 = 0.5f * fSlow219;
 		float fSlow221 = fSlow218 - fSlow220;
 		float fSlow222 = fSlow43 + fSlow167 + fSlow217 + fSlow220;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec238[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec239[8];
+#endif
 		float fSlow223 = 0.5f / std::max<float>(1.1920929e-07f, fSlow219);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec240[8];
+#endif
 		float fSlow224 = fSlow90 * mydsp_faustpower3_f(fSlow91);
 		int iSlow225 = std::fabs(fSlow224) < 1.1920929e-07f;
 		float fThen153 = std::exp(0.0f - fConst102 / ((iSlow225) ? 1.0f : fSlow224));
@@ -4648,23 +3922,41 @@ class mydsp : public dsp {
 		int iSlow228 = std::fabs(fSlow227) < 1.1920929e-07f;
 		float fThen155 = std::exp(0.0f - fConst102 / ((iSlow228) ? 1.0f : fSlow227));
 		float fSlow229 = ((iSlow228) ? 0.0f : fThen155);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec241[8];
+#endif
 		float fRec359_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec359 = &fRec359_tmp[4];
+#endif
 		float fRec364_tmp[12];
 		float* fRec364 = &fRec364_tmp[4];
 		float fRec363_tmp[12];
 		float* fRec363 = &fRec363_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec242[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec243[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec244[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec245[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec246[8];
+#endif
 		float fRec362_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec362 = &fRec362_tmp[4];
+#endif
 		float fZec247[8];
 		float fSlow230 = fSlow179 + 0.00428571412f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec248[8];
+#endif
 		float fZec249[8];
 		float fZec250[8];
 		float fZec251[8];
@@ -4754,17 +4046,25 @@ class mydsp : public dsp {
 		float fRec366_tmp[12];
 		float* fRec366 = &fRec366_tmp[4];
 		float fSlow232 = fSlow166 + 0.00571428565f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec290[8];
+#endif
 		float fSlow233 = 0.571428597f * fSlow182;
 		float fSlow234 = fSlow43 + fSlow167 + fSlow233;
 		float fSlow235 = fSlow169 + 0.571428597f * fSlow185;
 		float fSlow236 = 0.5f * fSlow235;
 		float fSlow237 = fSlow234 - fSlow236;
 		float fSlow238 = fSlow43 + fSlow167 + fSlow233 + fSlow236;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec291[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec292[8];
+#endif
 		float fSlow239 = 0.5f / std::max<float>(1.1920929e-07f, fSlow235);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec293[8];
+#endif
 		float fSlow240 = fSlow90 * mydsp_faustpower4_f(fSlow91);
 		int iSlow241 = std::fabs(fSlow240) < 1.1920929e-07f;
 		float fThen163 = std::exp(0.0f - fConst102 / ((iSlow241) ? 1.0f : fSlow240));
@@ -4773,23 +4073,41 @@ class mydsp : public dsp {
 		int iSlow244 = std::fabs(fSlow243) < 1.1920929e-07f;
 		float fThen165 = std::exp(0.0f - fConst102 / ((iSlow244) ? 1.0f : fSlow243));
 		float fSlow245 = ((iSlow244) ? 0.0f : fThen165);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec294[8];
+#endif
 		float fRec365_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec365 = &fRec365_tmp[4];
+#endif
 		float fRec370_tmp[12];
 		float* fRec370 = &fRec370_tmp[4];
 		float fRec369_tmp[12];
 		float* fRec369 = &fRec369_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec295[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec296[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec297[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec298[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec299[8];
+#endif
 		float fRec368_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec368 = &fRec368_tmp[4];
+#endif
 		float fZec300[8];
 		float fSlow246 = fSlow179 + 0.00571428565f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec301[8];
+#endif
 		float fZec302[8];
 		float fZec303[8];
 		float fZec304[8];
@@ -4879,17 +4197,25 @@ class mydsp : public dsp {
 		float fRec372_tmp[12];
 		float* fRec372 = &fRec372_tmp[4];
 		float fSlow248 = fSlow166 + 0.00714285718f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec343[8];
+#endif
 		float fSlow249 = 0.714285731f * fSlow182;
 		float fSlow250 = fSlow43 + fSlow167 + fSlow249;
 		float fSlow251 = fSlow169 + 0.714285731f * fSlow185;
 		float fSlow252 = 0.5f * fSlow251;
 		float fSlow253 = fSlow250 - fSlow252;
 		float fSlow254 = fSlow43 + fSlow167 + fSlow249 + fSlow252;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec344[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec345[8];
+#endif
 		float fSlow255 = 0.5f / std::max<float>(1.1920929e-07f, fSlow251);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec346[8];
+#endif
 		float fSlow256 = fSlow90 * mydsp_faustpower5_f(fSlow91);
 		int iSlow257 = std::fabs(fSlow256) < 1.1920929e-07f;
 		float fThen173 = std::exp(0.0f - fConst102 / ((iSlow257) ? 1.0f : fSlow256));
@@ -4898,23 +4224,41 @@ class mydsp : public dsp {
 		int iSlow260 = std::fabs(fSlow259) < 1.1920929e-07f;
 		float fThen175 = std::exp(0.0f - fConst102 / ((iSlow260) ? 1.0f : fSlow259));
 		float fSlow261 = ((iSlow260) ? 0.0f : fThen175);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec347[8];
+#endif
 		float fRec371_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec371 = &fRec371_tmp[4];
+#endif
 		float fRec376_tmp[12];
 		float* fRec376 = &fRec376_tmp[4];
 		float fRec375_tmp[12];
 		float* fRec375 = &fRec375_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec348[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec349[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec350[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec351[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec352[8];
+#endif
 		float fRec374_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec374 = &fRec374_tmp[4];
+#endif
 		float fZec353[8];
 		float fSlow262 = fSlow179 + 0.00714285718f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec354[8];
+#endif
 		float fZec355[8];
 		float fZec356[8];
 		float fZec357[8];
@@ -5004,17 +4348,25 @@ class mydsp : public dsp {
 		float fRec378_tmp[12];
 		float* fRec378 = &fRec378_tmp[4];
 		float fSlow264 = fSlow166 + 0.00857142825f * fSlow81;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec396[8];
+#endif
 		float fSlow265 = 0.857142866f * fSlow182;
 		float fSlow266 = fSlow43 + fSlow167 + fSlow265;
 		float fSlow267 = fSlow169 + 0.857142866f * fSlow185;
 		float fSlow268 = 0.5f * fSlow267;
 		float fSlow269 = fSlow266 - fSlow268;
 		float fSlow270 = fSlow43 + fSlow167 + fSlow265 + fSlow268;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec397[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec398[8];
+#endif
 		float fSlow271 = 0.5f / std::max<float>(1.1920929e-07f, fSlow267);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec399[8];
+#endif
 		float fSlow272 = fSlow90 * mydsp_faustpower6_f(fSlow91);
 		int iSlow273 = std::fabs(fSlow272) < 1.1920929e-07f;
 		float fThen183 = std::exp(0.0f - fConst102 / ((iSlow273) ? 1.0f : fSlow272));
@@ -5023,23 +4375,41 @@ class mydsp : public dsp {
 		int iSlow276 = std::fabs(fSlow275) < 1.1920929e-07f;
 		float fThen185 = std::exp(0.0f - fConst102 / ((iSlow276) ? 1.0f : fSlow275));
 		float fSlow277 = ((iSlow276) ? 0.0f : fThen185);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec400[8];
+#endif
 		float fRec377_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec377 = &fRec377_tmp[4];
+#endif
 		float fRec382_tmp[12];
 		float* fRec382 = &fRec382_tmp[4];
 		float fRec381_tmp[12];
 		float* fRec381 = &fRec381_tmp[4];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec401[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		int iZec402[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec403[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec404[8];
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec405[8];
+#endif
 		float fRec380_tmp[12];
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float* fRec380 = &fRec380_tmp[4];
+#endif
 		float fZec406[8];
 		float fSlow278 = fSlow179 + 0.00857142825f * fSlow197;
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec407[8];
+#endif
 		float fZec408[8];
 		float fZec409[8];
 		float fZec410[8];
@@ -5124,7 +4494,9 @@ class mydsp : public dsp {
 		float fRec113[8];
 		float fRec114[8];
 		float fSlow279 = 0.00999999978f * (fSlow178 + fSlow197);
+#if ! MASTER_ME_MSCOMP_KERNEL
 		float fZec449[8];
+#endif
 		float fZec450[8];
 		float fZec451[8];
 		float fZec452[8];
@@ -5824,6 +5196,8 @@ class mydsp : public dsp {
 		float* fRec601 = &fRec601_tmp[4];
 		float fZec791[8];
 		float fSlow301 = float(fVslider47);
+		fVbargraph2 = FAUSTFLOAT(0.0f);
+		fVbargraph27 = FAUSTFLOAT(0.0f);
 		int iZec792[8];
 		float fZec793[8];
 		float fZec794[8];
@@ -5844,51 +5218,23 @@ class mydsp : public dsp {
 		float* fYec106 = &fYec106_tmp[4];
 		float fRec602_tmp[12];
 		float* fRec602 = &fRec602_tmp[4];
-		float fYec107_tmp[12];
-		float* fYec107 = &fYec107_tmp[4];
-		float fRec606_tmp[12];
-		float* fRec606 = &fRec606_tmp[4];
-		float fRec605_tmp[12];
-		float* fRec605 = &fRec605_tmp[4];
-		float fYec108_tmp[12];
-		float* fYec108 = &fYec108_tmp[4];
-		float fRec604_tmp[12];
-		float* fRec604 = &fRec604_tmp[4];
-		float fRec603_tmp[12];
-		float* fRec603 = &fRec603_tmp[4];
 		float fYec109_tmp[12];
 		float* fYec109 = &fYec109_tmp[4];
-		float fYec110_tmp[12];
-		float* fYec110 = &fYec110_tmp[4];
-		float fRec610_tmp[12];
-		float* fRec610 = &fRec610_tmp[4];
-		float fRec609_tmp[12];
-		float* fRec609 = &fRec609_tmp[4];
-		float fYec111_tmp[12];
-		float* fYec111 = &fYec111_tmp[4];
-		float fRec608_tmp[12];
-		float* fRec608 = &fRec608_tmp[4];
-		float fRec607_tmp[12];
-		float* fRec607 = &fRec607_tmp[4];
-		float fYec112_tmp[12];
-		float* fYec112 = &fYec112_tmp[4];
-		float fYec113_tmp[12];
-		float* fYec113 = &fYec113_tmp[4];
-		float fYec114_tmp[16];
-		float* fYec114 = &fYec114_tmp[8];
-		float fYec115_tmp[24];
-		float* fYec115 = &fYec115_tmp[16];
-		float fYec132_tmp[12];
-		float* fYec132 = &fYec132_tmp[4];
-		float fYec133_tmp[12];
-		float* fYec133 = &fYec133_tmp[4];
-		float fYec134_tmp[16];
-		float* fYec134 = &fYec134_tmp[8];
-		float fYec135_tmp[24];
-		float* fYec135 = &fYec135_tmp[16];
 		float fZec800[8];
 		float fRec611_tmp[12];
 		float* fRec611 = &fRec611_tmp[4];
+#if MASTER_ME_MSCOMP_KERNEL
+		fMscompKernel.setBand(0, fSlow168, fSlow170, fSlow171, fSlow172, fSlow173, fSlow166, fSlow177, fSlow175, fSlow179);
+		fMscompKernel.setBand(1, fSlow184, fSlow187, fSlow188, fSlow189, fSlow190, fSlow181, fSlow196, fSlow193, fSlow198);
+		fMscompKernel.setBand(2, fSlow202, fSlow204, fSlow205, fSlow206, fSlow207, fSlow200, fSlow213, fSlow210, fSlow214);
+		fMscompKernel.setBand(3, fSlow218, fSlow220, fSlow221, fSlow222, fSlow223, fSlow216, fSlow229, fSlow226, fSlow230);
+		fMscompKernel.setBand(4, fSlow234, fSlow236, fSlow237, fSlow238, fSlow239, fSlow232, fSlow245, fSlow242, fSlow246);
+		fMscompKernel.setBand(5, fSlow250, fSlow252, fSlow253, fSlow254, fSlow255, fSlow248, fSlow261, fSlow258, fSlow262);
+		fMscompKernel.setBand(6, fSlow266, fSlow268, fSlow269, fSlow270, fSlow271, fSlow264, fSlow277, fSlow274, fSlow278);
+		fMscompKernel.setBand(7, fSlow84, fSlow86, fSlow87, fSlow88, fSlow89, fSlow82, fSlow99, fSlow94, fSlow279);
+		alignas(32) float fMscompLevels[8][16];
+		alignas(32) float fMscompGains[8][16];
+#endif
 		for (int vindex = 0; vindex < count; vindex = vindex + 8) {
 			FAUSTFLOAT* input0 = &input0_ptr[vindex];
 			FAUSTFLOAT* input1 = &input1_ptr[vindex];
@@ -5974,700 +5320,159 @@ class mydsp : public dsp {
 			}
 			/* Recursive loop 7 */
 			/* Pre code */
-			for (int j26 = 0; j26 < 4; j26 = j26 + 1) {
-				fYec1_tmp[j26] = fYec1_perm[j26];
-			}
-			for (int j28 = 0; j28 < 4; j28 = j28 + 1) {
-				fRec25_tmp[j28] = fRec25_perm[j28];
-			}
-			for (int j30 = 0; j30 < 4; j30 = j30 + 1) {
-				fRec24_tmp[j30] = fRec24_perm[j30];
+			for (int j18 = 0; j18 < 4; j18 = j18 + 1) {
+				fRec18_tmp[j18] = fRec18_perm[j18];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec1[i] = 0.0f - fConst8 * (fConst9 * fRec24[i - 1] - fConst10 * fYec0[i - 1]);
-				fRec25[i] = fYec1[i - 1] + fConst8 * (fConst11 * fYec0[i] - 2.0f * (fConst13 * fRec25[i - 1] - fConst14 * fYec0[i - 1]));
-				fRec24[i] = fRec25[i];
+				fRec18[i] = fSlow8 + fConst2 * fRec18[i - 1];
 			}
 			/* Post code */
-			for (int j27 = 0; j27 < 4; j27 = j27 + 1) {
-				fYec1_perm[j27] = fYec1_tmp[vsize + j27];
-			}
-			for (int j29 = 0; j29 < 4; j29 = j29 + 1) {
-				fRec25_perm[j29] = fRec25_tmp[vsize + j29];
-			}
-			for (int j31 = 0; j31 < 4; j31 = j31 + 1) {
-				fRec24_perm[j31] = fRec24_tmp[vsize + j31];
+			for (int j19 = 0; j19 < 4; j19 = j19 + 1) {
+				fRec18_perm[j19] = fRec18_tmp[vsize + j19];
 			}
-			/* Recursive loop 8 */
+			/* Vectorizable loop 8 */
 			/* Pre code */
-			for (int j40 = 0; j40 < 4; j40 = j40 + 1) {
-				fYec4_tmp[j40] = fYec4_perm[j40];
-			}
-			for (int j42 = 0; j42 < 4; j42 = j42 + 1) {
-				fRec29_tmp[j42] = fRec29_perm[j42];
-			}
-			for (int j44 = 0; j44 < 4; j44 = j44 + 1) {
-				fRec28_tmp[j44] = fRec28_perm[j44];
+			for (int j68 = 0; j68 < 4; j68 = j68 + 1) {
+				fYec46_tmp[j68] = fYec46_perm[j68];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec4[i] = 0.0f - fConst8 * (fConst9 * fRec28[i - 1] - fConst10 * fYec3[i - 1]);
-				fRec29[i] = fYec4[i - 1] + fConst8 * (fConst11 * fYec3[i] - 2.0f * (fConst13 * fRec29[i - 1] - fConst14 * fYec3[i - 1]));
-				fRec28[i] = fRec29[i];
+				fYec46[i] = fYec3[i];
 			}
 			/* Post code */
-			for (int j41 = 0; j41 < 4; j41 = j41 + 1) {
-				fYec4_perm[j41] = fYec4_tmp[vsize + j41];
-			}
-			for (int j43 = 0; j43 < 4; j43 = j43 + 1) {
-				fRec29_perm[j43] = fRec29_tmp[vsize + j43];
-			}
-			for (int j45 = 0; j45 < 4; j45 = j45 + 1) {
-				fRec28_perm[j45] = fRec28_tmp[vsize + j45];
+			for (int j69 = 0; j69 < 4; j69 = j69 + 1) {
+				fYec46_perm[j69] = fYec46_tmp[vsize + j69];
 			}
 			/* Recursive loop 9 */
 			/* Pre code */
-			for (int j32 = 0; j32 < 4; j32 = j32 + 1) {
-				fYec2_tmp[j32] = fYec2_perm[j32];
-			}
-			for (int j34 = 0; j34 < 4; j34 = j34 + 1) {
-				fRec23_tmp[j34] = fRec23_perm[j34];
-			}
-			for (int j36 = 0; j36 < 4; j36 = j36 + 1) {
-				fRec22_tmp[j36] = fRec22_perm[j36];
+			for (int j22 = 0; j22 < 4; j22 = j22 + 1) {
+				fRec19_tmp[j22] = fRec19_perm[j22];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec2[i] = 0.500327051f * fRec24[i - 1] - fConst20 * fRec22[i - 1];
-				fRec23[i] = fConst18 * fRec24[i - 1] + fConst19 * (fYec2[i - 1] - fConst21 * fRec23[i - 1] + 0.500327051f * fRec24[i]);
-				fRec22[i] = fRec23[i];
+				fRec19[i] = fConst5 * (fYec0[i] - fYec0[i - 1] + fConst6 * fRec19[i - 1]);
 			}
 			/* Post code */
-			for (int j33 = 0; j33 < 4; j33 = j33 + 1) {
-				fYec2_perm[j33] = fYec2_tmp[vsize + j33];
-			}
-			for (int j35 = 0; j35 < 4; j35 = j35 + 1) {
-				fRec23_perm[j35] = fRec23_tmp[vsize + j35];
-			}
-			for (int j37 = 0; j37 < 4; j37 = j37 + 1) {
-				fRec22_perm[j37] = fRec22_tmp[vsize + j37];
+			for (int j23 = 0; j23 < 4; j23 = j23 + 1) {
+				fRec19_perm[j23] = fRec19_tmp[vsize + j23];
 			}
 			/* Recursive loop 10 */
 			/* Pre code */
-			for (int j46 = 0; j46 < 4; j46 = j46 + 1) {
-				fYec5_tmp[j46] = fYec5_perm[j46];
-			}
-			for (int j48 = 0; j48 < 4; j48 = j48 + 1) {
-				fRec27_tmp[j48] = fRec27_perm[j48];
-			}
-			for (int j50 = 0; j50 < 4; j50 = j50 + 1) {
-				fRec26_tmp[j50] = fRec26_perm[j50];
+			for (int j70 = 0; j70 < 4; j70 = j70 + 1) {
+				fRec20_tmp[j70] = fRec20_perm[j70];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec5[i] = 0.500327051f * fRec28[i - 1] - fConst20 * fRec26[i - 1];
-				fRec27[i] = fConst18 * fRec28[i - 1] + fConst19 * (fYec5[i - 1] - fConst21 * fRec27[i - 1] + 0.500327051f * fRec28[i]);
-				fRec26[i] = fRec27[i];
+				fRec20[i] = fConst5 * (fYec46[i] - fYec46[i - 1] + fConst6 * fRec20[i - 1]);
 			}
 			/* Post code */
-			for (int j47 = 0; j47 < 4; j47 = j47 + 1) {
-				fYec5_perm[j47] = fYec5_tmp[vsize + j47];
-			}
-			for (int j49 = 0; j49 < 4; j49 = j49 + 1) {
-				fRec27_perm[j49] = fRec27_tmp[vsize + j49];
-			}
-			for (int j51 = 0; j51 < 4; j51 = j51 + 1) {
-				fRec26_perm[j51] = fRec26_tmp[vsize + j51];
+			for (int j71 = 0; j71 < 4; j71 = j71 + 1) {
+				fRec20_perm[j71] = fRec20_tmp[vsize + j71];
 			}
 			/* Vectorizable loop 11 */
-			/* Pre code */
-			for (int j52 = 0; j52 < 4; j52 = j52 + 1) {
-				fYec6_tmp[j52] = fYec6_perm[j52];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec6[i] = mydsp_faustpower2_f(fRec22[i]);
-			}
-			/* Post code */
-			for (int j53 = 0; j53 < 4; j53 = j53 + 1) {
-				fYec6_perm[j53] = fYec6_tmp[vsize + j53];
+				fZec2[i] = 1.0f - fRec18[i];
 			}
 			/* Vectorizable loop 12 */
-			/* Pre code */
-			for (int j60 = 0; j60 < 4; j60 = j60 + 1) {
-				fYec26_tmp[j60] = fYec26_perm[j60];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec26[i] = mydsp_faustpower2_f(fRec26[i]);
-			}
-			/* Post code */
-			for (int j61 = 0; j61 < 4; j61 = j61 + 1) {
-				fYec26_perm[j61] = fYec26_tmp[vsize + j61];
+				fZec3[i] = fYec0[i] * fRec18[i] + fRec19[i] * fZec2[i];
 			}
 			/* Vectorizable loop 13 */
-			/* Pre code */
-			for (int j54 = 0; j54 < 4; j54 = j54 + 1) {
-				fYec7_tmp[j54] = fYec7_perm[j54];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec7[i] = fYec6[i] + fYec6[i - 1];
-			}
-			/* Post code */
-			for (int j55 = 0; j55 < 4; j55 = j55 + 1) {
-				fYec7_perm[j55] = fYec7_tmp[vsize + j55];
+				fZec5[i] = fRec20[i] * fZec2[i] + fRec18[i] * fYec46[i];
 			}
-			/* Vectorizable loop 14 */
+			/* Recursive loop 14 */
 			/* Pre code */
-			for (int j62 = 0; j62 < 4; j62 = j62 + 1) {
-				fYec27_tmp[j62] = fYec27_perm[j62];
+			for (int j12 = 0; j12 < 4; j12 = j12 + 1) {
+				fRec15_tmp[j12] = fRec15_perm[j12];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec27[i] = fYec26[i] + fYec26[i - 1];
+				fRec15[i] = fSlow6 + fConst2 * fRec15[i - 1];
 			}
 			/* Post code */
-			for (int j63 = 0; j63 < 4; j63 = j63 + 1) {
-				fYec27_perm[j63] = fYec27_tmp[vsize + j63];
+			for (int j13 = 0; j13 < 4; j13 = j13 + 1) {
+				fRec15_perm[j13] = fRec15_tmp[vsize + j13];
 			}
 			/* Vectorizable loop 15 */
-			/* Pre code */
-			for (int j56 = 0; j56 < 8; j56 = j56 + 1) {
-				fYec8_tmp[j56] = fYec8_perm[j56];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec8[i] = fYec7[i] + fYec7[i - 2];
-			}
-			/* Post code */
-			for (int j57 = 0; j57 < 8; j57 = j57 + 1) {
-				fYec8_perm[j57] = fYec8_tmp[vsize + j57];
+				fZec4[i] = fSlow9 * (0.0f - fZec3[i]) + fSlow10 * fZec3[i];
 			}
 			/* Vectorizable loop 16 */
-			/* Pre code */
-			for (int j64 = 0; j64 < 8; j64 = j64 + 1) {
-				fYec28_tmp[j64] = fYec28_perm[j64];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec28[i] = fYec27[i] + fYec27[i - 2];
-			}
-			/* Post code */
-			for (int j65 = 0; j65 < 8; j65 = j65 + 1) {
-				fYec28_perm[j65] = fYec28_tmp[vsize + j65];
+				fZec6[i] = fSlow11 * (0.0f - fZec5[i]) + fSlow12 * fZec5[i];
 			}
 			/* Vectorizable loop 17 */
-			/* Pre code */
-			for (int j58 = 0; j58 < 16; j58 = j58 + 1) {
-				fYec9_tmp[j58] = fYec9_perm[j58];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec9[i] = fYec8[i] + fYec8[i - 4];
-			}
-			/* Post code */
-			for (int j59 = 0; j59 < 16; j59 = j59 + 1) {
-				fYec9_perm[j59] = fYec9_tmp[vsize + j59];
+				fZec7[i] = 0.5f * (1.0f - fRec15[i]) * (fZec4[i] + fZec6[i]);
 			}
 			/* Vectorizable loop 18 */
-			/* Pre code */
-			for (int j66 = 0; j66 < 16; j66 = j66 + 1) {
-				fYec29_tmp[j66] = fYec29_perm[j66];
-			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec29[i] = fYec28[i] + fYec28[i - 4];
-			}
-			/* Post code */
-			for (int j67 = 0; j67 < 16; j67 = j67 + 1) {
-				fYec29_perm[j67] = fYec29_tmp[vsize + j67];
+				fZec8[i] = fRec15[i] * fZec4[i] + fZec7[i];
 			}
 			/* Vectorizable loop 19 */
-			/* Pre code */
-			fYec10_idx = (fYec10_idx + fYec10_idx_save) & 63;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec10[(i + fYec10_idx) & 63] = fYec9[i] + fYec9[i - 8];
+				fZec9[i] = fZec7[i] + fRec15[i] * fZec6[i];
 			}
-			/* Post code */
-			fYec10_idx_save = vsize;
-			/* Vectorizable loop 20 */
+			/* Recursive loop 20 */
 			/* Pre code */
-			fYec30_idx = (fYec30_idx + fYec30_idx_save) & 63;
+			for (int j72 = 0; j72 < 4; j72 = j72 + 1) {
+				fRec33_tmp[j72] = fRec33_perm[j72];
+			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec30[(i + fYec30_idx) & 63] = fYec29[i] + fYec29[i - 8];
+				fRec33[i] = fConst98 * fRec33[i - 1] + fConst99 * fZec8[i];
 			}
 			/* Post code */
-			fYec30_idx_save = vsize;
-			/* Vectorizable loop 21 */
+			for (int j73 = 0; j73 < 4; j73 = j73 + 1) {
+				fRec33_perm[j73] = fRec33_tmp[vsize + j73];
+			}
+			/* Recursive loop 21 */
 			/* Pre code */
-			fYec11_idx = (fYec11_idx + fYec11_idx_save) & 127;
+			for (int j74 = 0; j74 < 4; j74 = j74 + 1) {
+				fRec34_tmp[j74] = fRec34_perm[j74];
+			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec11[(i + fYec11_idx) & 127] = fYec10[(i + fYec10_idx) & 63] + fYec10[((i + fYec10_idx) - 16) & 63];
+				fRec34[i] = fConst98 * fRec34[i - 1] + fConst99 * fZec9[i];
 			}
 			/* Post code */
-			fYec11_idx_save = vsize;
+			for (int j75 = 0; j75 < 4; j75 = j75 + 1) {
+				fRec34_perm[j75] = fRec34_tmp[vsize + j75];
+			}
 			/* Vectorizable loop 22 */
-			/* Pre code */
-			fYec31_idx = (fYec31_idx + fYec31_idx_save) & 127;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec31[(i + fYec31_idx) & 127] = fYec30[(i + fYec30_idx) & 63] + fYec30[((i + fYec30_idx) - 16) & 63];
+				fZec10[i] = fZec8[i] - fRec33[i];
 			}
-			/* Post code */
-			fYec31_idx_save = vsize;
 			/* Vectorizable loop 23 */
-			/* Pre code */
-			fYec12_idx = (fYec12_idx + fYec12_idx_save) & 255;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec12[(i + fYec12_idx) & 255] = fYec11[(i + fYec11_idx) & 127] + fYec11[((i + fYec11_idx) - 32) & 127];
+				fZec11[i] = fZec9[i] - fRec34[i];
 			}
-			/* Post code */
-			fYec12_idx_save = vsize;
-			/* Vectorizable loop 24 */
+			/* Recursive loop 24 */
 			/* Pre code */
-			fYec32_idx = (fYec32_idx + fYec32_idx_save) & 255;
+			for (int j76 = 0; j76 < 4; j76 = j76 + 1) {
+				fRec32_tmp[j76] = fRec32_perm[j76];
+			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec32[(i + fYec32_idx) & 255] = fYec31[(i + fYec31_idx) & 127] + fYec31[((i + fYec31_idx) - 32) & 127];
-			}
-			/* Post code */
-			fYec32_idx_save = vsize;
-			/* Vectorizable loop 25 */
-			/* Pre code */
-			fYec13_idx = (fYec13_idx + fYec13_idx_save) & 511;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec13[(i + fYec13_idx) & 511] = fYec12[(i + fYec12_idx) & 255] + fYec12[((i + fYec12_idx) - 64) & 255];
-			}
-			/* Post code */
-			fYec13_idx_save = vsize;
-			/* Vectorizable loop 26 */
-			/* Pre code */
-			fYec33_idx = (fYec33_idx + fYec33_idx_save) & 511;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec33[(i + fYec33_idx) & 511] = fYec32[(i + fYec32_idx) & 255] + fYec32[((i + fYec32_idx) - 64) & 255];
-			}
-			/* Post code */
-			fYec33_idx_save = vsize;
-			/* Vectorizable loop 27 */
-			/* Pre code */
-			fYec14_idx = (fYec14_idx + fYec14_idx_save) & 1023;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec14[(i + fYec14_idx) & 1023] = fYec13[(i + fYec13_idx) & 511] + fYec13[((i + fYec13_idx) - 128) & 511];
-			}
-			/* Post code */
-			fYec14_idx_save = vsize;
-			/* Vectorizable loop 28 */
-			/* Pre code */
-			fYec34_idx = (fYec34_idx + fYec34_idx_save) & 1023;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec34[(i + fYec34_idx) & 1023] = fYec33[(i + fYec33_idx) & 511] + fYec33[((i + fYec33_idx) - 128) & 511];
-			}
-			/* Post code */
-			fYec34_idx_save = vsize;
-			/* Vectorizable loop 29 */
-			/* Pre code */
-			fYec15_idx = (fYec15_idx + fYec15_idx_save) & 2047;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec15[(i + fYec15_idx) & 2047] = fYec14[(i + fYec14_idx) & 1023] + fYec14[((i + fYec14_idx) - 256) & 1023];
-			}
-			/* Post code */
-			fYec15_idx_save = vsize;
-			/* Vectorizable loop 30 */
-			/* Pre code */
-			fYec35_idx = (fYec35_idx + fYec35_idx_save) & 2047;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec35[(i + fYec35_idx) & 2047] = fYec34[(i + fYec34_idx) & 1023] + fYec34[((i + fYec34_idx) - 256) & 1023];
-			}
-			/* Post code */
-			fYec35_idx_save = vsize;
-			/* Vectorizable loop 31 */
-			/* Pre code */
-			fYec16_idx = (fYec16_idx + fYec16_idx_save) & 4095;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec16[(i + fYec16_idx) & 4095] = fYec15[(i + fYec15_idx) & 2047] + fYec15[((i + fYec15_idx) - 512) & 2047];
-			}
-			/* Post code */
-			fYec16_idx_save = vsize;
-			/* Vectorizable loop 32 */
-			/* Pre code */
-			fYec36_idx = (fYec36_idx + fYec36_idx_save) & 4095;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec36[(i + fYec36_idx) & 4095] = fYec35[(i + fYec35_idx) & 2047] + fYec35[((i + fYec35_idx) - 512) & 2047];
-			}
-			/* Post code */
-			fYec36_idx_save = vsize;
-			/* Vectorizable loop 33 */
-			/* Pre code */
-			fYec17_idx = (fYec17_idx + fYec17_idx_save) & 8191;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec17[(i + fYec17_idx) & 8191] = fYec16[(i + fYec16_idx) & 4095] + fYec16[((i + fYec16_idx) - 1024) & 4095];
-			}
-			/* Post code */
-			fYec17_idx_save = vsize;
-			/* Vectorizable loop 34 */
-			/* Pre code */
-			fYec37_idx = (fYec37_idx + fYec37_idx_save) & 8191;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec37[(i + fYec37_idx) & 8191] = fYec36[(i + fYec36_idx) & 4095] + fYec36[((i + fYec36_idx) - 1024) & 4095];
-			}
-			/* Post code */
-			fYec37_idx_save = vsize;
-			/* Vectorizable loop 35 */
-			/* Pre code */
-			fYec18_idx = (fYec18_idx + fYec18_idx_save) & 16383;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec18[(i + fYec18_idx) & 16383] = fYec17[(i + fYec17_idx) & 8191] + fYec17[((i + fYec17_idx) - 2048) & 8191];
-			}
-			/* Post code */
-			fYec18_idx_save = vsize;
-			/* Vectorizable loop 36 */
-			/* Pre code */
-			fYec38_idx = (fYec38_idx + fYec38_idx_save) & 16383;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec38[(i + fYec38_idx) & 16383] = fYec37[(i + fYec37_idx) & 8191] + fYec37[((i + fYec37_idx) - 2048) & 8191];
-			}
-			/* Post code */
-			fYec38_idx_save = vsize;
-			/* Vectorizable loop 37 */
-			/* Pre code */
-			fYec19_idx = (fYec19_idx + fYec19_idx_save) & 32767;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec19[(i + fYec19_idx) & 32767] = fYec18[(i + fYec18_idx) & 16383] + fYec18[((i + fYec18_idx) - 4096) & 16383];
-			}
-			/* Post code */
-			fYec19_idx_save = vsize;
-			/* Vectorizable loop 38 */
-			/* Pre code */
-			fYec39_idx = (fYec39_idx + fYec39_idx_save) & 32767;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec39[(i + fYec39_idx) & 32767] = fYec38[(i + fYec38_idx) & 16383] + fYec38[((i + fYec38_idx) - 4096) & 16383];
-			}
-			/* Post code */
-			fYec39_idx_save = vsize;
-			/* Vectorizable loop 39 */
-			/* Pre code */
-			fYec20_idx = (fYec20_idx + fYec20_idx_save) & 65535;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec20[(i + fYec20_idx) & 65535] = fYec19[(i + fYec19_idx) & 32767] + fYec19[((i + fYec19_idx) - 8192) & 32767];
-			}
-			/* Post code */
-			fYec20_idx_save = vsize;
-			/* Vectorizable loop 40 */
-			/* Pre code */
-			fYec40_idx = (fYec40_idx + fYec40_idx_save) & 65535;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec40[(i + fYec40_idx) & 65535] = fYec39[(i + fYec39_idx) & 32767] + fYec39[((i + fYec39_idx) - 8192) & 32767];
-			}
-			/* Post code */
-			fYec40_idx_save = vsize;
-			/* Vectorizable loop 41 */
-			/* Pre code */
-			fYec21_idx = (fYec21_idx + fYec21_idx_save) & 131071;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec21[(i + fYec21_idx) & 131071] = fYec20[(i + fYec20_idx) & 65535] + fYec20[((i + fYec20_idx) - 16384) & 65535];
-			}
-			/* Post code */
-			fYec21_idx_save = vsize;
-			/* Vectorizable loop 42 */
-			/* Pre code */
-			fYec41_idx = (fYec41_idx + fYec41_idx_save) & 131071;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec41[(i + fYec41_idx) & 131071] = fYec40[(i + fYec40_idx) & 65535] + fYec40[((i + fYec40_idx) - 16384) & 65535];
-			}
-			/* Post code */
-			fYec41_idx_save = vsize;
-			/* Vectorizable loop 43 */
-			/* Pre code */
-			fYec22_idx = (fYec22_idx + fYec22_idx_save) & 262143;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec22[(i + fYec22_idx) & 262143] = fYec21[(i + fYec21_idx) & 131071] + fYec21[((i + fYec21_idx) - 32768) & 131071];
-			}
-			/* Post code */
-			fYec22_idx_save = vsize;
-			/* Vectorizable loop 44 */
-			/* Pre code */
-			fYec42_idx = (fYec42_idx + fYec42_idx_save) & 262143;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec42[(i + fYec42_idx) & 262143] = fYec41[(i + fYec41_idx) & 131071] + fYec41[((i + fYec41_idx) - 32768) & 131071];
-			}
-			/* Post code */
-			fYec42_idx_save = vsize;
-			/* Vectorizable loop 45 */
-			/* Pre code */
-			fYec23_idx = (fYec23_idx + fYec23_idx_save) & 524287;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec23[(i + fYec23_idx) & 524287] = fYec22[(i + fYec22_idx) & 262143] + fYec22[((i + fYec22_idx) - 65536) & 262143];
-			}
-			/* Post code */
-			fYec23_idx_save = vsize;
-			/* Vectorizable loop 46 */
-			/* Pre code */
-			fYec43_idx = (fYec43_idx + fYec43_idx_save) & 524287;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec43[(i + fYec43_idx) & 524287] = fYec42[(i + fYec42_idx) & 262143] + fYec42[((i + fYec42_idx) - 65536) & 262143];
-			}
-			/* Post code */
-			fYec43_idx_save = vsize;
-			/* Vectorizable loop 47 */
-			/* Pre code */
-			fYec24_idx = (fYec24_idx + fYec24_idx_save) & 1048575;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec24[(i + fYec24_idx) & 1048575] = fYec23[(i + fYec23_idx) & 524287] + fYec23[((i + fYec23_idx) - 131072) & 524287];
-			}
-			/* Post code */
-			fYec24_idx_save = vsize;
-			/* Vectorizable loop 48 */
-			/* Pre code */
-			fYec44_idx = (fYec44_idx + fYec44_idx_save) & 1048575;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec44[(i + fYec44_idx) & 1048575] = fYec43[(i + fYec43_idx) & 524287] + fYec43[((i + fYec43_idx) - 131072) & 524287];
-			}
-			/* Post code */
-			fYec44_idx_save = vsize;
-			/* Vectorizable loop 49 */
-			/* Pre code */
-			fYec25_idx = (fYec25_idx + fYec25_idx_save) & 2097151;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec25[(i + fYec25_idx) & 2097151] = fYec24[(i + fYec24_idx) & 1048575] + fYec24[((i + fYec24_idx) - 262144) & 1048575];
-			}
-			/* Post code */
-			fYec25_idx_save = vsize;
-			/* Vectorizable loop 50 */
-			/* Pre code */
-			fYec45_idx = (fYec45_idx + fYec45_idx_save) & 2097151;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec45[(i + fYec45_idx) & 2097151] = fYec44[(i + fYec44_idx) & 1048575] + fYec44[((i + fYec44_idx) - 262144) & 1048575];
-			}
-			/* Post code */
-			fYec45_idx_save = vsize;
-			/* Recursive loop 51 */
-			/* Pre code */
-			for (int j18 = 0; j18 < 4; j18 = j18 + 1) {
-				fRec18_tmp[j18] = fRec18_perm[j18];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec18[i] = fSlow8 + fConst2 * fRec18[i - 1];
-			}
-			/* Post code */
-			for (int j19 = 0; j19 < 4; j19 = j19 + 1) {
-				fRec18_perm[j19] = fRec18_tmp[vsize + j19];
-			}
-			/* Vectorizable loop 52 */
-			/* Pre code */
-			for (int j68 = 0; j68 < 4; j68 = j68 + 1) {
-				fYec46_tmp[j68] = fYec46_perm[j68];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				float fElse0 = fYec25[((i + fYec25_idx) - iConst61) & 2097151];
-				float fElse1 = fYec24[((i + fYec24_idx) - iConst63) & 1048575];
-				float fElse2 = fYec23[((i + fYec23_idx) - iConst65) & 524287];
-				float fElse3 = fYec22[((i + fYec22_idx) - iConst67) & 262143];
-				float fElse4 = fYec21[((i + fYec21_idx) - iConst69) & 131071];
-				float fElse5 = fYec20[((i + fYec20_idx) - iConst71) & 65535];
-				float fElse6 = fYec19[((i + fYec19_idx) - iConst73) & 32767];
-				float fElse7 = fYec18[((i + fYec18_idx) - iConst75) & 16383];
-				float fElse8 = fYec17[((i + fYec17_idx) - iConst77) & 8191];
-				float fElse9 = fYec16[((i + fYec16_idx) - iConst79) & 4095];
-				float fElse10 = fYec15[((i + fYec15_idx) - iConst81) & 2047];
-				float fElse11 = fYec14[((i + fYec14_idx) - iConst83) & 1023];
-				float fElse12 = fYec13[((i + fYec13_idx) - iConst85) & 511];
-				float fElse13 = fYec12[((i + fYec12_idx) - iConst87) & 255];
-				float fElse14 = fYec11[((i + fYec11_idx) - iConst89) & 127];
-				float fElse15 = fYec10[((i + fYec10_idx) - iConst91) & 63];
-				float fElse16 = fYec9[i - iConst93];
-				float fElse17 = fYec8[i - iConst95];
-				float fElse18 = fYec6[i];
-				float fElse19 = fYec7[i - iConst96];
-				float fElse20 = fYec45[((i + fYec45_idx) - iConst61) & 2097151];
-				float fElse21 = fYec44[((i + fYec44_idx) - iConst63) & 1048575];
-				float fElse22 = fYec43[((i + fYec43_idx) - iConst65) & 524287];
-				float fElse23 = fYec42[((i + fYec42_idx) - iConst67) & 262143];
-				float fElse24 = fYec41[((i + fYec41_idx) - iConst69) & 131071];
-				float fElse25 = fYec40[((i + fYec40_idx) - iConst71) & 65535];
-				float fElse26 = fYec39[((i + fYec39_idx) - iConst73) & 32767];
-				float fElse27 = fYec38[((i + fYec38_idx) - iConst75) & 16383];
-				float fElse28 = fYec37[((i + fYec37_idx) - iConst77) & 8191];
-				float fElse29 = fYec36[((i + fYec36_idx) - iConst79) & 4095];
-				float fElse30 = fYec35[((i + fYec35_idx) - iConst81) & 2047];
-				float fElse31 = fYec34[((i + fYec34_idx) - iConst83) & 1023];
-				float fElse32 = fYec33[((i + fYec33_idx) - iConst85) & 511];
-				float fElse33 = fYec32[((i + fYec32_idx) - iConst87) & 255];
-				float fElse34 = fYec31[((i + fYec31_idx) - iConst89) & 127];
-				float fElse35 = fYec30[((i + fYec30_idx) - iConst91) & 63];
-				float fElse36 = fYec29[i - iConst93];
-				float fElse37 = fYec28[i - iConst95];
-				float fElse38 = fYec26[i];
-				float fElse39 = fYec27[i - iConst96];
-				fVbargraph2 = FAUSTFLOAT(4.34294462f * std::log(std::max<float>(9.99999996e-13f, fConst23 * (((iConst24) ? fElse0 : 0.0f) + ((iConst62) ? fElse1 : 0.0f) + ((iConst64) ? fElse2 : 0.0f) + ((iConst66) ? fElse3 : 0.0f) + ((iConst68) ? fElse4 : 0.0f) + ((iConst70) ? fElse5 : 0.0f) + ((iConst72) ? fElse6 : 0.0f) + ((iConst74) ? fElse7 : 0.0f) + ((iConst76) ? fElse8 : 0.0f) + ((iConst78) ? fElse9 : 0.0f) + ((iConst80) ? fElse10 : 0.0f) + ((iConst82) ? fElse11 : 0.0f) + ((iConst84) ? fElse12 : 0.0f) + ((iConst86) ? fElse13 : 0.0f) + ((iConst88) ? fElse14 : 0.0f) + ((iConst90) ? fElse15 : 0.0f) + ((iConst92) ? fElse16 : 0.0f) + ((iConst94) ? fElse17 : 0.0f) + ((iConst96) ? fElse18 : 0.0f) + ((iConst97) ? fElse19 : 0.0f) + ((iConst24) ? fElse20 : 0.0f) + ((iConst62) ? fElse21 : 0.0f) + ((iConst64) ? fElse22 : 0.0f) + ((iConst66) ? fElse23 : 0.0f) + ((iConst68) ? fElse24 : 0.0f) + ((iConst70) ? fElse25 : 0.0f) + ((iConst72) ? fElse26 : 0.0f) + ((iConst74) ? fElse27 : 0.0f) + ((iConst76) ? fElse28 : 0.0f) + ((iConst78) ? fElse29 : 0.0f) + ((iConst80) ? fElse30 : 0.0f) + ((iConst82) ? fElse31 : 0.0f) + ((iConst84) ? fElse32 : 0.0f) + ((iConst86) ? fElse33 : 0.0f) + ((iConst88) ? fElse34 : 0.0f) + ((iConst90) ? fElse35 : 0.0f) + ((iConst92) ? fElse36 : 0.0f) + ((iConst94) ? fElse37 : 0.0f) + ((iConst96) ? fElse38 : 0.0f) + ((iConst97) ? fElse39 : 0.0f)))) + -0.690999985f);
-				fYec46[i] = fYec3[i];
-			}
-			/* Post code */
-			for (int j69 = 0; j69 < 4; j69 = j69 + 1) {
-				fYec46_perm[j69] = fYec46_tmp[vsize + j69];
-			}
-			/* Recursive loop 53 */
-			/* Pre code */
-			for (int j22 = 0; j22 < 4; j22 = j22 + 1) {
-				fRec19_tmp[j22] = fRec19_perm[j22];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec19[i] = fConst5 * (fYec0[i] - fYec0[i - 1] + fConst6 * fRec19[i - 1]);
-			}
-			/* Post code */
-			for (int j23 = 0; j23 < 4; j23 = j23 + 1) {
-				fRec19_perm[j23] = fRec19_tmp[vsize + j23];
-			}
-			/* Recursive loop 54 */
-			/* Pre code */
-			for (int j70 = 0; j70 < 4; j70 = j70 + 1) {
-				fRec20_tmp[j70] = fRec20_perm[j70];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec20[i] = fConst5 * (fYec46[i] - fYec46[i - 1] + fConst6 * fRec20[i - 1]);
-			}
-			/* Post code */
-			for (int j71 = 0; j71 < 4; j71 = j71 + 1) {
-				fRec20_perm[j71] = fRec20_tmp[vsize + j71];
-			}
-			/* Vectorizable loop 55 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec2[i] = 1.0f - fRec18[i];
-			}
-			/* Vectorizable loop 56 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec3[i] = fYec0[i] * fRec18[i] + fRec19[i] * fZec2[i];
-			}
-			/* Vectorizable loop 57 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec5[i] = fRec20[i] * fZec2[i] + fRec18[i] * fYec46[i];
-			}
-			/* Recursive loop 58 */
-			/* Pre code */
-			for (int j12 = 0; j12 < 4; j12 = j12 + 1) {
-				fRec15_tmp[j12] = fRec15_perm[j12];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec15[i] = fSlow6 + fConst2 * fRec15[i - 1];
-			}
-			/* Post code */
-			for (int j13 = 0; j13 < 4; j13 = j13 + 1) {
-				fRec15_perm[j13] = fRec15_tmp[vsize + j13];
-			}
-			/* Vectorizable loop 59 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec4[i] = fSlow9 * (0.0f - fZec3[i]) + fSlow10 * fZec3[i];
-			}
-			/* Vectorizable loop 60 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec6[i] = fSlow11 * (0.0f - fZec5[i]) + fSlow12 * fZec5[i];
-			}
-			/* Vectorizable loop 61 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec7[i] = 0.5f * (1.0f - fRec15[i]) * (fZec4[i] + fZec6[i]);
-			}
-			/* Vectorizable loop 62 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec8[i] = fRec15[i] * fZec4[i] + fZec7[i];
-			}
-			/* Vectorizable loop 63 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec9[i] = fZec7[i] + fRec15[i] * fZec6[i];
-			}
-			/* Recursive loop 64 */
-			/* Pre code */
-			for (int j72 = 0; j72 < 4; j72 = j72 + 1) {
-				fRec33_tmp[j72] = fRec33_perm[j72];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec33[i] = fConst98 * fRec33[i - 1] + fConst99 * fZec8[i];
-			}
-			/* Post code */
-			for (int j73 = 0; j73 < 4; j73 = j73 + 1) {
-				fRec33_perm[j73] = fRec33_tmp[vsize + j73];
-			}
-			/* Recursive loop 65 */
-			/* Pre code */
-			for (int j74 = 0; j74 < 4; j74 = j74 + 1) {
-				fRec34_tmp[j74] = fRec34_perm[j74];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec34[i] = fConst98 * fRec34[i - 1] + fConst99 * fZec9[i];
-			}
-			/* Post code */
-			for (int j75 = 0; j75 < 4; j75 = j75 + 1) {
-				fRec34_perm[j75] = fRec34_tmp[vsize + j75];
-			}
-			/* Vectorizable loop 66 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec10[i] = fZec8[i] - fRec33[i];
-			}
-			/* Vectorizable loop 67 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec11[i] = fZec9[i] - fRec34[i];
-			}
-			/* Recursive loop 68 */
-			/* Pre code */
-			for (int j76 = 0; j76 < 4; j76 = j76 + 1) {
-				fRec32_tmp[j76] = fRec32_perm[j76];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec32[i] = fConst98 * fRec32[i - 1] + fConst99 * fZec10[i] * fZec11[i];
+				fRec32[i] = fConst98 * fRec32[i - 1] + fConst99 * fZec10[i] * fZec11[i];
 			}
 			/* Post code */
 			for (int j77 = 0; j77 < 4; j77 = j77 + 1) {
 				fRec32_perm[j77] = fRec32_tmp[vsize + j77];
 			}
-			/* Recursive loop 69 */
+			/* Recursive loop 25 */
 			/* Pre code */
 			for (int j78 = 0; j78 < 4; j78 = j78 + 1) {
 				fRec35_tmp[j78] = fRec35_perm[j78];
@@ -6680,7 +5485,7 @@ class mydsp : public dsp {
 			for (int j79 = 0; j79 < 4; j79 = j79 + 1) {
 				fRec35_perm[j79] = fRec35_tmp[vsize + j79];
 			}
-			/* Recursive loop 70 */
+			/* Recursive loop 26 */
 			/* Pre code */
 			for (int j80 = 0; j80 < 4; j80 = j80 + 1) {
 				fRec36_tmp[j80] = fRec36_perm[j80];
@@ -6693,12 +5498,12 @@ class mydsp : public dsp {
 			for (int j81 = 0; j81 < 4; j81 = j81 + 1) {
 				fRec36_perm[j81] = fRec36_tmp[vsize + j81];
 			}
-			/* Vectorizable loop 71 */
+			/* Vectorizable loop 27 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec12[i] = fRec32[i] / std::max<float>(1.1920929e-07f, std::sqrt(fRec35[i]) * std::sqrt(fRec36[i]));
 			}
-			/* Recursive loop 72 */
+			/* Recursive loop 28 */
 			/* Pre code */
 			for (int j82 = 0; j82 < 4; j82 = j82 + 1) {
 				fRec31_tmp[j82] = fRec31_perm[j82];
@@ -6711,7 +5516,7 @@ class mydsp : public dsp {
 			for (int j83 = 0; j83 < 4; j83 = j83 + 1) {
 				fRec31_perm[j83] = fRec31_tmp[vsize + j83];
 			}
-			/* Recursive loop 73 */
+			/* Recursive loop 29 */
 			/* Pre code */
 			for (int j86 = 0; j86 < 4; j86 = j86 + 1) {
 				fRec38_tmp[j86] = fRec38_perm[j86];
@@ -6724,7 +5529,7 @@ class mydsp : public dsp {
 			for (int j87 = 0; j87 < 4; j87 = j87 + 1) {
 				fRec38_perm[j87] = fRec38_tmp[vsize + j87];
 			}
-			/* Recursive loop 74 */
+			/* Recursive loop 30 */
 			/* Pre code */
 			for (int j90 = 0; j90 < 4; j90 = j90 + 1) {
 				fRec40_tmp[j90] = fRec40_perm[j90];
@@ -6737,7 +5542,7 @@ class mydsp : public dsp {
 			for (int j91 = 0; j91 < 4; j91 = j91 + 1) {
 				fRec40_perm[j91] = fRec40_tmp[vsize + j91];
 			}
-			/* Recursive loop 75 */
+			/* Recursive loop 31 */
 			/* Pre code */
 			for (int j94 = 0; j94 < 4; j94 = j94 + 1) {
 				fRec42_tmp[j94] = fRec42_perm[j94];
@@ -6750,7 +5555,7 @@ class mydsp : public dsp {
 			for (int j95 = 0; j95 < 4; j95 = j95 + 1) {
 				fRec42_perm[j95] = fRec42_tmp[vsize + j95];
 			}
-			/* Recursive loop 76 */
+			/* Recursive loop 32 */
 			/* Pre code */
 			for (int j98 = 0; j98 < 4; j98 = j98 + 1) {
 				fRec44_tmp[j98] = fRec44_perm[j98];
@@ -6763,7 +5568,7 @@ class mydsp : public dsp {
 			for (int j99 = 0; j99 < 4; j99 = j99 + 1) {
 				fRec44_perm[j99] = fRec44_tmp[vsize + j99];
 			}
-			/* Recursive loop 77 */
+			/* Recursive loop 33 */
 			/* Pre code */
 			for (int j10 = 0; j10 < 4; j10 = j10 + 1) {
 				fRec14_tmp[j10] = fRec14_perm[j10];
@@ -6776,7 +5581,7 @@ class mydsp : public dsp {
 			for (int j11 = 0; j11 < 4; j11 = j11 + 1) {
 				fRec14_perm[j11] = fRec14_tmp[vsize + j11];
 			}
-			/* Recursive loop 78 */
+			/* Recursive loop 34 */
 			/* Pre code */
 			for (int j84 = 0; j84 < 4; j84 = j84 + 1) {
 				fRec30_tmp[j84] = fRec30_perm[j84];
@@ -6789,7 +5594,7 @@ class mydsp : public dsp {
 			for (int j85 = 0; j85 < 4; j85 = j85 + 1) {
 				fRec30_perm[j85] = fRec30_tmp[vsize + j85];
 			}
-			/* Recursive loop 79 */
+			/* Recursive loop 35 */
 			/* Pre code */
 			for (int j88 = 0; j88 < 4; j88 = j88 + 1) {
 				fRec37_tmp[j88] = fRec37_perm[j88];
@@ -6802,7 +5607,7 @@ class mydsp : public dsp {
 			for (int j89 = 0; j89 < 4; j89 = j89 + 1) {
 				fRec37_perm[j89] = fRec37_tmp[vsize + j89];
 			}
-			/* Recursive loop 80 */
+			/* Recursive loop 36 */
 			/* Pre code */
 			for (int j92 = 0; j92 < 4; j92 = j92 + 1) {
 				fRec39_tmp[j92] = fRec39_perm[j92];
@@ -6815,7 +5620,7 @@ class mydsp : public dsp {
 			for (int j93 = 0; j93 < 4; j93 = j93 + 1) {
 				fRec39_perm[j93] = fRec39_tmp[vsize + j93];
 			}
-			/* Recursive loop 81 */
+			/* Recursive loop 37 */
 			/* Pre code */
 			for (int j96 = 0; j96 < 4; j96 = j96 + 1) {
 				fRec41_tmp[j96] = fRec41_perm[j96];
@@ -6828,7 +5633,7 @@ class mydsp : public dsp {
 			for (int j97 = 0; j97 < 4; j97 = j97 + 1) {
 				fRec41_perm[j97] = fRec41_tmp[vsize + j97];
 			}
-			/* Recursive loop 82 */
+			/* Recursive loop 38 */
 			/* Pre code */
 			for (int j100 = 0; j100 < 4; j100 = j100 + 1) {
 				fRec43_tmp[j100] = fRec43_perm[j100];
@@ -6841,42 +5646,42 @@ class mydsp : public dsp {
 			for (int j101 = 0; j101 < 4; j101 = j101 + 1) {
 				fRec43_perm[j101] = fRec43_tmp[vsize + j101];
 			}
-			/* Vectorizable loop 83 */
+			/* Vectorizable loop 39 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec14[i] = fZec8[i] + fZec9[i];
 			}
-			/* Vectorizable loop 84 */
+			/* Vectorizable loop 40 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec13[i] = 1.0f - fRec14[i];
 			}
-			/* Vectorizable loop 85 */
+			/* Vectorizable loop 41 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec15[i] = 0.5f * (fRec30[i] * fZec14[i] + fRec37[i] * (fZec8[i] - fZec9[i])) + fRec39[i] * fZec14[i];
 			}
-			/* Vectorizable loop 86 */
+			/* Vectorizable loop 42 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec16[i] = fRec41[i] + fRec43[i];
 			}
-			/* Vectorizable loop 87 */
+			/* Vectorizable loop 43 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec18[i] = fRec14[i] * fZec9[i] + fZec13[i] * (fZec15[i] + fZec9[i] * fZec16[i]);
 			}
-			/* Vectorizable loop 88 */
+			/* Vectorizable loop 44 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec17[i] = fRec14[i] * fZec8[i] + fZec13[i] * (fZec15[i] + fZec8[i] * fZec16[i]);
 			}
-			/* Vectorizable loop 89 */
+			/* Vectorizable loop 45 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec19[i] = std::fabs(fZec18[i]);
 			}
-			/* Recursive loop 90 */
+			/* Recursive loop 46 */
 			/* Pre code */
 			for (int j102 = 0; j102 < 4; j102 = j102 + 1) {
 				fRec48_tmp[j102] = fRec48_perm[j102];
@@ -6889,7 +5694,7 @@ class mydsp : public dsp {
 			for (int j103 = 0; j103 < 4; j103 = j103 + 1) {
 				fRec48_perm[j103] = fRec48_tmp[vsize + j103];
 			}
-			/* Vectorizable loop 91 */
+			/* Vectorizable loop 47 */
 			/* Pre code */
 			for (int j104 = 0; j104 < 4; j104 = j104 + 1) {
 				iYec47_tmp[j104] = iYec47_perm[j104];
@@ -6902,7 +5707,7 @@ class mydsp : public dsp {
 			for (int j105 = 0; j105 < 4; j105 = j105 + 1) {
 				iYec47_perm[j105] = iYec47_tmp[vsize + j105];
 			}
-			/* Recursive loop 92 */
+			/* Recursive loop 48 */
 			/* Pre code */
 			for (int j106 = 0; j106 < 4; j106 = j106 + 1) {
 				iRec49_tmp[j106] = iRec49_perm[j106];
@@ -6915,12 +5720,12 @@ class mydsp : public dsp {
 			for (int j107 = 0; j107 < 4; j107 = j107 + 1) {
 				iRec49_perm[j107] = iRec49_tmp[vsize + j107];
 			}
-			/* Vectorizable loop 93 */
+			/* Vectorizable loop 49 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec20[i] = std::fabs(std::max<float>(float(iYec47[i]), float(iRec49[i] > 0)));
 			}
-			/* Recursive loop 94 */
+			/* Recursive loop 50 */
 			/* Pre code */
 			for (int j108 = 0; j108 < 4; j108 = j108 + 1) {
 				fRec47_tmp[j108] = fRec47_perm[j108];
@@ -6934,13 +5739,13 @@ class mydsp : public dsp {
 			for (int j109 = 0; j109 < 4; j109 = j109 + 1) {
 				fRec47_perm[j109] = fRec47_tmp[vsize + j109];
 			}
-			/* Vectorizable loop 95 */
+			/* Vectorizable loop 51 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fVbargraph3 = FAUSTFLOAT(std::max<float>(-70.0f, 20.0f * std::log10(std::max<float>(1.17549435e-38f, fRec47[i]))));
 				fZec22[i] = fZec17[i];
 			}
-			/* Recursive loop 96 */
+			/* Recursive loop 52 */
 			/* Pre code */
 			for (int j110 = 0; j110 < 4; j110 = j110 + 1) {
 				fRec46_tmp[j110] = fRec46_perm[j110];
@@ -6953,7 +5758,7 @@ class mydsp : public dsp {
 			for (int j111 = 0; j111 < 4; j111 = j111 + 1) {
 				fRec46_perm[j111] = fRec46_tmp[vsize + j111];
 			}
-			/* Vectorizable loop 97 */
+			/* Vectorizable loop 53 */
 			/* Pre code */
 			for (int j112 = 0; j112 < 4; j112 = j112 + 1) {
 				iYec48_tmp[j112] = iYec48_perm[j112];
@@ -6966,7 +5771,7 @@ class mydsp : public dsp {
 			for (int j113 = 0; j113 < 4; j113 = j113 + 1) {
 				iYec48_perm[j113] = iYec48_tmp[vsize + j113];
 			}
-			/* Recursive loop 98 */
+			/* Recursive loop 54 */
 			/* Pre code */
 			for (int j114 = 0; j114 < 4; j114 = j114 + 1) {
 				iRec50_tmp[j114] = iRec50_perm[j114];
@@ -6979,12 +5784,12 @@ class mydsp : public dsp {
 			for (int j115 = 0; j115 < 4; j115 = j115 + 1) {
 				iRec50_perm[j115] = iRec50_tmp[vsize + j115];
 			}
-			/* Vectorizable loop 99 */
+			/* Vectorizable loop 55 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec23[i] = std::fabs(std::max<float>(float(iYec48[i]), float(iRec50[i] > 0)));
 			}
-			/* Recursive loop 100 */
+			/* Recursive loop 56 */
 			/* Pre code */
 			for (int j8 = 0; j8 < 4; j8 = j8 + 1) {
 				fRec13_tmp[j8] = fRec13_perm[j8];
@@ -6997,7 +5802,7 @@ class mydsp : public dsp {
 			for (int j9 = 0; j9 < 4; j9 = j9 + 1) {
 				fRec13_perm[j9] = fRec13_tmp[vsize + j9];
 			}
-			/* Recursive loop 101 */
+			/* Recursive loop 57 */
 			/* Pre code */
 			for (int j116 = 0; j116 < 4; j116 = j116 + 1) {
 				fRec45_tmp[j116] = fRec45_perm[j116];
@@ -7011,17 +5816,17 @@ class mydsp : public dsp {
 			for (int j117 = 0; j117 < 4; j117 = j117 + 1) {
 				fRec45_perm[j117] = fRec45_tmp[vsize + j117];
 			}
-			/* Vectorizable loop 102 */
+			/* Vectorizable loop 58 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec25[i] = fRec45[i] * (1.0f - fRec13[i]);
 			}
-			/* Vectorizable loop 103 */
+			/* Vectorizable loop 59 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec28[i] = fRec13[i] + fZec25[i];
 			}
-			/* Vectorizable loop 104 */
+			/* Vectorizable loop 60 */
 			/* Pre code */
 			for (int j118 = 0; j118 < 4; j118 = j118 + 1) {
 				fYec49_tmp[j118] = fYec49_perm[j118];
@@ -7034,20 +5839,7 @@ class mydsp : public dsp {
 			for (int j119 = 0; j119 < 4; j119 = j119 + 1) {
 				fYec49_perm[j119] = fYec49_tmp[vsize + j119];
 			}
-			/* Recursive loop 105 */
-			/* Pre code */
-			for (int j126 = 0; j126 < 4; j126 = j126 + 1) {
-				fRec55_tmp[j126] = fRec55_perm[j126];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec55[i] = fSlow31 + fConst2 * fRec55[i - 1];
-			}
-			/* Post code */
-			for (int j127 = 0; j127 < 4; j127 = j127 + 1) {
-				fRec55_perm[j127] = fRec55_tmp[vsize + j127];
-			}
-			/* Vectorizable loop 106 */
+			/* Vectorizable loop 62 */
 			/* Pre code */
 			for (int j134 = 0; j134 < 4; j134 = j134 + 1) {
 				fYec51_tmp[j134] = fYec51_perm[j134];
@@ -7060,7 +5852,7 @@ class mydsp : public dsp {
 			for (int j135 = 0; j135 < 4; j135 = j135 + 1) {
 				fYec51_perm[j135] = fYec51_tmp[vsize + j135];
 			}
-			/* Recursive loop 107 */
+			/* Recursive loop 63 */
 			/* Pre code */
 			for (int j120 = 0; j120 < 4; j120 = j120 + 1) {
 				fRec53_tmp[j120] = fRec53_perm[j120];
@@ -7073,12 +5865,7 @@ class mydsp : public dsp {
 			for (int j121 = 0; j121 < 4; j121 = j121 + 1) {
 				fRec53_perm[j121] = fRec53_tmp[vsize + j121];
 			}
-			/* Vectorizable loop 108 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec26[i] = 0.0500000007f * fRec55[i];
-			}
-			/* Recursive loop 109 */
+			/* Recursive loop 65 */
 			/* Pre code */
 			for (int j136 = 0; j136 < 4; j136 = j136 + 1) {
 				fRec59_tmp[j136] = fRec59_perm[j136];
@@ -7091,7 +5878,7 @@ class mydsp : public dsp {
 			for (int j137 = 0; j137 < 4; j137 = j137 + 1) {
 				fRec59_perm[j137] = fRec59_tmp[vsize + j137];
 			}
-			/* Recursive loop 110 */
+			/* Recursive loop 66 */
 			/* Pre code */
 			for (int j122 = 0; j122 < 4; j122 = j122 + 1) {
 				fRec52_tmp[j122] = fRec52_perm[j122];
@@ -7104,7 +5891,7 @@ class mydsp : public dsp {
 			for (int j123 = 0; j123 < 4; j123 = j123 + 1) {
 				fRec52_perm[j123] = fRec52_tmp[vsize + j123];
 			}
-			/* Recursive loop 111 */
+			/* Recursive loop 67 */
 			/* Pre code */
 			for (int j124 = 0; j124 < 4; j124 = j124 + 1) {
 				fRec54_tmp[j124] = fRec54_perm[j124];
@@ -7117,12 +5904,7 @@ class mydsp : public dsp {
 			for (int j125 = 0; j125 < 4; j125 = j125 + 1) {
 				fRec54_perm[j125] = fRec54_tmp[vsize + j125];
 			}
-			/* Vectorizable loop 112 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec27[i] = std::pow(10.0f, 0.0f - fZec26[i]);
-			}
-			/* Recursive loop 113 */
+			/* Recursive loop 69 */
 			/* Pre code */
 			for (int j138 = 0; j138 < 4; j138 = j138 + 1) {
 				fRec58_tmp[j138] = fRec58_perm[j138];
@@ -7135,7 +5917,7 @@ class mydsp : public dsp {
 			for (int j139 = 0; j139 < 4; j139 = j139 + 1) {
 				fRec58_perm[j139] = fRec58_tmp[vsize + j139];
 			}
-			/* Recursive loop 114 */
+			/* Recursive loop 70 */
 			/* Pre code */
 			for (int j140 = 0; j140 < 4; j140 = j140 + 1) {
 				fRec60_tmp[j140] = fRec60_perm[j140];
@@ -7148,46 +5930,33 @@ class mydsp : public dsp {
 			for (int j141 = 0; j141 < 4; j141 = j141 + 1) {
 				fRec60_perm[j141] = fRec60_tmp[vsize + j141];
 			}
-			/* Vectorizable loop 115 */
+			/* Vectorizable loop 71 */
 			/* Pre code */
 			for (int j128 = 0; j128 < 4; j128 = j128 + 1) {
 				fYec50_tmp[j128] = fYec50_perm[j128];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec50[i] = fRec52[i] + fRec54[i] * fZec27[i];
+				fYec50[i] = fRec52[i] + fRec54[i] * fSlow302;
 			}
 			/* Post code */
 			for (int j129 = 0; j129 < 4; j129 = j129 + 1) {
 				fYec50_perm[j129] = fYec50_tmp[vsize + j129];
 			}
-			/* Vectorizable loop 116 */
+			/* Vectorizable loop 72 */
 			/* Pre code */
 			for (int j142 = 0; j142 < 4; j142 = j142 + 1) {
 				fYec52_tmp[j142] = fYec52_perm[j142];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec52[i] = fRec58[i] + fRec60[i] * fZec27[i];
+				fYec52[i] = fRec58[i] + fRec60[i] * fSlow302;
 			}
 			/* Post code */
 			for (int j143 = 0; j143 < 4; j143 = j143 + 1) {
 				fYec52_perm[j143] = fYec52_tmp[vsize + j143];
 			}
-			/* Recursive loop 117 */
-			/* Pre code */
-			for (int j148 = 0; j148 < 4; j148 = j148 + 1) {
-				fRec70_tmp[j148] = fRec70_perm[j148];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fRec70[i] = fSlow32 + fConst2 * fRec70[i - 1];
-			}
-			/* Post code */
-			for (int j149 = 0; j149 < 4; j149 = j149 + 1) {
-				fRec70_perm[j149] = fRec70_tmp[vsize + j149];
-			}
-			/* Recursive loop 118 */
+			/* Recursive loop 74 */
 			/* Pre code */
 			for (int j130 = 0; j130 < 4; j130 = j130 + 1) {
 				fRec51_tmp[j130] = fRec51_perm[j130];
@@ -7200,7 +5969,7 @@ class mydsp : public dsp {
 			for (int j131 = 0; j131 < 4; j131 = j131 + 1) {
 				fRec51_perm[j131] = fRec51_tmp[vsize + j131];
 			}
-			/* Recursive loop 119 */
+			/* Recursive loop 75 */
 			/* Pre code */
 			for (int j132 = 0; j132 < 4; j132 = j132 + 1) {
 				fRec56_tmp[j132] = fRec56_perm[j132];
@@ -7213,7 +5982,7 @@ class mydsp : public dsp {
 			for (int j133 = 0; j133 < 4; j133 = j133 + 1) {
 				fRec56_perm[j133] = fRec56_tmp[vsize + j133];
 			}
-			/* Recursive loop 120 */
+			/* Recursive loop 76 */
 			/* Pre code */
 			for (int j144 = 0; j144 < 4; j144 = j144 + 1) {
 				fRec57_tmp[j144] = fRec57_perm[j144];
@@ -7226,7 +5995,7 @@ class mydsp : public dsp {
 			for (int j145 = 0; j145 < 4; j145 = j145 + 1) {
 				fRec57_perm[j145] = fRec57_tmp[vsize + j145];
 			}
-			/* Recursive loop 121 */
+			/* Recursive loop 77 */
 			/* Pre code */
 			for (int j146 = 0; j146 < 4; j146 = j146 + 1) {
 				fRec61_tmp[j146] = fRec61_perm[j146];
@@ -7239,52 +6008,27 @@ class mydsp : public dsp {
 			for (int j147 = 0; j147 < 4; j147 = j147 + 1) {
 				fRec61_perm[j147] = fRec61_tmp[vsize + j147];
 			}
-			/* Vectorizable loop 122 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec29[i] = std::pow(10.0f, fZec26[i]);
-			}
-			/* Vectorizable loop 123 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec34[i] = 0.0250000004f * fRec70[i];
-			}
-			/* Vectorizable loop 124 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec30[i] = fRec51[i] + fRec56[i] * fZec29[i];
-			}
-			/* Vectorizable loop 125 */
+			/* Vectorizable loop 80 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec31[i] = fRec57[i] + fRec61[i] * fZec29[i];
+				fZec30[i] = fRec51[i] + fRec56[i] * fSlow303;
 			}
-			/* Vectorizable loop 126 */
+			/* Vectorizable loop 81 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec35[i] = std::pow(10.0f, 0.0f - fZec34[i]);
+				fZec31[i] = fRec57[i] + fRec61[i] * fSlow303;
 			}
-			/* Vectorizable loop 127 */
+			/* Vectorizable loop 83 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec32[i] = fZec30[i] - fZec31[i];
 			}
-			/* Vectorizable loop 128 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec36[i] = std::sqrt(fZec35[i]);
-			}
-			/* Vectorizable loop 129 */
+			/* Vectorizable loop 85 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec33[i] = 0.5f * fZec32[i];
 			}
-			/* Vectorizable loop 130 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec38[i] = fSlow35 * (fSlow35 / fZec36[i] + 1.42857146f) / fZec36[i] + 1.0f;
-			}
-			/* Recursive loop 131 */
+			/* Recursive loop 87 */
 			/* Pre code */
 			for (int j150 = 0; j150 < 4; j150 = j150 + 1) {
 				fRec66_tmp[j150] = fRec66_perm[j150];
@@ -7294,10 +6038,10 @@ class mydsp : public dsp {
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec37[i] = fRec66[i - 1] + fSlow35 * (fZec33[i] - fRec67[i - 1]) / fZec36[i];
-				fZec39[i] = fZec37[i] / fZec38[i];
+				fZec37[i] = fRec66[i - 1] + fSlow35 * (fZec33[i] - fRec67[i - 1]) / fSlow305;
+				fZec39[i] = fZec37[i] / fSlow312;
 				fRec66[i] = 2.0f * fZec39[i] - fRec66[i - 1];
-				fZec40[i] = fRec67[i - 1] + fSlow35 * fZec37[i] / (fZec36[i] * fZec38[i]);
+				fZec40[i] = fRec67[i - 1] + fSlow35 * fZec37[i] / (fSlow305 * fSlow312);
 				fRec67[i] = 2.0f * fZec40[i] - fRec67[i - 1];
 				fRec68[i] = fZec39[i];
 				fRec69[i] = fZec40[i];
@@ -7309,37 +6053,22 @@ class mydsp : public dsp {
 			for (int j153 = 0; j153 < 4; j153 = j153 + 1) {
 				fRec67_perm[j153] = fRec67_tmp[vsize + j153];
 			}
-			/* Vectorizable loop 132 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec44[i] = std::pow(10.0f, fZec34[i]);
-			}
-			/* Vectorizable loop 133 */
+			/* Vectorizable loop 89 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec41[i] = fRec68[i] * (fZec35[i] + -1.0f);
+				fZec41[i] = fRec68[i] * fSlow306;
 			}
-			/* Vectorizable loop 134 */
+			/* Vectorizable loop 90 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec42[i] = fRec69[i] * (mydsp_faustpower2_f(fZec35[i]) + -1.0f);
+				fZec42[i] = fRec69[i] * fSlow307;
 			}
-			/* Vectorizable loop 135 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec45[i] = std::sqrt(fZec44[i]);
-			}
-			/* Vectorizable loop 136 */
+			/* Vectorizable loop 92 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec43[i] = fZec33[i] + 1.42857146f * fZec41[i] + fZec42[i];
 			}
-			/* Vectorizable loop 137 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec47[i] = fSlow36 * (fSlow36 / fZec45[i] + 1.42857146f) / fZec45[i] + 1.0f;
-			}
-			/* Recursive loop 138 */
+			/* Recursive loop 94 */
 			/* Pre code */
 			for (int j6 = 0; j6 < 4; j6 = j6 + 1) {
 				fRec12_tmp[j6] = fRec12_perm[j6];
@@ -7352,7 +6081,7 @@ class mydsp : public dsp {
 			for (int j7 = 0; j7 < 4; j7 = j7 + 1) {
 				fRec12_perm[j7] = fRec12_tmp[vsize + j7];
 			}
-			/* Recursive loop 139 */
+			/* Recursive loop 95 */
 			/* Pre code */
 			for (int j154 = 0; j154 < 4; j154 = j154 + 1) {
 				fRec62_tmp[j154] = fRec62_perm[j154];
@@ -7362,10 +6091,10 @@ class mydsp : public dsp {
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec46[i] = fRec62[i - 1] + fSlow36 * (fZec43[i] - fRec63[i - 1]) / fZec45[i];
-				fZec48[i] = fZec46[i] / fZec47[i];
+				fZec46[i] = fRec62[i - 1] + fSlow36 * (fZec43[i] - fRec63[i - 1]) / fSlow309;
+				fZec48[i] = fZec46[i] / fSlow313;
 				fRec62[i] = 2.0f * fZec48[i] - fRec62[i - 1];
-				fZec49[i] = fRec63[i - 1] + fSlow36 * fZec46[i] / (fZec45[i] * fZec47[i]);
+				fZec49[i] = fRec63[i - 1] + fSlow36 * fZec46[i] / (fSlow309 * fSlow313);
 				fRec63[i] = 2.0f * fZec49[i] - fRec63[i - 1];
 				fRec64[i] = fZec48[i];
 				fRec65[i] = fZec49[i];
@@ -7377,208 +6106,134 @@ class mydsp : public dsp {
 			for (int j157 = 0; j157 < 4; j157 = j157 + 1) {
 				fRec63_perm[j157] = fRec63_tmp[vsize + j157];
 			}
-			/* Vectorizable loop 140 */
+			/* Vectorizable loop 96 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec50[i] = 1.0f - fRec12[i];
 			}
-			/* Vectorizable loop 141 */
+			/* Vectorizable loop 97 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec51[i] = fZec30[i] + fZec31[i];
 			}
-			/* Vectorizable loop 142 */
+			/* Vectorizable loop 98 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fZec52[i] = fRec65[i] * (mydsp_faustpower2_f(fZec44[i]) + -1.0f) + fZec42[i] + 1.42857146f * (fZec41[i] + fRec64[i] * (fZec44[i] + -1.0f));
+				fZec52[i] = fRec65[i] * fSlow310 + fZec42[i] + 1.42857146f * (fZec41[i] + fRec64[i] * fSlow311);
 			}
-			/* Vectorizable loop 143 */
+			/* Vectorizable loop 99 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec53[i] = fRec12[i] * fYec49[i] + fZec50[i] * (0.5f * (fZec51[i] + fZec32[i]) + fZec52[i]);
 			}
-			/* Vectorizable loop 144 */
+			/* Vectorizable loop 100 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec54[i] = fRec12[i] * fZec18[i] * fZec28[i] + fZec50[i] * (0.5f * (fZec51[i] - fZec32[i]) - fZec52[i]);
 			}
-			/* Vectorizable loop 145 */
+			/* Vectorizable loop 101 */
+			/* Compute code */
+			for (int i = 0; i < vsize; i = i + 1) {
+				fZec801[i] = std::fabs(std::fabs(fZec53[i]) + std::fabs(fZec54[i]));
+			}
+			/* Recursive loop 102 */
 			/* Pre code */
 			for (int j158 = 0; j158 < 4; j158 = j158 + 1) {
-				fYec53_tmp[j158] = fYec53_perm[j158];
+				iRec51_tmp[j158] = iRec51_perm[j158];
 			}
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec53[i] = std::fabs(std::fabs(fZec53[i]) + std::fabs(fZec54[i]));
+				iRec51[i] = (iRec51[i - 1] + 1) % iConst112;
 			}
 			/* Post code */
 			for (int j159 = 0; j159 < 4; j159 = j159 + 1) {
-				fYec53_perm[j159] = fYec53_tmp[vsize + j159];
-			}
-			/* Vectorizable loop 146 */
-			/* Pre code */
-			for (int j160 = 0; j160 < 4; j160 = j160 + 1) {
-				fYec54_tmp[j160] = fYec54_perm[j160];
+				iRec51_perm[j159] = iRec51_tmp[vsize + j159];
 			}
+			/* Vectorizable loop 103 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec54[i] = std::max<float>(fYec53[i], fYec53[i - 1]);
+				iZec802[i] = iRec51[i] == 0;
+			}
+			/* Recursive loop 104 */
+			/* Pre code */
+			for (int j160 = 0; j160 < 4; j160 = j160 + 1) {
+				fRec612_tmp[j160] = fRec612_perm[j160];
 			}
-			/* Post code */
 			for (int j161 = 0; j161 < 4; j161 = j161 + 1) {
-				fYec54_perm[j161] = fYec54_tmp[vsize + j161];
+				fRec613_tmp[j161] = fRec613_perm[j161];
 			}
-			/* Vectorizable loop 147 */
-			/* Pre code */
-			for (int j162 = 0; j162 < 8; j162 = j162 + 1) {
-				fYec55_tmp[j162] = fYec55_perm[j162];
+			for (int j162 = 0; j162 < 4; j162 = j162 + 1) {
+				fRec614_tmp[j162] = fRec614_perm[j162];
 			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec55[i] = std::max<float>(fYec54[i], fYec54[i - 2]);
+			for (int j163 = 0; j163 < 4; j163 = j163 + 1) {
+				fRec615_tmp[j163] = fRec615_perm[j163];
 			}
-			/* Post code */
-			for (int j163 = 0; j163 < 8; j163 = j163 + 1) {
-				fYec55_perm[j163] = fYec55_tmp[vsize + j163];
+			for (int j164 = 0; j164 < 4; j164 = j164 + 1) {
+				fRec616_tmp[j164] = fRec616_perm[j164];
 			}
-			/* Vectorizable loop 148 */
-			/* Pre code */
-			for (int j164 = 0; j164 < 16; j164 = j164 + 1) {
-				fYec56_tmp[j164] = fYec56_perm[j164];
+			for (int j165 = 0; j165 < 4; j165 = j165 + 1) {
+				fRec617_tmp[j165] = fRec617_perm[j165];
 			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec56[i] = std::max<float>(fYec55[i], fYec55[i - 4]);
+			for (int j166 = 0; j166 < 4; j166 = j166 + 1) {
+				fRec618_tmp[j166] = fRec618_perm[j166];
 			}
-			/* Post code */
-			for (int j165 = 0; j165 < 16; j165 = j165 + 1) {
-				fYec56_perm[j165] = fYec56_tmp[vsize + j165];
+			for (int j167 = 0; j167 < 4; j167 = j167 + 1) {
+				fRec619_tmp[j167] = fRec619_perm[j167];
 			}
-			/* Vectorizable loop 149 */
-			/* Pre code */
-			fYec57_idx = (fYec57_idx + fYec57_idx_save) & 63;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec57[(i + fYec57_idx) & 63] = std::max<float>(fYec56[i], fYec56[i - 8]);
+			for (int j168 = 0; j168 < 4; j168 = j168 + 1) {
+				fRec620_tmp[j168] = fRec620_perm[j168];
 			}
-			/* Post code */
-			fYec57_idx_save = vsize;
-			/* Vectorizable loop 150 */
-			/* Pre code */
-			fYec58_idx = (fYec58_idx + fYec58_idx_save) & 127;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec58[(i + fYec58_idx) & 127] = std::max<float>(fYec57[(i + fYec57_idx) & 63], fYec57[((i + fYec57_idx) - 16) & 63]);
+				fRec612[i] = ((iZec802[i]) ? fZec801[i] : std::max<float>(fRec612[i - 1], fZec801[i]));
+				fRec613[i] = ((iZec802[i]) ? fRec612[i - 1] : fRec613[i - 1]);
+				fRec614[i] = ((iZec802[i]) ? fRec613[i - 1] : fRec614[i - 1]);
+				fRec615[i] = ((iZec802[i]) ? fRec614[i - 1] : fRec615[i - 1]);
+				fRec616[i] = ((iZec802[i]) ? fRec615[i - 1] : fRec616[i - 1]);
+				fRec617[i] = ((iZec802[i]) ? fRec616[i - 1] : fRec617[i - 1]);
+				fRec618[i] = ((iZec802[i]) ? fRec617[i - 1] : fRec618[i - 1]);
+				fRec619[i] = ((iZec802[i]) ? fRec618[i - 1] : fRec619[i - 1]);
+				fRec620[i] = ((iZec802[i]) ? fRec619[i - 1] : fRec620[i - 1]);
 			}
 			/* Post code */
-			fYec58_idx_save = vsize;
-			/* Vectorizable loop 151 */
-			/* Pre code */
-			fYec59_idx = (fYec59_idx + fYec59_idx_save) & 255;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec59[(i + fYec59_idx) & 255] = std::max<float>(fYec58[(i + fYec58_idx) & 127], fYec58[((i + fYec58_idx) - 32) & 127]);
+			for (int j169 = 0; j169 < 4; j169 = j169 + 1) {
+				fRec612_perm[j169] = fRec612_tmp[vsize + j169];
 			}
-			/* Post code */
-			fYec59_idx_save = vsize;
-			/* Vectorizable loop 152 */
-			/* Pre code */
-			fYec60_idx = (fYec60_idx + fYec60_idx_save) & 511;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec60[(i + fYec60_idx) & 511] = std::max<float>(fYec59[(i + fYec59_idx) & 255], fYec59[((i + fYec59_idx) - 64) & 255]);
+			for (int j170 = 0; j170 < 4; j170 = j170 + 1) {
+				fRec613_perm[j170] = fRec613_tmp[vsize + j170];
 			}
-			/* Post code */
-			fYec60_idx_save = vsize;
-			/* Vectorizable loop 153 */
-			/* Pre code */
-			fYec61_idx = (fYec61_idx + fYec61_idx_save) & 1023;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec61[(i + fYec61_idx) & 1023] = std::max<float>(fYec60[(i + fYec60_idx) & 511], fYec60[((i + fYec60_idx) - 128) & 511]);
+			for (int j171 = 0; j171 < 4; j171 = j171 + 1) {
+				fRec614_perm[j171] = fRec614_tmp[vsize + j171];
 			}
-			/* Post code */
-			fYec61_idx_save = vsize;
-			/* Vectorizable loop 154 */
-			/* Pre code */
-			fYec62_idx = (fYec62_idx + fYec62_idx_save) & 2047;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec62[(i + fYec62_idx) & 2047] = std::max<float>(fYec61[(i + fYec61_idx) & 1023], fYec61[((i + fYec61_idx) - 256) & 1023]);
+			for (int j172 = 0; j172 < 4; j172 = j172 + 1) {
+				fRec615_perm[j172] = fRec615_tmp[vsize + j172];
 			}
-			/* Post code */
-			fYec62_idx_save = vsize;
-			/* Vectorizable loop 155 */
-			/* Pre code */
-			fYec63_idx = (fYec63_idx + fYec63_idx_save) & 4095;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec63[(i + fYec63_idx) & 4095] = std::max<float>(fYec62[(i + fYec62_idx) & 2047], fYec62[((i + fYec62_idx) - 512) & 2047]);
+			for (int j173 = 0; j173 < 4; j173 = j173 + 1) {
+				fRec616_perm[j173] = fRec616_tmp[vsize + j173];
 			}
-			/* Post code */
-			fYec63_idx_save = vsize;
-			/* Vectorizable loop 156 */
-			/* Pre code */
-			fYec64_idx = (fYec64_idx + fYec64_idx_save) & 8191;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec64[(i + fYec64_idx) & 8191] = std::max<float>(fYec63[(i + fYec63_idx) & 4095], fYec63[((i + fYec63_idx) - 1024) & 4095]);
+			for (int j174 = 0; j174 < 4; j174 = j174 + 1) {
+				fRec617_perm[j174] = fRec617_tmp[vsize + j174];
 			}
-			/* Post code */
-			fYec64_idx_save = vsize;
-			/* Vectorizable loop 157 */
-			/* Pre code */
-			fYec65_idx = (fYec65_idx + fYec65_idx_save) & 16383;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec65[(i + fYec65_idx) & 16383] = std::max<float>(fYec64[(i + fYec64_idx) & 8191], fYec64[((i + fYec64_idx) - 2048) & 8191]);
+			for (int j175 = 0; j175 < 4; j175 = j175 + 1) {
+				fRec618_perm[j175] = fRec618_tmp[vsize + j175];
 			}
-			/* Post code */
-			fYec65_idx_save = vsize;
-			/* Vectorizable loop 158 */
-			/* Pre code */
-			fYec66_idx = (fYec66_idx + fYec66_idx_save) & 32767;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec66[(i + fYec66_idx) & 32767] = std::max<float>(fYec65[(i + fYec65_idx) & 16383], fYec65[((i + fYec65_idx) - 4096) & 16383]);
+			for (int j176 = 0; j176 < 4; j176 = j176 + 1) {
+				fRec619_perm[j176] = fRec619_tmp[vsize + j176];
 			}
-			/* Post code */
-			fYec66_idx_save = vsize;
-			/* Vectorizable loop 159 */
-			/* Pre code */
-			fYec67_idx = (fYec67_idx + fYec67_idx_save) & 65535;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec67[(i + fYec67_idx) & 65535] = std::max<float>(fYec66[(i + fYec66_idx) & 32767], fYec66[((i + fYec66_idx) - 8192) & 32767]);
+			for (int j177 = 0; j177 < 4; j177 = j177 + 1) {
+				fRec620_perm[j177] = fRec620_tmp[vsize + j177];
 			}
-			/* Post code */
-			fYec67_idx_save = vsize;
-			/* Vectorizable loop 160 */
+			/* Vectorizable loop 105 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				float fElse48 = fYec53[i];
-				float fElse49 = fYec54[i - iConst112];
-				float fElse50 = fYec55[i - iConst118];
-				float fElse51 = fYec56[i - iConst122];
-				float fElse52 = fYec57[((i + fYec57_idx) - iConst126) & 63];
-				float fElse53 = fYec58[((i + fYec58_idx) - iConst130) & 127];
-				float fElse54 = fYec59[((i + fYec59_idx) - iConst134) & 255];
-				float fElse55 = fYec60[((i + fYec60_idx) - iConst138) & 511];
-				float fElse56 = fYec61[((i + fYec61_idx) - iConst142) & 1023];
-				float fElse57 = fYec62[((i + fYec62_idx) - iConst146) & 2047];
-				float fElse58 = fYec63[((i + fYec63_idx) - iConst150) & 4095];
-				float fElse59 = fYec64[((i + fYec64_idx) - iConst154) & 8191];
-				float fElse60 = fYec65[((i + fYec65_idx) - iConst158) & 16383];
-				float fElse61 = fYec66[((i + fYec66_idx) - iConst162) & 32767];
-				float fElse62 = fYec67[((i + fYec67_idx) - iConst164) & 65535];
-				fZec55[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(((iConst112) ? fElse48 : -3.40282347e+38f), ((iConst114) ? fElse49 : -3.40282347e+38f)), ((iConst116) ? fElse50 : -3.40282347e+38f)), ((iConst120) ? fElse51 : -3.40282347e+38f)), ((iConst124) ? fElse52 : -3.40282347e+38f)), ((iConst128) ? fElse53 : -3.40282347e+38f)), ((iConst132) ? fElse54 : -3.40282347e+38f)), ((iConst136) ? fElse55 : -3.40282347e+38f)), ((iConst140) ? fElse56 : -3.40282347e+38f)), ((iConst144) ? fElse57 : -3.40282347e+38f)), ((iConst148) ? fElse58 : -3.40282347e+38f)), ((iConst152) ? fElse59 : -3.40282347e+38f)), ((iConst156) ? fElse60 : -3.40282347e+38f)), ((iConst160) ? fElse61 : -3.40282347e+38f)), ((iConst163) ? fElse62 : -3.40282347e+38f))));
-			}
-			/* Vectorizable loop 161 */
+				fZec55[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(std::max<float>(fRec612[i], fRec613[i]), fRec614[i]), fRec615[i]), fRec616[i]), fRec617[i]), fRec618[i]), fRec619[i]), fRec620[i])));
+			}
+			/* Vectorizable loop 117 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				iZec56[i] = (fZec55[i] > fSlow38) + (fZec55[i] > fSlow39);
 			}
-			/* Vectorizable loop 162 */
+			/* Vectorizable loop 118 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				float fElse63 = 0.0f - 0.0416666679f * mydsp_faustpower2_f((fZec55[i] + -6.0f) - fSlow37);
@@ -7586,7 +6241,7 @@ class mydsp : public dsp {
 				float fElse64 = fZec55[i] - fSlow37;
 				fZec57[i] = std::max<float>(-120.0f, 2.0f * ((iZec56[i] == 0) ? fElse64 : fThen64));
 			}
-			/* Recursive loop 163 */
+			/* Recursive loop 119 */
 			/* Pre code */
 			for (int j166 = 0; j166 < 4; j166 = j166 + 1) {
 				fRec11_tmp[j166] = fRec11_perm[j166];
@@ -7600,18 +6255,18 @@ class mydsp : public dsp {
 			for (int j167 = 0; j167 < 4; j167 = j167 + 1) {
 				fRec11_perm[j167] = fRec11_tmp[vsize + j167];
 			}
-			/* Vectorizable loop 164 */
+			/* Vectorizable loop 120 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec59[i] = std::min<float>(1.0f, std::max<float>(0.0f, std::pow(10.0f, 0.0500000007f * fRec11[i])));
 			}
-			/* Vectorizable loop 165 */
+			/* Vectorizable loop 121 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fVbargraph4 = FAUSTFLOAT(100.0f * (1.0f - fZec59[i]));
-				fZec60[i] = fSlow40 / fZec59[i];
+				fZec60[i] = fSlow40 * fZec59[i];
 			}
-			/* Recursive loop 166 */
+			/* Recursive loop 122 */
 			/* Pre code */
 			for (int j2 = 0; j2 < 4; j2 = j2 + 1) {
 				fRec7_tmp[j2] = fRec7_perm[j2];
@@ -7624,12 +6279,12 @@ class mydsp : public dsp {
 			for (int j3 = 0; j3 < 4; j3 = j3 + 1) {
 				fRec7_perm[j3] = fRec7_tmp[vsize + j3];
 			}
-			/* Vectorizable loop 167 */
+			/* Vectorizable loop 123 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				iZec61[i] = std::fabs(fZec60[i]) < 1.1920929e-07f;
+				iZec61[i] = fZec60[i] < 0.00100000005f;
 			}
-			/* Recursive loop 168 */
+			/* Recursive loop 124 */
 			/* Pre code */
 			for (int j214 = 0; j214 < 4; j214 = j214 + 1) {
 				fRec80_tmp[j214] = fRec80_perm[j214];
@@ -7642,7 +6297,7 @@ class mydsp : public dsp {
 			for (int j215 = 0; j215 < 4; j215 = j215 + 1) {
 				fRec80_perm[j215] = fRec80_tmp[vsize + j215];
 			}
-			/* Recursive loop 169 */
+			/* Recursive loop 125 */
 			/* Pre code */
 			for (int j222 = 0; j222 < 4; j222 = j222 + 1) {
 				fRec86_tmp[j222] = fRec86_perm[j222];
@@ -7655,7 +6310,7 @@ class mydsp : public dsp {
 			for (int j223 = 0; j223 < 4; j223 = j223 + 1) {
 				fRec86_perm[j223] = fRec86_tmp[vsize + j223];
 			}
-			/* Recursive loop 170 */
+			/* Recursive loop 126 */
 			/* Pre code */
 			for (int j742 = 0; j742 < 4; j742 = j742 + 1) {
 				fRec598_tmp[j742] = fRec598_perm[j742];
@@ -7668,7 +6323,7 @@ class mydsp : public dsp {
 			for (int j743 = 0; j743 < 4; j743 = j743 + 1) {
 				fRec598_perm[j743] = fRec598_tmp[vsize + j743];
 			}
-			/* Recursive loop 171 */
+			/* Recursive loop 127 */
 			/* Pre code */
 			for (int j0 = 0; j0 < 4; j0 = j0 + 1) {
 				fRec0_tmp[j0] = fRec0_perm[j0];
@@ -7681,7 +6336,7 @@ class mydsp : public dsp {
 			for (int j1 = 0; j1 < 4; j1 = j1 + 1) {
 				fRec0_perm[j1] = fRec0_tmp[vsize + j1];
 			}
-			/* Recursive loop 172 */
+			/* Recursive loop 128 */
 			/* Pre code */
 			for (int j4 = 0; j4 < 4; j4 = j4 + 1) {
 				fRec8_tmp[j4] = fRec8_perm[j4];
@@ -7694,14 +6349,14 @@ class mydsp : public dsp {
 			for (int j5 = 0; j5 < 4; j5 = j5 + 1) {
 				fRec8_perm[j5] = fRec8_tmp[vsize + j5];
 			}
-			/* Vectorizable loop 173 */
+			/* Vectorizable loop 129 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				float fThen66 = fZec60[i];
-				float fThen67 = std::exp(0.0f - fConst102 / ((iZec61[i]) ? 1.0f : fThen66));
-				fZec62[i] = ((iZec61[i]) ? 0.0f : fThen67);
+				float fThen66 = 1.0f - std::exp(0.0f - fZec60[i]);
+				float fElse67 = fZec60[i] * (1.0f - fZec60[i] * (0.5f - 0.166666672f * fZec60[i]));
+				fZec62[i] = ((iZec61[i]) ? fElse67 : fThen66);
 			}
-			/* Recursive loop 174 */
+			/* Recursive loop 130 */
 			/* Pre code */
 			for (int j212 = 0; j212 < 4; j212 = j212 + 1) {
 				fRec79_tmp[j212] = fRec79_perm[j212];
@@ -7714,7 +6369,7 @@ class mydsp : public dsp {
 			for (int j213 = 0; j213 < 4; j213 = j213 + 1) {
 				fRec79_perm[j213] = fRec79_tmp[vsize + j213];
 			}
-			/* Recursive loop 175 */
+			/* Recursive loop 131 */
 			/* Pre code */
 			for (int j216 = 0; j216 < 4; j216 = j216 + 1) {
 				fRec81_tmp[j216] = fRec81_perm[j216];
@@ -7727,17 +6382,17 @@ class mydsp : public dsp {
 			for (int j217 = 0; j217 < 4; j217 = j217 + 1) {
 				fRec81_perm[j217] = fRec81_tmp[vsize + j217];
 			}
-			/* Vectorizable loop 176 */
+			/* Vectorizable loop 132 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec70[i] = 1.0f - fRec80[i];
 			}
-			/* Vectorizable loop 177 */
+			/* Vectorizable loop 133 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec784[i] = 1.0f - fRec598[i];
 			}
-			/* Recursive loop 178 */
+			/* Recursive loop 134 */
 			/* Pre code */
 			for (int j744 = 0; j744 < 4; j744 = j744 + 1) {
 				fRec599_tmp[j744] = fRec599_perm[j744];
@@ -7750,12 +6405,12 @@ class mydsp : public dsp {
 			for (int j745 = 0; j745 < 4; j745 = j745 + 1) {
 				fRec599_perm[j745] = fRec599_tmp[vsize + j745];
 			}
-			/* Vectorizable loop 179 */
+			/* Vectorizable loop 135 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fZec766[i] = fRec86[i] * (1.0f - fRec7[i]);
 			}
-			/* Recursive loop 180 */
+			/* Recursive loop 136 */
 			/* Pre code */
 			for (int j740 = 0; j740 < 4; j740 = j740 + 1) {
 				fRec597_tmp[j740] = fRec597_perm[j740];
@@ -7768,7 +6423,7 @@ class mydsp : public dsp {
 			for (int j741 = 0; j741 < 4; j741 = j741 + 1) {
 				fRec597_perm[j741] = fRec597_tmp[vsize + j741];
 			}
-			/* Recursive loop 181 */
+			/* Recursive loop 137 */
 			/* Pre code */
 			for (int j168 = 0; j168 < 4; j168 = j168 + 1) {
 				fYec68_tmp[j168] = fYec68_perm[j168];
@@ -7859,6 +6514,9 @@ class mydsp : public dsp {
 			for (int j208 = 0; j208 < 4; j208 = j208 + 1) {
 				fRec10_tmp[j208] = fRec10_perm[j208];
 			}
+			for (int j806 = 0; j806 < 4; j806 = j806 + 1) {
+				fRec621_tmp[j806] = fRec621_perm[j806];
+			}
 			for (int j210 = 0; j210 < 4; j210 = j210 + 1) {
 				fRec9_tmp[j210] = fRec9_perm[j210];
 			}
@@ -8470,8 +7128,8 @@ class mydsp : public dsp {
 			for (int j622 = 0; j622 < 4; j622 = j622 + 1) {
 				fRec519_tmp[j622] = fRec519_perm[j622];
 			}
-			for (int j624 = 0; j624 < 4; j624 = j624 + 1) {
-				fRec513_tmp[j624] = fRec513_perm[j624];
+			for (int j806 = 0; j806 < 4; j806 = j806 + 1) {
+				fRec513_tmp[j806] = fRec513_perm[j806];
 			}
 			for (int j626 = 0; j626 < 4; j626 = j626 + 1) {
 				fRec514_tmp[j626] = fRec514_perm[j626];
@@ -8746,8 +7404,11 @@ class mydsp : public dsp {
 				float fElse99 = fYec91[i - iConst228];
 				float fElse100 = fYec89[i];
 				float fElse101 = fYec90[i - iConst229];
-				fRec10[i] = (1.0f - fZec62[i]) * std::max<float>(fSlow41, std::min<float>(fSlow42, fSlow43 + fRec9[i - 1] + 0.690999985f - 4.34294462f * std::log(std::max<float>(9.99999996e-13f, fConst168 * (((iConst169) ? fElse68 : 0.0f) + ((iConst201) ? fElse69 : 0.0f) + ((iConst203) ? fElse70 : 0.0f) + ((iConst205) ? fElse71 : 0.0f) + ((iConst207) ? fElse72 : 0.0f) + ((iConst209) ? fElse73 : 0.0f) + ((iConst211) ? fElse74 : 0.0f) + ((iConst213) ? fElse75 : 0.0f) + ((iConst215) ? fElse76 : 0.0f) + ((iConst217) ? fElse77 : 0.0f) + ((iConst219) ? fElse78 : 0.0f) + ((iConst221) ? fElse79 : 0.0f) + ((iConst223) ? fElse80 : 0.0f) + ((iConst225) ? fElse81 : 0.0f) + ((iConst227) ? fElse82 : 0.0f) + ((iConst229) ? fElse83 : 0.0f) + ((iConst230) ? fElse84 : 0.0f) + ((iConst169) ? fElse85 : 0.0f) + ((iConst201) ? fElse86 : 0.0f) + ((iConst203) ? fElse87 : 0.0f) + ((iConst205) ? fElse88 : 0.0f) + ((iConst207) ? fElse89 : 0.0f) + ((iConst209) ? fElse90 : 0.0f) + ((iConst211) ? fElse91 : 0.0f) + ((iConst213) ? fElse92 : 0.0f) + ((iConst215) ? fElse93 : 0.0f) + ((iConst217) ? fElse94 : 0.0f) + ((iConst219) ? fElse95 : 0.0f) + ((iConst221) ? fElse96 : 0.0f) + ((iConst223) ? fElse97 : 0.0f) + ((iConst225) ? fElse98 : 0.0f) + ((iConst227) ? fElse99 : 0.0f) + ((iConst229) ? fElse100 : 0.0f) + ((iConst230) ? fElse101 : 0.0f)))))) + fZec62[i] * fRec10[i - 1];
-				fVbargraph5 = FAUSTFLOAT(fRec10[i]);
+				float fTemp0 = fRec621[i - 1] + fZec62[i] * (std::max<float>(fSlow41, std::min<float>(fSlow42, fSlow43 + fRec9[i - 1] + 0.690999985f - 4.34294462f * std::log(std::max<float>(9.99999996e-13f, fConst168 * (((iConst169) ? fElse68 : 0.0f) + ((iConst201) ? fElse69 : 0.0f) + ((iConst203) ? fElse70 : 0.0f) + ((iConst205) ? fElse71 : 0.0f) + ((iConst207) ? fElse72 : 0.0f) + ((iConst209) ? fElse73 : 0.0f) + ((iConst211) ? fElse74 : 0.0f) + ((iConst213) ? fElse75 : 0.0f) + ((iConst215) ? fElse76 : 0.0f) + ((iConst217) ? fElse77 : 0.0f) + ((iConst219) ? fElse78 : 0.0f) + ((iConst221) ? fElse79 : 0.0f) + ((iConst223) ? fElse80 : 0.0f) + ((iConst225) ? fElse81 : 0.0f) + ((iConst227) ? fElse82 : 0.0f) + ((iConst229) ? fElse83 : 0.0f) + ((iConst230) ? fElse84 : 0.0f) + ((iConst169) ? fElse85 : 0.0f) + ((iConst201) ? fElse86 : 0.0f) + ((iConst203) ? fElse87 : 0.0f) + ((iConst205) ? fElse88 : 0.0f) + ((iConst207) ? fElse89 : 0.0f) + ((iConst209) ? fElse90 : 0.0f) + ((iConst211) ? fElse91 : 0.0f) + ((iConst213) ? fElse92 : 0.0f) + ((iConst215) ? fElse93 : 0.0f) + ((iConst217) ? fElse94 : 0.0f) + ((iConst219) ? fElse95 : 0.0f) + ((iConst221) ? fElse96 : 0.0f) + ((iConst223) ? fElse97 : 0.0f) + ((iConst225) ? fElse98 : 0.0f) + ((iConst227) ? fElse99 : 0.0f) + ((iConst229) ? fElse100 : 0.0f) + ((iConst230) ? fElse101 : 0.0f)))))) - (fRec10[i - 1] + fRec621[i - 1]));
+				float fTemp1 = 0.0009765625f * std::floor(1024.0f * fTemp0);
+				fRec10[i] = fRec10[i - 1] + fTemp1;
+				fRec621[i] = fTemp0 - fTemp1;
+				fVbargraph5 = FAUSTFLOAT(fRec10[i] + fRec621[i]);
 				fRec9[i] = fVbargraph5;
 				fZec63[i] = fRec8[i] + (1.0f - fRec8[i]) * std::pow(10.0f, 0.0500000007f * fRec9[i]);
 				fZec64[i] = fSlow47 * fRec3[i - 1] + fSlow48 * fZec53[i] * fZec63[i];
@@ -8789,7 +7450,10 @@ class mydsp : public dsp {
 				fRec90[i] = fZec88[i] - fSlow70 * (fSlow71 * fRec90[i - 2] + fSlow74 * fRec90[i - 1]);
 				fRec89[i] = fSlow70 * (fSlow73 * fRec90[i] + fSlow75 * fRec90[i - 1] + fSlow73 * fRec90[i - 2]) - fSlow76 * (fSlow77 * fRec89[i - 2] + fSlow74 * fRec89[i - 1]);
 				fRec88[i] = fSlow76 * (fSlow73 * fRec89[i] + fSlow75 * fRec89[i - 1] + fSlow73 * fRec89[i - 2]) - fSlow78 * (fSlow79 * fRec88[i - 2] + fSlow74 * fRec88[i - 1]);
-				fZec89[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow78 * (fSlow73 * fRec88[i] + fSlow75 * fRec88[i - 1] + fSlow73 * fRec88[i - 2]))));
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][7] = std::fabs(fSlow78 * (fSlow73 * fRec88[i] + fSlow75 * fRec88[i - 1] + fSlow73 * fRec88[i - 2]));
+#else
+				fZec89[i] = mscomp_linear2db(std::fabs(fSlow78 * (fSlow73 * fRec88[i] + fSlow75 * fRec88[i - 1] + fSlow73 * fRec88[i - 2])));
 				iZec90[i] = (fZec89[i] > fSlow87) + (fZec89[i] > fSlow88);
 				fZec91[i] = fZec89[i] - fSlow84;
 				float fThen110 = fZec91[i];
@@ -8798,11 +7462,15 @@ class mydsp : public dsp {
 				fZec92[i] = 0.0f - fSlow82 * std::max<float>(0.0f, ((iZec90[i] == 0) ? 0.0f : fThen111));
 				fZec93[i] = ((fZec92[i] > fRec87[i - 1]) ? fSlow99 : fSlow94);
 				fRec87[i] = fZec92[i] * (1.0f - fZec93[i]) + fRec87[i - 1] * fZec93[i];
+#endif
 				fZec94[i] = 0.5f * fZec63[i] * (fZec86[i] - fZec87[i]);
 				fRec94[i] = fZec94[i] - fSlow70 * (fSlow71 * fRec94[i - 2] + fSlow74 * fRec94[i - 1]);
 				fRec93[i] = fSlow70 * (fSlow73 * fRec94[i] + fSlow75 * fRec94[i - 1] + fSlow73 * fRec94[i - 2]) - fSlow76 * (fSlow77 * fRec93[i - 2] + fSlow74 * fRec93[i - 1]);
 				fRec92[i] = fSlow76 * (fSlow73 * fRec93[i] + fSlow75 * fRec93[i - 1] + fSlow73 * fRec93[i - 2]) - fSlow78 * (fSlow79 * fRec92[i - 2] + fSlow74 * fRec92[i - 1]);
-				fZec95[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow78 * (fSlow73 * fRec92[i] + fSlow75 * fRec92[i - 1] + fSlow73 * fRec92[i - 2]))));
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][15] = std::fabs(fSlow78 * (fSlow73 * fRec92[i] + fSlow75 * fRec92[i - 1] + fSlow73 * fRec92[i - 2]));
+#else
+				fZec95[i] = mscomp_linear2db(std::fabs(fSlow78 * (fSlow73 * fRec92[i] + fSlow75 * fRec92[i - 1] + fSlow73 * fRec92[i - 2])));
 				iZec96[i] = (fZec95[i] > fSlow87) + (fZec95[i] > fSlow88);
 				fZec97[i] = fZec95[i] - fSlow84;
 				float fThen117 = fZec97[i];
@@ -8811,6 +7479,7 @@ class mydsp : public dsp {
 				fZec98[i] = 0.0f - fSlow82 * std::max<float>(0.0f, ((iZec96[i] == 0) ? 0.0f : fThen118));
 				fZec99[i] = ((fZec98[i] > fRec91[i - 1]) ? fSlow99 : fSlow94);
 				fRec91[i] = fZec98[i] * (1.0f - fZec99[i]) + fRec91[i - 1] * fZec99[i];
+#endif
 				fRec325[i] = fSlow70 * (fRec90[i - 2] + fRec90[i] + 2.0f * fRec90[i - 1]) - fSlow76 * (fSlow77 * fRec325[i - 2] + fSlow74 * fRec325[i - 1]);
 				fRec324[i] = fSlow76 * (fRec325[i - 2] + fRec325[i] + 2.0f * fRec325[i - 1]) - fSlow78 * (fSlow79 * fRec324[i - 2] + fSlow74 * fRec324[i - 1]);
 				fRec323[i] = fSlow78 * (fRec324[i - 2] + fRec324[i] + 2.0f * fRec324[i - 1]) - fSlow102 * (fSlow103 * fRec323[i - 2] + fSlow106 * fRec323[i - 1]);
@@ -8831,7 +7500,10 @@ class mydsp : public dsp {
 				fRec308[i] = fSlow153 * (fRec309[i - 2] + fRec309[i] + 2.0f * fRec309[i - 1]) - fSlow157 * (fSlow158 * fRec308[i - 2] + fSlow161 * fRec308[i - 1]);
 				fRec307[i] = fSlow157 * (fRec308[i - 2] + fRec308[i] + 2.0f * fRec308[i - 1]) - fSlow162 * (fSlow163 * fRec307[i - 2] + fSlow161 * fRec307[i - 1]);
 				fRec306[i] = fSlow162 * (fRec307[i - 2] + fRec307[i] + 2.0f * fRec307[i - 1]) - fSlow164 * (fSlow165 * fRec306[i - 2] + fSlow161 * fRec306[i - 1]);
-				fZec100[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow164 * (fRec306[i - 2] + fRec306[i] + 2.0f * fRec306[i - 1]))));
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][0] = std::fabs(fSlow164 * (fRec306[i - 2] + fRec306[i] + 2.0f * fRec306[i - 1]));
+#else
+				fZec100[i] = mscomp_linear2db(std::fabs(fSlow164 * (fRec306[i - 2] + fRec306[i] + 2.0f * fRec306[i - 1])));
 				iZec101[i] = (fZec100[i] > fSlow171) + (fZec100[i] > fSlow172);
 				fZec102[i] = fZec100[i] - fSlow168;
 				float fThen120 = fZec102[i];
@@ -8840,6 +7512,7 @@ class mydsp : public dsp {
 				fZec103[i] = 0.0f - fSlow166 * std::max<float>(0.0f, ((iZec101[i] == 0) ? 0.0f : fThen121));
 				fZec104[i] = ((fZec103[i] > fRec305[i - 1]) ? fSlow177 : fSlow175);
 				fRec305[i] = fZec103[i] * (1.0f - fZec104[i]) + fRec305[i - 1] * fZec104[i];
+#endif
 				fRec346[i] = fSlow70 * (fRec94[i - 2] + fRec94[i] + 2.0f * fRec94[i - 1]) - fSlow76 * (fSlow77 * fRec346[i - 2] + fSlow74 * fRec346[i - 1]);
 				fRec345[i] = fSlow76 * (fRec346[i - 2] + fRec346[i] + 2.0f * fRec346[i - 1]) - fSlow78 * (fSlow79 * fRec345[i - 2] + fSlow74 * fRec345[i - 1]);
 				fRec344[i] = fSlow78 * (fRec345[i - 2] + fRec345[i] + 2.0f * fRec345[i - 1]) - fSlow102 * (fSlow103 * fRec344[i - 2] + fSlow106 * fRec344[i - 1]);
@@ -8860,7 +7533,10 @@ class mydsp : public dsp {
 				fRec329[i] = fSlow153 * (fRec330[i - 2] + fRec330[i] + 2.0f * fRec330[i - 1]) - fSlow157 * (fSlow158 * fRec329[i - 2] + fSlow161 * fRec329[i - 1]);
 				fRec328[i] = fSlow157 * (fRec329[i - 2] + fRec329[i] + 2.0f * fRec329[i - 1]) - fSlow162 * (fSlow163 * fRec328[i - 2] + fSlow161 * fRec328[i - 1]);
 				fRec327[i] = fSlow162 * (fRec328[i - 2] + fRec328[i] + 2.0f * fRec328[i - 1]) - fSlow164 * (fSlow165 * fRec327[i - 2] + fSlow161 * fRec327[i - 1]);
-				fZec105[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow164 * (fRec327[i - 2] + fRec327[i] + 2.0f * fRec327[i - 1]))));
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][8] = std::fabs(fSlow164 * (fRec327[i - 2] + fRec327[i] + 2.0f * fRec327[i - 1]));
+#else
+				fZec105[i] = mscomp_linear2db(std::fabs(fSlow164 * (fRec327[i - 2] + fRec327[i] + 2.0f * fRec327[i - 1])));
 				iZec106[i] = (fZec105[i] > fSlow171) + (fZec105[i] > fSlow172);
 				fZec107[i] = fZec105[i] - fSlow168;
 				float fThen127 = fZec107[i];
@@ -8869,8 +7545,199 @@ class mydsp : public dsp {
 				fZec108[i] = 0.0f - fSlow166 * std::max<float>(0.0f, ((iZec106[i] == 0) ? 0.0f : fThen128));
 				fZec109[i] = ((fZec108[i] > fRec326[i - 1]) ? fSlow177 : fSlow175);
 				fRec326[i] = fZec108[i] * (1.0f - fZec109[i]) + fRec326[i - 1] * fZec109[i];
+#endif
+				fRec302[i] = fZec88[i];
+				fRec349[i] = fSlow157 * (fSlow160 * fRec308[i] + fSlow180 * fRec308[i - 1] + fSlow160 * fRec308[i - 2]) - fSlow162 * (fSlow163 * fRec349[i - 2] + fSlow161 * fRec349[i - 1]);
+				fRec348[i] = fSlow162 * (fSlow160 * fRec349[i] + fSlow180 * fRec349[i - 1] + fSlow160 * fRec349[i - 2]) - fSlow164 * (fSlow165 * fRec348[i - 2] + fSlow161 * fRec348[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][1] = std::fabs(fSlow164 * (fSlow160 * fRec348[i] + fSlow180 * fRec348[i - 1] + fSlow160 * fRec348[i - 2]));
+#else
+				fZec131[i] = mscomp_linear2db(std::fabs(fSlow164 * (fSlow160 * fRec348[i] + fSlow180 * fRec348[i - 1] + fSlow160 * fRec348[i - 2])));
+				iZec132[i] = (fZec131[i] > fSlow188) + (fZec131[i] > fSlow189);
+				fZec133[i] = fZec131[i] - fSlow184;
+				float fThen130 = fZec133[i];
+				float fElse130 = fSlow190 * mydsp_faustpower2_f(fSlow187 + fZec133[i]);
+				float fThen131 = ((iZec132[i] == 1) ? fElse130 : fThen130);
+				fZec134[i] = 0.0f - fSlow181 * std::max<float>(0.0f, ((iZec132[i] == 0) ? 0.0f : fThen131));
+				fZec135[i] = ((fZec134[i] > fRec347[i - 1]) ? fSlow196 : fSlow193);
+				fRec347[i] = fZec134[i] * (1.0f - fZec135[i]) + fRec347[i - 1] * fZec135[i];
+#endif
+				fRec352[i] = fSlow157 * (fSlow160 * fRec329[i] + fSlow180 * fRec329[i - 1] + fSlow160 * fRec329[i - 2]) - fSlow162 * (fSlow163 * fRec352[i - 2] + fSlow161 * fRec352[i - 1]);
+				fRec351[i] = fSlow162 * (fSlow160 * fRec352[i] + fSlow180 * fRec352[i - 1] + fSlow160 * fRec352[i - 2]) - fSlow164 * (fSlow165 * fRec351[i - 2] + fSlow161 * fRec351[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][9] = std::fabs(fSlow164 * (fSlow160 * fRec351[i] + fSlow180 * fRec351[i - 1] + fSlow160 * fRec351[i - 2]));
+#else
+				fZec136[i] = mscomp_linear2db(std::fabs(fSlow164 * (fSlow160 * fRec351[i] + fSlow180 * fRec351[i - 1] + fSlow160 * fRec351[i - 2])));
+				iZec137[i] = (fZec136[i] > fSlow188) + (fZec136[i] > fSlow189);
+				fZec138[i] = fZec136[i] - fSlow184;
+				float fThen137 = fZec138[i];
+				float fElse137 = fSlow190 * mydsp_faustpower2_f(fSlow187 + fZec138[i]);
+				float fThen138 = ((iZec137[i] == 1) ? fElse137 : fThen137);
+				fZec139[i] = 0.0f - fSlow181 * std::max<float>(0.0f, ((iZec137[i] == 0) ? 0.0f : fThen138));
+				fZec140[i] = ((fZec139[i] > fRec350[i - 1]) ? fSlow196 : fSlow193);
+				fRec350[i] = fZec139[i] * (1.0f - fZec140[i]) + fRec350[i - 1] * fZec140[i];
+#endif
+				fRec355[i] = fSlow146 * (fSlow149 * fRec311[i] + fSlow199 * fRec311[i - 1] + fSlow149 * fRec311[i - 2]) - fSlow151 * (fSlow152 * fRec355[i - 2] + fSlow150 * fRec355[i - 1]);
+				fRec354[i] = fSlow151 * (fSlow149 * fRec355[i] + fSlow199 * fRec355[i - 1] + fSlow149 * fRec355[i - 2]) - fSlow153 * (fSlow154 * fRec354[i - 2] + fSlow150 * fRec354[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][2] = std::fabs(fSlow153 * (fSlow149 * fRec354[i] + fSlow199 * fRec354[i - 1] + fSlow149 * fRec354[i - 2]));
+#else
+				fZec184[i] = mscomp_linear2db(std::fabs(fSlow153 * (fSlow149 * fRec354[i] + fSlow199 * fRec354[i - 1] + fSlow149 * fRec354[i - 2])));
+				iZec185[i] = (fZec184[i] > fSlow205) + (fZec184[i] > fSlow206);
+				fZec186[i] = fZec184[i] - fSlow202;
+				float fThen140 = fZec186[i];
+				float fElse140 = fSlow207 * mydsp_faustpower2_f(fSlow204 + fZec186[i]);
+				float fThen141 = ((iZec185[i] == 1) ? fElse140 : fThen140);
+				fZec187[i] = 0.0f - fSlow200 * std::max<float>(0.0f, ((iZec185[i] == 0) ? 0.0f : fThen141));
+				fZec188[i] = ((fZec187[i] > fRec353[i - 1]) ? fSlow213 : fSlow210);
+				fRec353[i] = fZec187[i] * (1.0f - fZec188[i]) + fRec353[i - 1] * fZec188[i];
+#endif
+				fRec358[i] = fSlow146 * (fSlow149 * fRec332[i] + fSlow199 * fRec332[i - 1] + fSlow149 * fRec332[i - 2]) - fSlow151 * (fSlow152 * fRec358[i - 2] + fSlow150 * fRec358[i - 1]);
+				fRec357[i] = fSlow151 * (fSlow149 * fRec358[i] + fSlow199 * fRec358[i - 1] + fSlow149 * fRec358[i - 2]) - fSlow153 * (fSlow154 * fRec357[i - 2] + fSlow150 * fRec357[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][10] = std::fabs(fSlow153 * (fSlow149 * fRec357[i] + fSlow199 * fRec357[i - 1] + fSlow149 * fRec357[i - 2]));
+#else
+				fZec189[i] = mscomp_linear2db(std::fabs(fSlow153 * (fSlow149 * fRec357[i] + fSlow199 * fRec357[i - 1] + fSlow149 * fRec357[i - 2])));
+				iZec190[i] = (fZec189[i] > fSlow205) + (fZec189[i] > fSlow206);
+				fZec191[i] = fZec189[i] - fSlow202;
+				float fThen147 = fZec191[i];
+				float fElse147 = fSlow207 * mydsp_faustpower2_f(fSlow204 + fZec191[i]);
+				float fThen148 = ((iZec190[i] == 1) ? fElse147 : fThen147);
+				fZec192[i] = 0.0f - fSlow200 * std::max<float>(0.0f, ((iZec190[i] == 0) ? 0.0f : fThen148));
+				fZec193[i] = ((fZec192[i] > fRec356[i - 1]) ? fSlow213 : fSlow210);
+				fRec356[i] = fZec192[i] * (1.0f - fZec193[i]) + fRec356[i - 1] * fZec193[i];
+#endif
+				fRec361[i] = fSlow135 * (fSlow138 * fRec314[i] + fSlow215 * fRec314[i - 1] + fSlow138 * fRec314[i - 2]) - fSlow140 * (fSlow141 * fRec361[i - 2] + fSlow139 * fRec361[i - 1]);
+				fRec360[i] = fSlow140 * (fSlow138 * fRec361[i] + fSlow215 * fRec361[i - 1] + fSlow138 * fRec361[i - 2]) - fSlow142 * (fSlow143 * fRec360[i - 2] + fSlow139 * fRec360[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][3] = std::fabs(fSlow142 * (fSlow138 * fRec360[i] + fSlow215 * fRec360[i - 1] + fSlow138 * fRec360[i - 2]));
+#else
+				fZec237[i] = mscomp_linear2db(std::fabs(fSlow142 * (fSlow138 * fRec360[i] + fSlow215 * fRec360[i - 1] + fSlow138 * fRec360[i - 2])));
+				iZec238[i] = (fZec237[i] > fSlow221) + (fZec237[i] > fSlow222);
+				fZec239[i] = fZec237[i] - fSlow218;
+				float fThen150 = fZec239[i];
+				float fElse150 = fSlow223 * mydsp_faustpower2_f(fSlow220 + fZec239[i]);
+				float fThen151 = ((iZec238[i] == 1) ? fElse150 : fThen150);
+				fZec240[i] = 0.0f - fSlow216 * std::max<float>(0.0f, ((iZec238[i] == 0) ? 0.0f : fThen151));
+				fZec241[i] = ((fZec240[i] > fRec359[i - 1]) ? fSlow229 : fSlow226);
+				fRec359[i] = fZec240[i] * (1.0f - fZec241[i]) + fRec359[i - 1] * fZec241[i];
+#endif
+				fRec364[i] = fSlow135 * (fSlow138 * fRec335[i] + fSlow215 * fRec335[i - 1] + fSlow138 * fRec335[i - 2]) - fSlow140 * (fSlow141 * fRec364[i - 2] + fSlow139 * fRec364[i - 1]);
+				fRec363[i] = fSlow140 * (fSlow138 * fRec364[i] + fSlow215 * fRec364[i - 1] + fSlow138 * fRec364[i - 2]) - fSlow142 * (fSlow143 * fRec363[i - 2] + fSlow139 * fRec363[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][11] = std::fabs(fSlow142 * (fSlow138 * fRec363[i] + fSlow215 * fRec363[i - 1] + fSlow138 * fRec363[i - 2]));
+#else
+				fZec242[i] = mscomp_linear2db(std::fabs(fSlow142 * (fSlow138 * fRec363[i] + fSlow215 * fRec363[i - 1] + fSlow138 * fRec363[i - 2])));
+				iZec243[i] = (fZec242[i] > fSlow221) + (fZec242[i] > fSlow222);
+				fZec244[i] = fZec242[i] - fSlow218;
+				float fThen157 = fZec244[i];
+				float fElse157 = fSlow223 * mydsp_faustpower2_f(fSlow220 + fZec244[i]);
+				float fThen158 = ((iZec243[i] == 1) ? fElse157 : fThen157);
+				fZec245[i] = 0.0f - fSlow216 * std::max<float>(0.0f, ((iZec243[i] == 0) ? 0.0f : fThen158));
+				fZec246[i] = ((fZec245[i] > fRec362[i - 1]) ? fSlow229 : fSlow226);
+				fRec362[i] = fZec245[i] * (1.0f - fZec246[i]) + fRec362[i - 1] * fZec246[i];
+#endif
+				fRec367[i] = fSlow124 * (fSlow127 * fRec317[i] + fSlow231 * fRec317[i - 1] + fSlow127 * fRec317[i - 2]) - fSlow129 * (fSlow130 * fRec367[i - 2] + fSlow128 * fRec367[i - 1]);
+				fRec366[i] = fSlow129 * (fSlow127 * fRec367[i] + fSlow231 * fRec367[i - 1] + fSlow127 * fRec367[i - 2]) - fSlow131 * (fSlow132 * fRec366[i - 2] + fSlow128 * fRec366[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][4] = std::fabs(fSlow131 * (fSlow127 * fRec366[i] + fSlow231 * fRec366[i - 1] + fSlow127 * fRec366[i - 2]));
+#else
+				fZec290[i] = mscomp_linear2db(std::fabs(fSlow131 * (fSlow127 * fRec366[i] + fSlow231 * fRec366[i - 1] + fSlow127 * fRec366[i - 2])));
+				iZec291[i] = (fZec290[i] > fSlow237) + (fZec290[i] > fSlow238);
+				fZec292[i] = fZec290[i] - fSlow234;
+				float fThen160 = fZec292[i];
+				float fElse160 = fSlow239 * mydsp_faustpower2_f(fSlow236 + fZec292[i]);
+				float fThen161 = ((iZec291[i] == 1) ? fElse160 : fThen160);
+				fZec293[i] = 0.0f - fSlow232 * std::max<float>(0.0f, ((iZec291[i] == 0) ? 0.0f : fThen161));
+				fZec294[i] = ((fZec293[i] > fRec365[i - 1]) ? fSlow245 : fSlow242);
+				fRec365[i] = fZec293[i] * (1.0f - fZec294[i]) + fRec365[i - 1] * fZec294[i];
+#endif
+				fRec370[i] = fSlow124 * (fSlow127 * fRec338[i] + fSlow231 * fRec338[i - 1] + fSlow127 * fRec338[i - 2]) - fSlow129 * (fSlow130 * fRec370[i - 2] + fSlow128 * fRec370[i - 1]);
+				fRec369[i] = fSlow129 * (fSlow127 * fRec370[i] + fSlow231 * fRec370[i - 1] + fSlow127 * fRec370[i - 2]) - fSlow131 * (fSlow132 * fRec369[i - 2] + fSlow128 * fRec369[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][12] = std::fabs(fSlow131 * (fSlow127 * fRec369[i] + fSlow231 * fRec369[i - 1] + fSlow127 * fRec369[i - 2]));
+#else
+				fZec295[i] = mscomp_linear2db(std::fabs(fSlow131 * (fSlow127 * fRec369[i] + fSlow231 * fRec369[i - 1] + fSlow127 * fRec369[i - 2])));
+				iZec296[i] = (fZec295[i] > fSlow237) + (fZec295[i] > fSlow238);
+				fZec297[i] = fZec295[i] - fSlow234;
+				float fThen167 = fZec297[i];
+				float fElse167 = fSlow239 * mydsp_faustpower2_f(fSlow236 + fZec297[i]);
+				float fThen168 = ((iZec296[i] == 1) ? fElse167 : fThen167);
+				fZec298[i] = 0.0f - fSlow232 * std::max<float>(0.0f, ((iZec296[i] == 0) ? 0.0f : fThen168));
+				fZec299[i] = ((fZec298[i] > fRec368[i - 1]) ? fSlow245 : fSlow242);
+				fRec368[i] = fZec298[i] * (1.0f - fZec299[i]) + fRec368[i - 1] * fZec299[i];
+#endif
+				fRec373[i] = fSlow113 * (fSlow116 * fRec320[i] + fSlow247 * fRec320[i - 1] + fSlow116 * fRec320[i - 2]) - fSlow118 * (fSlow119 * fRec373[i - 2] + fSlow117 * fRec373[i - 1]);
+				fRec372[i] = fSlow118 * (fSlow116 * fRec373[i] + fSlow247 * fRec373[i - 1] + fSlow116 * fRec373[i - 2]) - fSlow120 * (fSlow121 * fRec372[i - 2] + fSlow117 * fRec372[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][5] = std::fabs(fSlow120 * (fSlow116 * fRec372[i] + fSlow247 * fRec372[i - 1] + fSlow116 * fRec372[i - 2]));
+#else
+				fZec343[i] = mscomp_linear2db(std::fabs(fSlow120 * (fSlow116 * fRec372[i] + fSlow247 * fRec372[i - 1] + fSlow116 * fRec372[i - 2])));
+				iZec344[i] = (fZec343[i] > fSlow253) + (fZec343[i] > fSlow254);
+				fZec345[i] = fZec343[i] - fSlow250;
+				float fThen170 = fZec345[i];
+				float fElse170 = fSlow255 * mydsp_faustpower2_f(fSlow252 + fZec345[i]);
+				float fThen171 = ((iZec344[i] == 1) ? fElse170 : fThen170);
+				fZec346[i] = 0.0f - fSlow248 * std::max<float>(0.0f, ((iZec344[i] == 0) ? 0.0f : fThen171));
+				fZec347[i] = ((fZec346[i] > fRec371[i - 1]) ? fSlow261 : fSlow258);
+				fRec371[i] = fZec346[i] * (1.0f - fZec347[i]) + fRec371[i - 1] * fZec347[i];
+#endif
+				fRec376[i] = fSlow113 * (fSlow116 * fRec341[i] + fSlow247 * fRec341[i - 1] + fSlow116 * fRec341[i - 2]) - fSlow118 * (fSlow119 * fRec376[i - 2] + fSlow117 * fRec376[i - 1]);
+				fRec375[i] = fSlow118 * (fSlow116 * fRec376[i] + fSlow247 * fRec376[i - 1] + fSlow116 * fRec376[i - 2]) - fSlow120 * (fSlow121 * fRec375[i - 2] + fSlow117 * fRec375[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][13] = std::fabs(fSlow120 * (fSlow116 * fRec375[i] + fSlow247 * fRec375[i - 1] + fSlow116 * fRec375[i - 2]));
+#else
+				fZec348[i] = mscomp_linear2db(std::fabs(fSlow120 * (fSlow116 * fRec375[i] + fSlow247 * fRec375[i - 1] + fSlow116 * fRec375[i - 2])));
+				iZec349[i] = (fZec348[i] > fSlow253) + (fZec348[i] > fSlow254);
+				fZec350[i] = fZec348[i] - fSlow250;
+				float fThen177 = fZec350[i];
+				float fElse177 = fSlow255 * mydsp_faustpower2_f(fSlow252 + fZec350[i]);
+				float fThen178 = ((iZec349[i] == 1) ? fElse177 : fThen177);
+				fZec351[i] = 0.0f - fSlow248 * std::max<float>(0.0f, ((iZec349[i] == 0) ? 0.0f : fThen178));
+				fZec352[i] = ((fZec351[i] > fRec374[i - 1]) ? fSlow261 : fSlow258);
+				fRec374[i] = fZec351[i] * (1.0f - fZec352[i]) + fRec374[i - 1] * fZec352[i];
+#endif
+				fRec379[i] = fSlow102 * (fSlow105 * fRec323[i] + fSlow263 * fRec323[i - 1] + fSlow105 * fRec323[i - 2]) - fSlow107 * (fSlow108 * fRec379[i - 2] + fSlow106 * fRec379[i - 1]);
+				fRec378[i] = fSlow107 * (fSlow105 * fRec379[i] + fSlow263 * fRec379[i - 1] + fSlow105 * fRec379[i - 2]) - fSlow109 * (fSlow110 * fRec378[i - 2] + fSlow106 * fRec378[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][6] = std::fabs(fSlow109 * (fSlow105 * fRec378[i] + fSlow263 * fRec378[i - 1] + fSlow105 * fRec378[i - 2]));
+#else
+				fZec396[i] = mscomp_linear2db(std::fabs(fSlow109 * (fSlow105 * fRec378[i] + fSlow263 * fRec378[i - 1] + fSlow105 * fRec378[i - 2])));
+				iZec397[i] = (fZec396[i] > fSlow269) + (fZec396[i] > fSlow270);
+				fZec398[i] = fZec396[i] - fSlow266;
+				float fThen180 = fZec398[i];
+				float fElse180 = fSlow271 * mydsp_faustpower2_f(fSlow268 + fZec398[i]);
+				float fThen181 = ((iZec397[i] == 1) ? fElse180 : fThen180);
+				fZec399[i] = 0.0f - fSlow264 * std::max<float>(0.0f, ((iZec397[i] == 0) ? 0.0f : fThen181));
+				fZec400[i] = ((fZec399[i] > fRec377[i - 1]) ? fSlow277 : fSlow274);
+				fRec377[i] = fZec399[i] * (1.0f - fZec400[i]) + fRec377[i - 1] * fZec400[i];
+#endif
+				fRec382[i] = fSlow102 * (fSlow105 * fRec344[i] + fSlow263 * fRec344[i - 1] + fSlow105 * fRec344[i - 2]) - fSlow107 * (fSlow108 * fRec382[i - 2] + fSlow106 * fRec382[i - 1]);
+				fRec381[i] = fSlow107 * (fSlow105 * fRec382[i] + fSlow263 * fRec382[i - 1] + fSlow105 * fRec382[i - 2]) - fSlow109 * (fSlow110 * fRec381[i - 2] + fSlow106 * fRec381[i - 1]);
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompLevels[i][14] = std::fabs(fSlow109 * (fSlow105 * fRec381[i] + fSlow263 * fRec381[i - 1] + fSlow105 * fRec381[i - 2]));
+#else
+				fZec401[i] = mscomp_linear2db(std::fabs(fSlow109 * (fSlow105 * fRec381[i] + fSlow263 * fRec381[i - 1] + fSlow105 * fRec381[i - 2])));
+				iZec402[i] = (fZec401[i] > fSlow269) + (fZec401[i] > fSlow270);
+				fZec403[i] = fZec401[i] - fSlow266;
+				float fThen187 = fZec403[i];
+				float fElse187 = fSlow271 * mydsp_faustpower2_f(fSlow268 + fZec403[i]);
+				float fThen188 = ((iZec402[i] == 1) ? fElse187 : fThen187);
+				fZec404[i] = 0.0f - fSlow264 * std::max<float>(0.0f, ((iZec402[i] == 0) ? 0.0f : fThen188));
+				fZec405[i] = ((fZec404[i] > fRec380[i - 1]) ? fSlow277 : fSlow274);
+				fRec380[i] = fZec404[i] * (1.0f - fZec405[i]) + fRec380[i - 1] * fZec405[i];
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fMscompKernel.process(fMscompLevels[i], fMscompGains[i]);
+#endif
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec110[i] = std::min<float>(fRec305[i], fRec326[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec111[i] = fMscompGains[i][0];
+#else
 				fZec111[i] = fRec305[i] + fSlow179 * (fZec110[i] - fRec305[i]);
+#endif
 				fVbargraph8 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec111[i])));
 				fZec112[i] = std::pow(10.0f, 0.00833333377f * fZec111[i]);
 				fZec113[i] = std::sqrt(fZec112[i]);
@@ -8881,7 +7748,6 @@ class mydsp : public dsp {
 				fRec300[i] = 2.0f * fZec117[i] - fRec300[i - 1];
 				fZec118[i] = fRec301[i - 1] + fSlow155 * fZec114[i] / (fZec113[i] * fZec116[i]);
 				fRec301[i] = 2.0f * fZec118[i] - fRec301[i - 1];
-				fRec302[i] = fZec88[i];
 				fRec303[i] = fZec117[i];
 				fRec304[i] = fZec118[i];
 				fZec119[i] = fZec112[i] + -1.0f;
@@ -8906,31 +7772,15 @@ class mydsp : public dsp {
 				fRec292[i] = fZec126[i];
 				fRec293[i] = fZec129[i];
 				fRec294[i] = fZec130[i];
-				fRec349[i] = fSlow157 * (fSlow160 * fRec308[i] + fSlow180 * fRec308[i - 1] + fSlow160 * fRec308[i - 2]) - fSlow162 * (fSlow163 * fRec349[i - 2] + fSlow161 * fRec349[i - 1]);
-				fRec348[i] = fSlow162 * (fSlow160 * fRec349[i] + fSlow180 * fRec349[i - 1] + fSlow160 * fRec349[i - 2]) - fSlow164 * (fSlow165 * fRec348[i - 2] + fSlow161 * fRec348[i - 1]);
-				fZec131[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow164 * (fSlow160 * fRec348[i] + fSlow180 * fRec348[i - 1] + fSlow160 * fRec348[i - 2]))));
-				iZec132[i] = (fZec131[i] > fSlow188) + (fZec131[i] > fSlow189);
-				fZec133[i] = fZec131[i] - fSlow184;
-				float fThen130 = fZec133[i];
-				float fElse130 = fSlow190 * mydsp_faustpower2_f(fSlow187 + fZec133[i]);
-				float fThen131 = ((iZec132[i] == 1) ? fElse130 : fThen130);
-				fZec134[i] = 0.0f - fSlow181 * std::max<float>(0.0f, ((iZec132[i] == 0) ? 0.0f : fThen131));
-				fZec135[i] = ((fZec134[i] > fRec347[i - 1]) ? fSlow196 : fSlow193);
-				fRec347[i] = fZec134[i] * (1.0f - fZec135[i]) + fRec347[i - 1] * fZec135[i];
-				fRec352[i] = fSlow157 * (fSlow160 * fRec329[i] + fSlow180 * fRec329[i - 1] + fSlow160 * fRec329[i - 2]) - fSlow162 * (fSlow163 * fRec352[i - 2] + fSlow161 * fRec352[i - 1]);
-				fRec351[i] = fSlow162 * (fSlow160 * fRec352[i] + fSlow180 * fRec352[i - 1] + fSlow160 * fRec352[i - 2]) - fSlow164 * (fSlow165 * fRec351[i - 2] + fSlow161 * fRec351[i - 1]);
-				fZec136[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow164 * (fSlow160 * fRec351[i] + fSlow180 * fRec351[i - 1] + fSlow160 * fRec351[i - 2]))));
-				iZec137[i] = (fZec136[i] > fSlow188) + (fZec136[i] > fSlow189);
-				fZec138[i] = fZec136[i] - fSlow184;
-				float fThen137 = fZec138[i];
-				float fElse137 = fSlow190 * mydsp_faustpower2_f(fSlow187 + fZec138[i]);
-				float fThen138 = ((iZec137[i] == 1) ? fElse137 : fThen137);
-				fZec139[i] = 0.0f - fSlow181 * std::max<float>(0.0f, ((iZec137[i] == 0) ? 0.0f : fThen138));
-				fZec140[i] = ((fZec139[i] > fRec350[i - 1]) ? fSlow196 : fSlow193);
-				fRec350[i] = fZec139[i] * (1.0f - fZec140[i]) + fRec350[i - 1] * fZec140[i];
 				fZec141[i] = fRec292[i] + 0.5f * fRec293[i] * fZec119[i] + fRec294[i] * fZec120[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec142[i] = std::min<float>(fRec347[i], fRec350[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec143[i] = fMscompGains[i][1];
+#else
 				fZec143[i] = fRec347[i] + fSlow198 * (fZec142[i] - fRec347[i]);
+#endif
 				fVbargraph9 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec143[i])));
 				fZec144[i] = fZec143[i];
 				fZec145[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec144[i]));
@@ -9002,31 +7852,15 @@ class mydsp : public dsp {
 				fRec262[i] = fZec179[i];
 				fRec263[i] = fZec182[i];
 				fRec264[i] = fZec183[i];
-				fRec355[i] = fSlow146 * (fSlow149 * fRec311[i] + fSlow199 * fRec311[i - 1] + fSlow149 * fRec311[i - 2]) - fSlow151 * (fSlow152 * fRec355[i - 2] + fSlow150 * fRec355[i - 1]);
-				fRec354[i] = fSlow151 * (fSlow149 * fRec355[i] + fSlow199 * fRec355[i - 1] + fSlow149 * fRec355[i - 2]) - fSlow153 * (fSlow154 * fRec354[i - 2] + fSlow150 * fRec354[i - 1]);
-				fZec184[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow153 * (fSlow149 * fRec354[i] + fSlow199 * fRec354[i - 1] + fSlow149 * fRec354[i - 2]))));
-				iZec185[i] = (fZec184[i] > fSlow205) + (fZec184[i] > fSlow206);
-				fZec186[i] = fZec184[i] - fSlow202;
-				float fThen140 = fZec186[i];
-				float fElse140 = fSlow207 * mydsp_faustpower2_f(fSlow204 + fZec186[i]);
-				float fThen141 = ((iZec185[i] == 1) ? fElse140 : fThen140);
-				fZec187[i] = 0.0f - fSlow200 * std::max<float>(0.0f, ((iZec185[i] == 0) ? 0.0f : fThen141));
-				fZec188[i] = ((fZec187[i] > fRec353[i - 1]) ? fSlow213 : fSlow210);
-				fRec353[i] = fZec187[i] * (1.0f - fZec188[i]) + fRec353[i - 1] * fZec188[i];
-				fRec358[i] = fSlow146 * (fSlow149 * fRec332[i] + fSlow199 * fRec332[i - 1] + fSlow149 * fRec332[i - 2]) - fSlow151 * (fSlow152 * fRec358[i - 2] + fSlow150 * fRec358[i - 1]);
-				fRec357[i] = fSlow151 * (fSlow149 * fRec358[i] + fSlow199 * fRec358[i - 1] + fSlow149 * fRec358[i - 2]) - fSlow153 * (fSlow154 * fRec357[i - 2] + fSlow150 * fRec357[i - 1]);
-				fZec189[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow153 * (fSlow149 * fRec357[i] + fSlow199 * fRec357[i - 1] + fSlow149 * fRec357[i - 2]))));
-				iZec190[i] = (fZec189[i] > fSlow205) + (fZec189[i] > fSlow206);
-				fZec191[i] = fZec189[i] - fSlow202;
-				float fThen147 = fZec191[i];
-				float fElse147 = fSlow207 * mydsp_faustpower2_f(fSlow204 + fZec191[i]);
-				float fThen148 = ((iZec190[i] == 1) ? fElse147 : fThen147);
-				fZec192[i] = 0.0f - fSlow200 * std::max<float>(0.0f, ((iZec190[i] == 0) ? 0.0f : fThen148));
-				fZec193[i] = ((fZec192[i] > fRec356[i - 1]) ? fSlow213 : fSlow210);
-				fRec356[i] = fZec192[i] * (1.0f - fZec193[i]) + fRec356[i - 1] * fZec193[i];
 				fZec194[i] = fRec262[i] + 0.5f * fRec263[i] * fZec172[i] + fRec264[i] * fZec173[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec195[i] = std::min<float>(fRec353[i], fRec356[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec196[i] = fMscompGains[i][2];
+#else
 				fZec196[i] = fRec353[i] + fSlow214 * (fZec195[i] - fRec353[i]);
+#endif
 				fVbargraph10 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec196[i])));
 				fZec197[i] = fZec196[i];
 				fZec198[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec197[i]));
@@ -9098,31 +7932,15 @@ class mydsp : public dsp {
 				fRec232[i] = fZec232[i];
 				fRec233[i] = fZec235[i];
 				fRec234[i] = fZec236[i];
-				fRec361[i] = fSlow135 * (fSlow138 * fRec314[i] + fSlow215 * fRec314[i - 1] + fSlow138 * fRec314[i - 2]) - fSlow140 * (fSlow141 * fRec361[i - 2] + fSlow139 * fRec361[i - 1]);
-				fRec360[i] = fSlow140 * (fSlow138 * fRec361[i] + fSlow215 * fRec361[i - 1] + fSlow138 * fRec361[i - 2]) - fSlow142 * (fSlow143 * fRec360[i - 2] + fSlow139 * fRec360[i - 1]);
-				fZec237[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow142 * (fSlow138 * fRec360[i] + fSlow215 * fRec360[i - 1] + fSlow138 * fRec360[i - 2]))));
-				iZec238[i] = (fZec237[i] > fSlow221) + (fZec237[i] > fSlow222);
-				fZec239[i] = fZec237[i] - fSlow218;
-				float fThen150 = fZec239[i];
-				float fElse150 = fSlow223 * mydsp_faustpower2_f(fSlow220 + fZec239[i]);
-				float fThen151 = ((iZec238[i] == 1) ? fElse150 : fThen150);
-				fZec240[i] = 0.0f - fSlow216 * std::max<float>(0.0f, ((iZec238[i] == 0) ? 0.0f : fThen151));
-				fZec241[i] = ((fZec240[i] > fRec359[i - 1]) ? fSlow229 : fSlow226);
-				fRec359[i] = fZec240[i] * (1.0f - fZec241[i]) + fRec359[i - 1] * fZec241[i];
-				fRec364[i] = fSlow135 * (fSlow138 * fRec335[i] + fSlow215 * fRec335[i - 1] + fSlow138 * fRec335[i - 2]) - fSlow140 * (fSlow141 * fRec364[i - 2] + fSlow139 * fRec364[i - 1]);
-				fRec363[i] = fSlow140 * (fSlow138 * fRec364[i] + fSlow215 * fRec364[i - 1] + fSlow138 * fRec364[i - 2]) - fSlow142 * (fSlow143 * fRec363[i - 2] + fSlow139 * fRec363[i - 1]);
-				fZec242[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow142 * (fSlow138 * fRec363[i] + fSlow215 * fRec363[i - 1] + fSlow138 * fRec363[i - 2]))));
-				iZec243[i] = (fZec242[i] > fSlow221) + (fZec242[i] > fSlow222);
-				fZec244[i] = fZec242[i] - fSlow218;
-				float fThen157 = fZec244[i];
-				float fElse157 = fSlow223 * mydsp_faustpower2_f(fSlow220 + fZec244[i]);
-				float fThen158 = ((iZec243[i] == 1) ? fElse157 : fThen157);
-				fZec245[i] = 0.0f - fSlow216 * std::max<float>(0.0f, ((iZec243[i] == 0) ? 0.0f : fThen158));
-				fZec246[i] = ((fZec245[i] > fRec362[i - 1]) ? fSlow229 : fSlow226);
-				fRec362[i] = fZec245[i] * (1.0f - fZec246[i]) + fRec362[i - 1] * fZec246[i];
 				fZec247[i] = fRec232[i] + 0.5f * fRec233[i] * fZec225[i] + fRec234[i] * fZec226[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec248[i] = std::min<float>(fRec359[i], fRec362[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec249[i] = fMscompGains[i][3];
+#else
 				fZec249[i] = fRec359[i] + fSlow230 * (fZec248[i] - fRec359[i]);
+#endif
 				fVbargraph11 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec249[i])));
 				fZec250[i] = fZec249[i];
 				fZec251[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec250[i]));
@@ -9194,31 +8012,15 @@ class mydsp : public dsp {
 				fRec202[i] = fZec285[i];
 				fRec203[i] = fZec288[i];
 				fRec204[i] = fZec289[i];
-				fRec367[i] = fSlow124 * (fSlow127 * fRec317[i] + fSlow231 * fRec317[i - 1] + fSlow127 * fRec317[i - 2]) - fSlow129 * (fSlow130 * fRec367[i - 2] + fSlow128 * fRec367[i - 1]);
-				fRec366[i] = fSlow129 * (fSlow127 * fRec367[i] + fSlow231 * fRec367[i - 1] + fSlow127 * fRec367[i - 2]) - fSlow131 * (fSlow132 * fRec366[i - 2] + fSlow128 * fRec366[i - 1]);
-				fZec290[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow131 * (fSlow127 * fRec366[i] + fSlow231 * fRec366[i - 1] + fSlow127 * fRec366[i - 2]))));
-				iZec291[i] = (fZec290[i] > fSlow237) + (fZec290[i] > fSlow238);
-				fZec292[i] = fZec290[i] - fSlow234;
-				float fThen160 = fZec292[i];
-				float fElse160 = fSlow239 * mydsp_faustpower2_f(fSlow236 + fZec292[i]);
-				float fThen161 = ((iZec291[i] == 1) ? fElse160 : fThen160);
-				fZec293[i] = 0.0f - fSlow232 * std::max<float>(0.0f, ((iZec291[i] == 0) ? 0.0f : fThen161));
-				fZec294[i] = ((fZec293[i] > fRec365[i - 1]) ? fSlow245 : fSlow242);
-				fRec365[i] = fZec293[i] * (1.0f - fZec294[i]) + fRec365[i - 1] * fZec294[i];
-				fRec370[i] = fSlow124 * (fSlow127 * fRec338[i] + fSlow231 * fRec338[i - 1] + fSlow127 * fRec338[i - 2]) - fSlow129 * (fSlow130 * fRec370[i - 2] + fSlow128 * fRec370[i - 1]);
-				fRec369[i] = fSlow129 * (fSlow127 * fRec370[i] + fSlow231 * fRec370[i - 1] + fSlow127 * fRec370[i - 2]) - fSlow131 * (fSlow132 * fRec369[i - 2] + fSlow128 * fRec369[i - 1]);
-				fZec295[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow131 * (fSlow127 * fRec369[i] + fSlow231 * fRec369[i - 1] + fSlow127 * fRec369[i - 2]))));
-				iZec296[i] = (fZec295[i] > fSlow237) + (fZec295[i] > fSlow238);
-				fZec297[i] = fZec295[i] - fSlow234;
-				float fThen167 = fZec297[i];
-				float fElse167 = fSlow239 * mydsp_faustpower2_f(fSlow236 + fZec297[i]);
-				float fThen168 = ((iZec296[i] == 1) ? fElse167 : fThen167);
-				fZec298[i] = 0.0f - fSlow232 * std::max<float>(0.0f, ((iZec296[i] == 0) ? 0.0f : fThen168));
-				fZec299[i] = ((fZec298[i] > fRec368[i - 1]) ? fSlow245 : fSlow242);
-				fRec368[i] = fZec298[i] * (1.0f - fZec299[i]) + fRec368[i - 1] * fZec299[i];
 				fZec300[i] = fRec202[i] + 0.5f * fRec203[i] * fZec278[i] + fRec204[i] * fZec279[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec301[i] = std::min<float>(fRec365[i], fRec368[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec302[i] = fMscompGains[i][4];
+#else
 				fZec302[i] = fRec365[i] + fSlow246 * (fZec301[i] - fRec365[i]);
+#endif
 				fVbargraph12 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec302[i])));
 				fZec303[i] = fZec302[i];
 				fZec304[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec303[i]));
@@ -9290,31 +8092,15 @@ class mydsp : public dsp {
 				fRec172[i] = fZec338[i];
 				fRec173[i] = fZec341[i];
 				fRec174[i] = fZec342[i];
-				fRec373[i] = fSlow113 * (fSlow116 * fRec320[i] + fSlow247 * fRec320[i - 1] + fSlow116 * fRec320[i - 2]) - fSlow118 * (fSlow119 * fRec373[i - 2] + fSlow117 * fRec373[i - 1]);
-				fRec372[i] = fSlow118 * (fSlow116 * fRec373[i] + fSlow247 * fRec373[i - 1] + fSlow116 * fRec373[i - 2]) - fSlow120 * (fSlow121 * fRec372[i - 2] + fSlow117 * fRec372[i - 1]);
-				fZec343[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow120 * (fSlow116 * fRec372[i] + fSlow247 * fRec372[i - 1] + fSlow116 * fRec372[i - 2]))));
-				iZec344[i] = (fZec343[i] > fSlow253) + (fZec343[i] > fSlow254);
-				fZec345[i] = fZec343[i] - fSlow250;
-				float fThen170 = fZec345[i];
-				float fElse170 = fSlow255 * mydsp_faustpower2_f(fSlow252 + fZec345[i]);
-				float fThen171 = ((iZec344[i] == 1) ? fElse170 : fThen170);
-				fZec346[i] = 0.0f - fSlow248 * std::max<float>(0.0f, ((iZec344[i] == 0) ? 0.0f : fThen171));
-				fZec347[i] = ((fZec346[i] > fRec371[i - 1]) ? fSlow261 : fSlow258);
-				fRec371[i] = fZec346[i] * (1.0f - fZec347[i]) + fRec371[i - 1] * fZec347[i];
-				fRec376[i] = fSlow113 * (fSlow116 * fRec341[i] + fSlow247 * fRec341[i - 1] + fSlow116 * fRec341[i - 2]) - fSlow118 * (fSlow119 * fRec376[i - 2] + fSlow117 * fRec376[i - 1]);
-				fRec375[i] = fSlow118 * (fSlow116 * fRec376[i] + fSlow247 * fRec376[i - 1] + fSlow116 * fRec376[i - 2]) - fSlow120 * (fSlow121 * fRec375[i - 2] + fSlow117 * fRec375[i - 1]);
-				fZec348[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow120 * (fSlow116 * fRec375[i] + fSlow247 * fRec375[i - 1] + fSlow116 * fRec375[i - 2]))));
-				iZec349[i] = (fZec348[i] > fSlow253) + (fZec348[i] > fSlow254);
-				fZec350[i] = fZec348[i] - fSlow250;
-				float fThen177 = fZec350[i];
-				float fElse177 = fSlow255 * mydsp_faustpower2_f(fSlow252 + fZec350[i]);
-				float fThen178 = ((iZec349[i] == 1) ? fElse177 : fThen177);
-				fZec351[i] = 0.0f - fSlow248 * std::max<float>(0.0f, ((iZec349[i] == 0) ? 0.0f : fThen178));
-				fZec352[i] = ((fZec351[i] > fRec374[i - 1]) ? fSlow261 : fSlow258);
-				fRec374[i] = fZec351[i] * (1.0f - fZec352[i]) + fRec374[i - 1] * fZec352[i];
 				fZec353[i] = fRec172[i] + 0.5f * fRec173[i] * fZec331[i] + fRec174[i] * fZec332[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec354[i] = std::min<float>(fRec371[i], fRec374[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec355[i] = fMscompGains[i][5];
+#else
 				fZec355[i] = fRec371[i] + fSlow262 * (fZec354[i] - fRec371[i]);
+#endif
 				fVbargraph13 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec355[i])));
 				fZec356[i] = fZec355[i];
 				fZec357[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec356[i]));
@@ -9386,31 +8172,15 @@ class mydsp : public dsp {
 				fRec142[i] = fZec391[i];
 				fRec143[i] = fZec394[i];
 				fRec144[i] = fZec395[i];
-				fRec379[i] = fSlow102 * (fSlow105 * fRec323[i] + fSlow263 * fRec323[i - 1] + fSlow105 * fRec323[i - 2]) - fSlow107 * (fSlow108 * fRec379[i - 2] + fSlow106 * fRec379[i - 1]);
-				fRec378[i] = fSlow107 * (fSlow105 * fRec379[i] + fSlow263 * fRec379[i - 1] + fSlow105 * fRec379[i - 2]) - fSlow109 * (fSlow110 * fRec378[i - 2] + fSlow106 * fRec378[i - 1]);
-				fZec396[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow109 * (fSlow105 * fRec378[i] + fSlow263 * fRec378[i - 1] + fSlow105 * fRec378[i - 2]))));
-				iZec397[i] = (fZec396[i] > fSlow269) + (fZec396[i] > fSlow270);
-				fZec398[i] = fZec396[i] - fSlow266;
-				float fThen180 = fZec398[i];
-				float fElse180 = fSlow271 * mydsp_faustpower2_f(fSlow268 + fZec398[i]);
-				float fThen181 = ((iZec397[i] == 1) ? fElse180 : fThen180);
-				fZec399[i] = 0.0f - fSlow264 * std::max<float>(0.0f, ((iZec397[i] == 0) ? 0.0f : fThen181));
-				fZec400[i] = ((fZec399[i] > fRec377[i - 1]) ? fSlow277 : fSlow274);
-				fRec377[i] = fZec399[i] * (1.0f - fZec400[i]) + fRec377[i - 1] * fZec400[i];
-				fRec382[i] = fSlow102 * (fSlow105 * fRec344[i] + fSlow263 * fRec344[i - 1] + fSlow105 * fRec344[i - 2]) - fSlow107 * (fSlow108 * fRec382[i - 2] + fSlow106 * fRec382[i - 1]);
-				fRec381[i] = fSlow107 * (fSlow105 * fRec382[i] + fSlow263 * fRec382[i - 1] + fSlow105 * fRec382[i - 2]) - fSlow109 * (fSlow110 * fRec381[i - 2] + fSlow106 * fRec381[i - 1]);
-				fZec401[i] = 20.0f * std::log10(std::max<float>(1.17549435e-38f, std::fabs(fSlow109 * (fSlow105 * fRec381[i] + fSlow263 * fRec381[i - 1] + fSlow105 * fRec381[i - 2]))));
-				iZec402[i] = (fZec401[i] > fSlow269) + (fZec401[i] > fSlow270);
-				fZec403[i] = fZec401[i] - fSlow266;
-				float fThen187 = fZec403[i];
-				float fElse187 = fSlow271 * mydsp_faustpower2_f(fSlow268 + fZec403[i]);
-				float fThen188 = ((iZec402[i] == 1) ? fElse187 : fThen187);
-				fZec404[i] = 0.0f - fSlow264 * std::max<float>(0.0f, ((iZec402[i] == 0) ? 0.0f : fThen188));
-				fZec405[i] = ((fZec404[i] > fRec380[i - 1]) ? fSlow277 : fSlow274);
-				fRec380[i] = fZec404[i] * (1.0f - fZec405[i]) + fRec380[i - 1] * fZec405[i];
 				fZec406[i] = fRec142[i] + 0.5f * fRec143[i] * fZec384[i] + fRec144[i] * fZec385[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec407[i] = std::min<float>(fRec377[i], fRec380[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec408[i] = fMscompGains[i][6];
+#else
 				fZec408[i] = fRec377[i] + fSlow278 * (fZec407[i] - fRec377[i]);
+#endif
 				fVbargraph14 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec408[i])));
 				fZec409[i] = fZec408[i];
 				fZec410[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec409[i]));
@@ -9482,8 +8252,14 @@ class mydsp : public dsp {
 				fRec112[i] = fZec444[i];
 				fRec113[i] = fZec447[i];
 				fRec114[i] = fZec448[i];
+#if ! MASTER_ME_MSCOMP_KERNEL
 				fZec449[i] = std::min<float>(fRec87[i], fRec91[i]);
+#endif
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec450[i] = fMscompGains[i][7];
+#else
 				fZec450[i] = fRec87[i] + fSlow279 * (fZec449[i] - fRec87[i]);
+#endif
 				fVbargraph15 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec450[i])));
 				fZec451[i] = std::pow(10.0f, 0.00833333377f * fZec450[i]);
 				fZec452[i] = std::sqrt(fZec451[i]);
@@ -9520,7 +8296,11 @@ class mydsp : public dsp {
 				fRec97[i] = fZec466[i];
 				fRec98[i] = fZec469[i];
 				fRec99[i] = fZec470[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec471[i] = fMscompGains[i][8];
+#else
 				fZec471[i] = fRec326[i] + fSlow179 * (fZec110[i] - fRec326[i]);
+#endif
 				fVbargraph16 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec471[i])));
 				fZec472[i] = std::pow(10.0f, 0.00833333377f * fZec471[i]);
 				fZec473[i] = std::sqrt(fZec472[i]);
@@ -9557,7 +8337,11 @@ class mydsp : public dsp {
 				fRec581[i] = fZec489[i];
 				fRec582[i] = fZec490[i];
 				fZec491[i] = fRec580[i] + 0.5f * fRec581[i] * fZec479[i] + fRec582[i] * fZec480[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec492[i] = fMscompGains[i][9];
+#else
 				fZec492[i] = fRec350[i] + fSlow198 * (fZec142[i] - fRec350[i]);
+#endif
 				fVbargraph17 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec492[i])));
 				fZec493[i] = fZec492[i];
 				fZec494[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec493[i]));
@@ -9630,7 +8414,11 @@ class mydsp : public dsp {
 				fRec551[i] = fZec531[i];
 				fRec552[i] = fZec532[i];
 				fZec533[i] = fRec550[i] + 0.5f * fRec551[i] * fZec521[i] + fRec552[i] * fZec522[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec534[i] = fMscompGains[i][10];
+#else
 				fZec534[i] = fRec356[i] + fSlow214 * (fZec195[i] - fRec356[i]);
+#endif
 				fVbargraph18 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec534[i])));
 				fZec535[i] = fZec534[i];
 				fZec536[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec535[i]));
@@ -9703,7 +8491,11 @@ class mydsp : public dsp {
 				fRec521[i] = fZec573[i];
 				fRec522[i] = fZec574[i];
 				fZec575[i] = fRec520[i] + 0.5f * fRec521[i] * fZec563[i] + fRec522[i] * fZec564[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec576[i] = fMscompGains[i][11];
+#else
 				fZec576[i] = fRec362[i] + fSlow230 * (fZec248[i] - fRec362[i]);
+#endif
 				fVbargraph19 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec576[i])));
 				fZec577[i] = fZec576[i];
 				fZec578[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec577[i]));
@@ -9776,7 +8568,11 @@ class mydsp : public dsp {
 				fRec491[i] = fZec615[i];
 				fRec492[i] = fZec616[i];
 				fZec617[i] = fRec490[i] + 0.5f * fRec491[i] * fZec605[i] + fRec492[i] * fZec606[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec618[i] = fMscompGains[i][12];
+#else
 				fZec618[i] = fRec368[i] + fSlow246 * (fZec301[i] - fRec368[i]);
+#endif
 				fVbargraph20 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec618[i])));
 				fZec619[i] = fZec618[i];
 				fZec620[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec619[i]));
@@ -9849,7 +8645,11 @@ class mydsp : public dsp {
 				fRec461[i] = fZec657[i];
 				fRec462[i] = fZec658[i];
 				fZec659[i] = fRec460[i] + 0.5f * fRec461[i] * fZec647[i] + fRec462[i] * fZec648[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec660[i] = fMscompGains[i][13];
+#else
 				fZec660[i] = fRec374[i] + fSlow262 * (fZec354[i] - fRec374[i]);
+#endif
 				fVbargraph21 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec660[i])));
 				fZec661[i] = fZec660[i];
 				fZec662[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec661[i]));
@@ -9922,7 +8722,11 @@ class mydsp : public dsp {
 				fRec431[i] = fZec699[i];
 				fRec432[i] = fZec700[i];
 				fZec701[i] = fRec430[i] + 0.5f * fRec431[i] * fZec689[i] + fRec432[i] * fZec690[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec702[i] = fMscompGains[i][14];
+#else
 				fZec702[i] = fRec380[i] + fSlow278 * (fZec407[i] - fRec380[i]);
+#endif
 				fVbargraph22 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec702[i])));
 				fZec703[i] = fZec702[i];
 				fZec704[i] = std::pow(10.0f, 0.0250000004f * (0.0f - 0.333333343f * fZec703[i]));
@@ -9994,7 +8798,11 @@ class mydsp : public dsp {
 				fRec400[i] = fZec738[i];
 				fRec401[i] = fZec741[i];
 				fRec402[i] = fZec742[i];
+#if MASTER_ME_MSCOMP_KERNEL
+				fZec743[i] = fMscompGains[i][15];
+#else
 				fZec743[i] = fRec91[i] + fSlow279 * (fZec449[i] - fRec91[i]);
+#endif
 				fVbargraph23 = FAUSTFLOAT(std::min<float>(0.0f, std::max<float>(-6.0f, fZec743[i])));
 				fZec744[i] = std::pow(10.0f, 0.00833333377f * fZec743[i]);
 				fZec745[i] = std::sqrt(fZec744[i]);
@@ -10196,8 +9004,8 @@ class mydsp : public dsp {
 			for (int j623 = 0; j623 < 4; j623 = j623 + 1) {
 				fRec519_perm[j623] = fRec519_tmp[vsize + j623];
 			}
-			for (int j625 = 0; j625 < 4; j625 = j625 + 1) {
-				fRec513_perm[j625] = fRec513_tmp[vsize + j625];
+			for (int j807 = 0; j807 < 4; j807 = j807 + 1) {
+				fRec513_perm[j807] = fRec513_tmp[vsize + j807];
 			}
 			for (int j627 = 0; j627 < 4; j627 = j627 + 1) {
 				fRec514_perm[j627] = fRec514_tmp[vsize + j627];
@@ -10853,717 +9661,179 @@ class mydsp : public dsp {
 			for (int j237 = 0; j237 < 4; j237 = j237 + 1) {
 				fRec92_perm[j237] = fRec92_tmp[vsize + j237];
 			}
-			for (int j239 = 0; j239 < 4; j239 = j239 + 1) {
-				fRec91_perm[j239] = fRec91_tmp[vsize + j239];
-			}
-			for (int j225 = 0; j225 < 4; j225 = j225 + 1) {
-				fRec90_perm[j225] = fRec90_tmp[vsize + j225];
-			}
-			for (int j227 = 0; j227 < 4; j227 = j227 + 1) {
-				fRec89_perm[j227] = fRec89_tmp[vsize + j227];
-			}
-			for (int j229 = 0; j229 < 4; j229 = j229 + 1) {
-				fRec88_perm[j229] = fRec88_tmp[vsize + j229];
-			}
-			for (int j231 = 0; j231 < 4; j231 = j231 + 1) {
-				fRec87_perm[j231] = fRec87_tmp[vsize + j231];
-			}
-			fRec85_idx_save = vsize;
-			for (int j221 = 0; j221 < 4; j221 = j221 + 1) {
-				fRec84_perm[j221] = fRec84_tmp[vsize + j221];
-			}
-			fRec83_idx_save = vsize;
-			for (int j219 = 0; j219 < 4; j219 = j219 + 1) {
-				fRec82_perm[j219] = fRec82_tmp[vsize + j219];
-			}
-			for (int j201 = 0; j201 < 4; j201 = j201 + 1) {
-				fYec89_perm[j201] = fYec89_tmp[vsize + j201];
-			}
-			for (int j203 = 0; j203 < 4; j203 = j203 + 1) {
-				fYec90_perm[j203] = fYec90_tmp[vsize + j203];
-			}
-			for (int j205 = 0; j205 < 8; j205 = j205 + 1) {
-				fYec91_perm[j205] = fYec91_tmp[vsize + j205];
-			}
-			for (int j207 = 0; j207 < 16; j207 = j207 + 1) {
-				fYec92_perm[j207] = fYec92_tmp[vsize + j207];
-			}
-			fYec93_idx_save = vsize;
-			fYec94_idx_save = vsize;
-			fYec95_idx_save = vsize;
-			fYec96_idx_save = vsize;
-			fYec97_idx_save = vsize;
-			fYec98_idx_save = vsize;
-			fYec99_idx_save = vsize;
-			fYec100_idx_save = vsize;
-			fYec101_idx_save = vsize;
-			fYec102_idx_save = vsize;
-			fYec103_idx_save = vsize;
-			fYec104_idx_save = vsize;
-			fYec105_idx_save = vsize;
-			for (int j193 = 0; j193 < 4; j193 = j193 + 1) {
-				fYec72_perm[j193] = fYec72_tmp[vsize + j193];
-			}
-			for (int j195 = 0; j195 < 4; j195 = j195 + 1) {
-				fYec73_perm[j195] = fYec73_tmp[vsize + j195];
-			}
-			for (int j197 = 0; j197 < 8; j197 = j197 + 1) {
-				fYec74_perm[j197] = fYec74_tmp[vsize + j197];
-			}
-			for (int j199 = 0; j199 < 16; j199 = j199 + 1) {
-				fYec75_perm[j199] = fYec75_tmp[vsize + j199];
-			}
-			fYec76_idx_save = vsize;
-			fYec77_idx_save = vsize;
-			fYec78_idx_save = vsize;
-			fYec79_idx_save = vsize;
-			fYec80_idx_save = vsize;
-			fYec81_idx_save = vsize;
-			fYec82_idx_save = vsize;
-			fYec83_idx_save = vsize;
-			fYec84_idx_save = vsize;
-			fYec85_idx_save = vsize;
-			fYec86_idx_save = vsize;
-			fYec87_idx_save = vsize;
-			fYec88_idx_save = vsize;
-			for (int j187 = 0; j187 < 4; j187 = j187 + 1) {
-				fYec71_perm[j187] = fYec71_tmp[vsize + j187];
-			}
-			for (int j181 = 0; j181 < 4; j181 = j181 + 1) {
-				fYec70_perm[j181] = fYec70_tmp[vsize + j181];
-			}
-			for (int j183 = 0; j183 < 4; j183 = j183 + 1) {
-				fRec78_perm[j183] = fRec78_tmp[vsize + j183];
-			}
-			for (int j185 = 0; j185 < 4; j185 = j185 + 1) {
-				fRec77_perm[j185] = fRec77_tmp[vsize + j185];
-			}
-			for (int j189 = 0; j189 < 4; j189 = j189 + 1) {
-				fRec76_perm[j189] = fRec76_tmp[vsize + j189];
-			}
-			for (int j191 = 0; j191 < 4; j191 = j191 + 1) {
-				fRec75_perm[j191] = fRec75_tmp[vsize + j191];
-			}
-			for (int j175 = 0; j175 < 4; j175 = j175 + 1) {
-				fYec69_perm[j175] = fYec69_tmp[vsize + j175];
-			}
-			for (int j169 = 0; j169 < 4; j169 = j169 + 1) {
-				fYec68_perm[j169] = fYec68_tmp[vsize + j169];
-			}
-			for (int j171 = 0; j171 < 4; j171 = j171 + 1) {
-				fRec74_perm[j171] = fRec74_tmp[vsize + j171];
-			}
-			for (int j173 = 0; j173 < 4; j173 = j173 + 1) {
-				fRec73_perm[j173] = fRec73_tmp[vsize + j173];
-			}
-			for (int j177 = 0; j177 < 4; j177 = j177 + 1) {
-				fRec72_perm[j177] = fRec72_tmp[vsize + j177];
-			}
-			for (int j179 = 0; j179 < 4; j179 = j179 + 1) {
-				fRec71_perm[j179] = fRec71_tmp[vsize + j179];
-			}
-			for (int j209 = 0; j209 < 4; j209 = j209 + 1) {
-				fRec10_perm[j209] = fRec10_tmp[vsize + j209];
-			}
-			for (int j211 = 0; j211 < 4; j211 = j211 + 1) {
-				fRec9_perm[j211] = fRec9_tmp[vsize + j211];
-			}
-			for (int j737 = 0; j737 < 4; j737 = j737 + 1) {
-				fRec5_perm[j737] = fRec5_tmp[vsize + j737];
-			}
-			for (int j739 = 0; j739 < 4; j739 = j739 + 1) {
-				fRec6_perm[j739] = fRec6_tmp[vsize + j739];
-			}
-			for (int j751 = 0; j751 < 4; j751 = j751 + 1) {
-				fRec3_perm[j751] = fRec3_tmp[vsize + j751];
-			}
-			for (int j753 = 0; j753 < 4; j753 = j753 + 1) {
-				fRec4_perm[j753] = fRec4_tmp[vsize + j753];
-			}
-			for (int j755 = 0; j755 < 4; j755 = j755 + 1) {
-				fRec1_perm[j755] = fRec1_tmp[vsize + j755];
-			}
-			for (int j757 = 0; j757 < 4; j757 = j757 + 1) {
-				fRec2_perm[j757] = fRec2_tmp[vsize + j757];
-			}
-			/* Vectorizable loop 182 */
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fZec799[i] = 1.0f - fRec0[i];
-			}
-			/* Vectorizable loop 183 */
-			/* Pre code */
-			for (int j758 = 0; j758 < 4; j758 = j758 + 1) {
-				fYec106_tmp[j758] = fYec106_perm[j758];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec106[i] = float(input0[i]) * fRec0[i] + fRec1[i] * fZec799[i];
-			}
-			/* Post code */
-			for (int j759 = 0; j759 < 4; j759 = j759 + 1) {
-				fYec106_perm[j759] = fYec106_tmp[vsize + j759];
-			}
-			/* Vectorizable loop 184 */
-			/* Pre code */
-			for (int j774 = 0; j774 < 4; j774 = j774 + 1) {
-				fYec109_tmp[j774] = fYec109_perm[j774];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec109[i] = float(input1[i]) * fRec0[i] + fRec2[i] * fZec799[i];
-			}
-			/* Post code */
-			for (int j775 = 0; j775 < 4; j775 = j775 + 1) {
-				fYec109_perm[j775] = fYec109_tmp[vsize + j775];
-			}
-			/* Recursive loop 185 */
-			/* Pre code */
-			for (int j762 = 0; j762 < 4; j762 = j762 + 1) {
-				fYec107_tmp[j762] = fYec107_perm[j762];
-			}
-			for (int j764 = 0; j764 < 4; j764 = j764 + 1) {
-				fRec606_tmp[j764] = fRec606_perm[j764];
-			}
-			for (int j766 = 0; j766 < 4; j766 = j766 + 1) {
-				fRec605_tmp[j766] = fRec605_perm[j766];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec107[i] = 0.0f - fConst8 * (fConst9 * fRec605[i - 1] - fConst10 * fYec106[i - 1]);
-				fRec606[i] = fYec107[i - 1] + fConst8 * (fConst11 * fYec106[i] - 2.0f * (fConst13 * fRec606[i - 1] - fConst14 * fYec106[i - 1]));
-				fRec605[i] = fRec606[i];
-			}
-			/* Post code */
-			for (int j763 = 0; j763 < 4; j763 = j763 + 1) {
-				fYec107_perm[j763] = fYec107_tmp[vsize + j763];
-			}
-			for (int j765 = 0; j765 < 4; j765 = j765 + 1) {
-				fRec606_perm[j765] = fRec606_tmp[vsize + j765];
-			}
-			for (int j767 = 0; j767 < 4; j767 = j767 + 1) {
-				fRec605_perm[j767] = fRec605_tmp[vsize + j767];
-			}
-			/* Recursive loop 186 */
-			/* Pre code */
-			for (int j776 = 0; j776 < 4; j776 = j776 + 1) {
-				fYec110_tmp[j776] = fYec110_perm[j776];
-			}
-			for (int j778 = 0; j778 < 4; j778 = j778 + 1) {
-				fRec610_tmp[j778] = fRec610_perm[j778];
-			}
-			for (int j780 = 0; j780 < 4; j780 = j780 + 1) {
-				fRec609_tmp[j780] = fRec609_perm[j780];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec110[i] = 0.0f - fConst8 * (fConst9 * fRec609[i - 1] - fConst10 * fYec109[i - 1]);
-				fRec610[i] = fYec110[i - 1] + fConst8 * (fConst11 * fYec109[i] - 2.0f * (fConst13 * fRec610[i - 1] - fConst14 * fYec109[i - 1]));
-				fRec609[i] = fRec610[i];
-			}
-			/* Post code */
-			for (int j777 = 0; j777 < 4; j777 = j777 + 1) {
-				fYec110_perm[j777] = fYec110_tmp[vsize + j777];
-			}
-			for (int j779 = 0; j779 < 4; j779 = j779 + 1) {
-				fRec610_perm[j779] = fRec610_tmp[vsize + j779];
-			}
-			for (int j781 = 0; j781 < 4; j781 = j781 + 1) {
-				fRec609_perm[j781] = fRec609_tmp[vsize + j781];
-			}
-			/* Recursive loop 187 */
-			/* Pre code */
-			for (int j768 = 0; j768 < 4; j768 = j768 + 1) {
-				fYec108_tmp[j768] = fYec108_perm[j768];
-			}
-			for (int j770 = 0; j770 < 4; j770 = j770 + 1) {
-				fRec604_tmp[j770] = fRec604_perm[j770];
-			}
-			for (int j772 = 0; j772 < 4; j772 = j772 + 1) {
-				fRec603_tmp[j772] = fRec603_perm[j772];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec108[i] = 0.500327051f * fRec605[i - 1] - fConst20 * fRec603[i - 1];
-				fRec604[i] = fConst18 * fRec605[i - 1] + fConst19 * (fYec108[i - 1] - fConst21 * fRec604[i - 1] + 0.500327051f * fRec605[i]);
-				fRec603[i] = fRec604[i];
-			}
-			/* Post code */
-			for (int j769 = 0; j769 < 4; j769 = j769 + 1) {
-				fYec108_perm[j769] = fYec108_tmp[vsize + j769];
-			}
-			for (int j771 = 0; j771 < 4; j771 = j771 + 1) {
-				fRec604_perm[j771] = fRec604_tmp[vsize + j771];
-			}
-			for (int j773 = 0; j773 < 4; j773 = j773 + 1) {
-				fRec603_perm[j773] = fRec603_tmp[vsize + j773];
-			}
-			/* Recursive loop 188 */
-			/* Pre code */
-			for (int j782 = 0; j782 < 4; j782 = j782 + 1) {
-				fYec111_tmp[j782] = fYec111_perm[j782];
-			}
-			for (int j784 = 0; j784 < 4; j784 = j784 + 1) {
-				fRec608_tmp[j784] = fRec608_perm[j784];
-			}
-			for (int j786 = 0; j786 < 4; j786 = j786 + 1) {
-				fRec607_tmp[j786] = fRec607_perm[j786];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec111[i] = 0.500327051f * fRec609[i - 1] - fConst20 * fRec607[i - 1];
-				fRec608[i] = fConst18 * fRec609[i - 1] + fConst19 * (fYec111[i - 1] - fConst21 * fRec608[i - 1] + 0.500327051f * fRec609[i]);
-				fRec607[i] = fRec608[i];
-			}
-			/* Post code */
-			for (int j783 = 0; j783 < 4; j783 = j783 + 1) {
-				fYec111_perm[j783] = fYec111_tmp[vsize + j783];
-			}
-			for (int j785 = 0; j785 < 4; j785 = j785 + 1) {
-				fRec608_perm[j785] = fRec608_tmp[vsize + j785];
-			}
-			for (int j787 = 0; j787 < 4; j787 = j787 + 1) {
-				fRec607_perm[j787] = fRec607_tmp[vsize + j787];
-			}
-			/* Vectorizable loop 189 */
-			/* Pre code */
-			for (int j788 = 0; j788 < 4; j788 = j788 + 1) {
-				fYec112_tmp[j788] = fYec112_perm[j788];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec112[i] = mydsp_faustpower2_f(fRec603[i]);
-			}
-			/* Post code */
-			for (int j789 = 0; j789 < 4; j789 = j789 + 1) {
-				fYec112_perm[j789] = fYec112_tmp[vsize + j789];
-			}
-			/* Vectorizable loop 190 */
-			/* Pre code */
-			for (int j796 = 0; j796 < 4; j796 = j796 + 1) {
-				fYec132_tmp[j796] = fYec132_perm[j796];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec132[i] = mydsp_faustpower2_f(fRec607[i]);
-			}
-			/* Post code */
-			for (int j797 = 0; j797 < 4; j797 = j797 + 1) {
-				fYec132_perm[j797] = fYec132_tmp[vsize + j797];
-			}
-			/* Vectorizable loop 191 */
-			/* Pre code */
-			for (int j790 = 0; j790 < 4; j790 = j790 + 1) {
-				fYec113_tmp[j790] = fYec113_perm[j790];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec113[i] = fYec112[i] + fYec112[i - 1];
-			}
-			/* Post code */
-			for (int j791 = 0; j791 < 4; j791 = j791 + 1) {
-				fYec113_perm[j791] = fYec113_tmp[vsize + j791];
-			}
-			/* Vectorizable loop 192 */
-			/* Pre code */
-			for (int j798 = 0; j798 < 4; j798 = j798 + 1) {
-				fYec133_tmp[j798] = fYec133_perm[j798];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec133[i] = fYec132[i] + fYec132[i - 1];
-			}
-			/* Post code */
-			for (int j799 = 0; j799 < 4; j799 = j799 + 1) {
-				fYec133_perm[j799] = fYec133_tmp[vsize + j799];
-			}
-			/* Vectorizable loop 193 */
-			/* Pre code */
-			for (int j792 = 0; j792 < 8; j792 = j792 + 1) {
-				fYec114_tmp[j792] = fYec114_perm[j792];
-			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec114[i] = fYec113[i] + fYec113[i - 2];
+			for (int j239 = 0; j239 < 4; j239 = j239 + 1) {
+				fRec91_perm[j239] = fRec91_tmp[vsize + j239];
 			}
-			/* Post code */
-			for (int j793 = 0; j793 < 8; j793 = j793 + 1) {
-				fYec114_perm[j793] = fYec114_tmp[vsize + j793];
+			for (int j225 = 0; j225 < 4; j225 = j225 + 1) {
+				fRec90_perm[j225] = fRec90_tmp[vsize + j225];
 			}
-			/* Vectorizable loop 194 */
-			/* Pre code */
-			for (int j800 = 0; j800 < 8; j800 = j800 + 1) {
-				fYec134_tmp[j800] = fYec134_perm[j800];
+			for (int j227 = 0; j227 < 4; j227 = j227 + 1) {
+				fRec89_perm[j227] = fRec89_tmp[vsize + j227];
 			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec134[i] = fYec133[i] + fYec133[i - 2];
+			for (int j229 = 0; j229 < 4; j229 = j229 + 1) {
+				fRec88_perm[j229] = fRec88_tmp[vsize + j229];
 			}
-			/* Post code */
-			for (int j801 = 0; j801 < 8; j801 = j801 + 1) {
-				fYec134_perm[j801] = fYec134_tmp[vsize + j801];
+			for (int j231 = 0; j231 < 4; j231 = j231 + 1) {
+				fRec87_perm[j231] = fRec87_tmp[vsize + j231];
 			}
-			/* Vectorizable loop 195 */
-			/* Pre code */
-			for (int j794 = 0; j794 < 16; j794 = j794 + 1) {
-				fYec115_tmp[j794] = fYec115_perm[j794];
+			fRec85_idx_save = vsize;
+			for (int j221 = 0; j221 < 4; j221 = j221 + 1) {
+				fRec84_perm[j221] = fRec84_tmp[vsize + j221];
 			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec115[i] = fYec114[i] + fYec114[i - 4];
+			fRec83_idx_save = vsize;
+			for (int j219 = 0; j219 < 4; j219 = j219 + 1) {
+				fRec82_perm[j219] = fRec82_tmp[vsize + j219];
 			}
-			/* Post code */
-			for (int j795 = 0; j795 < 16; j795 = j795 + 1) {
-				fYec115_perm[j795] = fYec115_tmp[vsize + j795];
+			for (int j201 = 0; j201 < 4; j201 = j201 + 1) {
+				fYec89_perm[j201] = fYec89_tmp[vsize + j201];
 			}
-			/* Vectorizable loop 196 */
-			/* Pre code */
-			for (int j802 = 0; j802 < 16; j802 = j802 + 1) {
-				fYec135_tmp[j802] = fYec135_perm[j802];
+			for (int j203 = 0; j203 < 4; j203 = j203 + 1) {
+				fYec90_perm[j203] = fYec90_tmp[vsize + j203];
 			}
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec135[i] = fYec134[i] + fYec134[i - 4];
+			for (int j205 = 0; j205 < 8; j205 = j205 + 1) {
+				fYec91_perm[j205] = fYec91_tmp[vsize + j205];
 			}
-			/* Post code */
-			for (int j803 = 0; j803 < 16; j803 = j803 + 1) {
-				fYec135_perm[j803] = fYec135_tmp[vsize + j803];
+			for (int j207 = 0; j207 < 16; j207 = j207 + 1) {
+				fYec92_perm[j207] = fYec92_tmp[vsize + j207];
 			}
-			/* Vectorizable loop 197 */
-			/* Pre code */
-			fYec116_idx = (fYec116_idx + fYec116_idx_save) & 63;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec116[(i + fYec116_idx) & 63] = fYec115[i] + fYec115[i - 8];
+			fYec93_idx_save = vsize;
+			fYec94_idx_save = vsize;
+			fYec95_idx_save = vsize;
+			fYec96_idx_save = vsize;
+			fYec97_idx_save = vsize;
+			fYec98_idx_save = vsize;
+			fYec99_idx_save = vsize;
+			fYec100_idx_save = vsize;
+			fYec101_idx_save = vsize;
+			fYec102_idx_save = vsize;
+			fYec103_idx_save = vsize;
+			fYec104_idx_save = vsize;
+			fYec105_idx_save = vsize;
+			for (int j193 = 0; j193 < 4; j193 = j193 + 1) {
+				fYec72_perm[j193] = fYec72_tmp[vsize + j193];
 			}
-			/* Post code */
-			fYec116_idx_save = vsize;
-			/* Vectorizable loop 198 */
-			/* Pre code */
-			fYec136_idx = (fYec136_idx + fYec136_idx_save) & 63;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec136[(i + fYec136_idx) & 63] = fYec135[i] + fYec135[i - 8];
+			for (int j195 = 0; j195 < 4; j195 = j195 + 1) {
+				fYec73_perm[j195] = fYec73_tmp[vsize + j195];
 			}
-			/* Post code */
-			fYec136_idx_save = vsize;
-			/* Vectorizable loop 199 */
-			/* Pre code */
-			fYec117_idx = (fYec117_idx + fYec117_idx_save) & 127;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec117[(i + fYec117_idx) & 127] = fYec116[(i + fYec116_idx) & 63] + fYec116[((i + fYec116_idx) - 16) & 63];
+			for (int j197 = 0; j197 < 8; j197 = j197 + 1) {
+				fYec74_perm[j197] = fYec74_tmp[vsize + j197];
 			}
-			/* Post code */
-			fYec117_idx_save = vsize;
-			/* Vectorizable loop 200 */
-			/* Pre code */
-			fYec137_idx = (fYec137_idx + fYec137_idx_save) & 127;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec137[(i + fYec137_idx) & 127] = fYec136[(i + fYec136_idx) & 63] + fYec136[((i + fYec136_idx) - 16) & 63];
+			for (int j199 = 0; j199 < 16; j199 = j199 + 1) {
+				fYec75_perm[j199] = fYec75_tmp[vsize + j199];
 			}
-			/* Post code */
-			fYec137_idx_save = vsize;
-			/* Vectorizable loop 201 */
-			/* Pre code */
-			fYec118_idx = (fYec118_idx + fYec118_idx_save) & 255;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec118[(i + fYec118_idx) & 255] = fYec117[(i + fYec117_idx) & 127] + fYec117[((i + fYec117_idx) - 32) & 127];
+			fYec76_idx_save = vsize;
+			fYec77_idx_save = vsize;
+			fYec78_idx_save = vsize;
+			fYec79_idx_save = vsize;
+			fYec80_idx_save = vsize;
+			fYec81_idx_save = vsize;
+			fYec82_idx_save = vsize;
+			fYec83_idx_save = vsize;
+			fYec84_idx_save = vsize;
+			fYec85_idx_save = vsize;
+			fYec86_idx_save = vsize;
+			fYec87_idx_save = vsize;
+			fYec88_idx_save = vsize;
+			for (int j187 = 0; j187 < 4; j187 = j187 + 1) {
+				fYec71_perm[j187] = fYec71_tmp[vsize + j187];
 			}
-			/* Post code */
-			fYec118_idx_save = vsize;
-			/* Vectorizable loop 202 */
-			/* Pre code */
-			fYec138_idx = (fYec138_idx + fYec138_idx_save) & 255;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec138[(i + fYec138_idx) & 255] = fYec137[(i + fYec137_idx) & 127] + fYec137[((i + fYec137_idx) - 32) & 127];
+			for (int j181 = 0; j181 < 4; j181 = j181 + 1) {
+				fYec70_perm[j181] = fYec70_tmp[vsize + j181];
 			}
-			/* Post code */
-			fYec138_idx_save = vsize;
-			/* Vectorizable loop 203 */
-			/* Pre code */
-			fYec119_idx = (fYec119_idx + fYec119_idx_save) & 511;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec119[(i + fYec119_idx) & 511] = fYec118[(i + fYec118_idx) & 255] + fYec118[((i + fYec118_idx) - 64) & 255];
+			for (int j183 = 0; j183 < 4; j183 = j183 + 1) {
+				fRec78_perm[j183] = fRec78_tmp[vsize + j183];
 			}
-			/* Post code */
-			fYec119_idx_save = vsize;
-			/* Vectorizable loop 204 */
-			/* Pre code */
-			fYec139_idx = (fYec139_idx + fYec139_idx_save) & 511;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec139[(i + fYec139_idx) & 511] = fYec138[(i + fYec138_idx) & 255] + fYec138[((i + fYec138_idx) - 64) & 255];
+			for (int j185 = 0; j185 < 4; j185 = j185 + 1) {
+				fRec77_perm[j185] = fRec77_tmp[vsize + j185];
 			}
-			/* Post code */
-			fYec139_idx_save = vsize;
-			/* Vectorizable loop 205 */
-			/* Pre code */
-			fYec120_idx = (fYec120_idx + fYec120_idx_save) & 1023;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec120[(i + fYec120_idx) & 1023] = fYec119[(i + fYec119_idx) & 511] + fYec119[((i + fYec119_idx) - 128) & 511];
+			for (int j189 = 0; j189 < 4; j189 = j189 + 1) {
+				fRec76_perm[j189] = fRec76_tmp[vsize + j189];
 			}
-			/* Post code */
-			fYec120_idx_save = vsize;
-			/* Vectorizable loop 206 */
-			/* Pre code */
-			fYec140_idx = (fYec140_idx + fYec140_idx_save) & 1023;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec140[(i + fYec140_idx) & 1023] = fYec139[(i + fYec139_idx) & 511] + fYec139[((i + fYec139_idx) - 128) & 511];
+			for (int j191 = 0; j191 < 4; j191 = j191 + 1) {
+				fRec75_perm[j191] = fRec75_tmp[vsize + j191];
 			}
-			/* Post code */
-			fYec140_idx_save = vsize;
-			/* Vectorizable loop 207 */
-			/* Pre code */
-			fYec121_idx = (fYec121_idx + fYec121_idx_save) & 2047;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec121[(i + fYec121_idx) & 2047] = fYec120[(i + fYec120_idx) & 1023] + fYec120[((i + fYec120_idx) - 256) & 1023];
+			for (int j175 = 0; j175 < 4; j175 = j175 + 1) {
+				fYec69_perm[j175] = fYec69_tmp[vsize + j175];
 			}
-			/* Post code */
-			fYec121_idx_save = vsize;
-			/* Vectorizable loop 208 */
-			/* Pre code */
-			fYec141_idx = (fYec141_idx + fYec141_idx_save) & 2047;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec141[(i + fYec141_idx) & 2047] = fYec140[(i + fYec140_idx) & 1023] + fYec140[((i + fYec140_idx) - 256) & 1023];
+			for (int j169 = 0; j169 < 4; j169 = j169 + 1) {
+				fYec68_perm[j169] = fYec68_tmp[vsize + j169];
 			}
-			/* Post code */
-			fYec141_idx_save = vsize;
-			/* Vectorizable loop 209 */
-			/* Pre code */
-			fYec122_idx = (fYec122_idx + fYec122_idx_save) & 4095;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec122[(i + fYec122_idx) & 4095] = fYec121[(i + fYec121_idx) & 2047] + fYec121[((i + fYec121_idx) - 512) & 2047];
+			for (int j171 = 0; j171 < 4; j171 = j171 + 1) {
+				fRec74_perm[j171] = fRec74_tmp[vsize + j171];
 			}
-			/* Post code */
-			fYec122_idx_save = vsize;
-			/* Vectorizable loop 210 */
-			/* Pre code */
-			fYec142_idx = (fYec142_idx + fYec142_idx_save) & 4095;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec142[(i + fYec142_idx) & 4095] = fYec141[(i + fYec141_idx) & 2047] + fYec141[((i + fYec141_idx) - 512) & 2047];
+			for (int j173 = 0; j173 < 4; j173 = j173 + 1) {
+				fRec73_perm[j173] = fRec73_tmp[vsize + j173];
 			}
-			/* Post code */
-			fYec142_idx_save = vsize;
-			/* Vectorizable loop 211 */
-			/* Pre code */
-			fYec123_idx = (fYec123_idx + fYec123_idx_save) & 8191;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec123[(i + fYec123_idx) & 8191] = fYec122[(i + fYec122_idx) & 4095] + fYec122[((i + fYec122_idx) - 1024) & 4095];
+			for (int j177 = 0; j177 < 4; j177 = j177 + 1) {
+				fRec72_perm[j177] = fRec72_tmp[vsize + j177];
 			}
-			/* Post code */
-			fYec123_idx_save = vsize;
-			/* Vectorizable loop 212 */
-			/* Pre code */
-			fYec143_idx = (fYec143_idx + fYec143_idx_save) & 8191;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec143[(i + fYec143_idx) & 8191] = fYec142[(i + fYec142_idx) & 4095] + fYec142[((i + fYec142_idx) - 1024) & 4095];
+			for (int j179 = 0; j179 < 4; j179 = j179 + 1) {
+				fRec71_perm[j179] = fRec71_tmp[vsize + j179];
 			}
-			/* Post code */
-			fYec143_idx_save = vsize;
-			/* Vectorizable loop 213 */
-			/* Pre code */
-			fYec124_idx = (fYec124_idx + fYec124_idx_save) & 16383;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec124[(i + fYec124_idx) & 16383] = fYec123[(i + fYec123_idx) & 8191] + fYec123[((i + fYec123_idx) - 2048) & 8191];
+			for (int j209 = 0; j209 < 4; j209 = j209 + 1) {
+				fRec10_perm[j209] = fRec10_tmp[vsize + j209];
 			}
-			/* Post code */
-			fYec124_idx_save = vsize;
-			/* Vectorizable loop 214 */
-			/* Pre code */
-			fYec144_idx = (fYec144_idx + fYec144_idx_save) & 16383;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec144[(i + fYec144_idx) & 16383] = fYec143[(i + fYec143_idx) & 8191] + fYec143[((i + fYec143_idx) - 2048) & 8191];
+			for (int j807 = 0; j807 < 4; j807 = j807 + 1) {
+				fRec621_perm[j807] = fRec621_tmp[vsize + j807];
 			}
-			/* Post code */
-			fYec144_idx_save = vsize;
-			/* Vectorizable loop 215 */
-			/* Pre code */
-			fYec125_idx = (fYec125_idx + fYec125_idx_save) & 32767;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec125[(i + fYec125_idx) & 32767] = fYec124[(i + fYec124_idx) & 16383] + fYec124[((i + fYec124_idx) - 4096) & 16383];
+			for (int j211 = 0; j211 < 4; j211 = j211 + 1) {
+				fRec9_perm[j211] = fRec9_tmp[vsize + j211];
 			}
-			/* Post code */
-			fYec125_idx_save = vsize;
-			/* Vectorizable loop 216 */
-			/* Pre code */
-			fYec145_idx = (fYec145_idx + fYec145_idx_save) & 32767;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec145[(i + fYec145_idx) & 32767] = fYec144[(i + fYec144_idx) & 16383] + fYec144[((i + fYec144_idx) - 4096) & 16383];
+			for (int j737 = 0; j737 < 4; j737 = j737 + 1) {
+				fRec5_perm[j737] = fRec5_tmp[vsize + j737];
 			}
-			/* Post code */
-			fYec145_idx_save = vsize;
-			/* Vectorizable loop 217 */
-			/* Pre code */
-			fYec126_idx = (fYec126_idx + fYec126_idx_save) & 65535;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec126[(i + fYec126_idx) & 65535] = fYec125[(i + fYec125_idx) & 32767] + fYec125[((i + fYec125_idx) - 8192) & 32767];
+			for (int j739 = 0; j739 < 4; j739 = j739 + 1) {
+				fRec6_perm[j739] = fRec6_tmp[vsize + j739];
 			}
-			/* Post code */
-			fYec126_idx_save = vsize;
-			/* Vectorizable loop 218 */
-			/* Pre code */
-			fYec146_idx = (fYec146_idx + fYec146_idx_save) & 65535;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec146[(i + fYec146_idx) & 65535] = fYec145[(i + fYec145_idx) & 32767] + fYec145[((i + fYec145_idx) - 8192) & 32767];
+			for (int j751 = 0; j751 < 4; j751 = j751 + 1) {
+				fRec3_perm[j751] = fRec3_tmp[vsize + j751];
 			}
-			/* Post code */
-			fYec146_idx_save = vsize;
-			/* Vectorizable loop 219 */
-			/* Pre code */
-			fYec127_idx = (fYec127_idx + fYec127_idx_save) & 131071;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec127[(i + fYec127_idx) & 131071] = fYec126[(i + fYec126_idx) & 65535] + fYec126[((i + fYec126_idx) - 16384) & 65535];
+			for (int j753 = 0; j753 < 4; j753 = j753 + 1) {
+				fRec4_perm[j753] = fRec4_tmp[vsize + j753];
 			}
-			/* Post code */
-			fYec127_idx_save = vsize;
-			/* Vectorizable loop 220 */
-			/* Pre code */
-			fYec147_idx = (fYec147_idx + fYec147_idx_save) & 131071;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec147[(i + fYec147_idx) & 131071] = fYec146[(i + fYec146_idx) & 65535] + fYec146[((i + fYec146_idx) - 16384) & 65535];
+			for (int j755 = 0; j755 < 4; j755 = j755 + 1) {
+				fRec1_perm[j755] = fRec1_tmp[vsize + j755];
 			}
-			/* Post code */
-			fYec147_idx_save = vsize;
-			/* Vectorizable loop 221 */
-			/* Pre code */
-			fYec128_idx = (fYec128_idx + fYec128_idx_save) & 262143;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec128[(i + fYec128_idx) & 262143] = fYec127[(i + fYec127_idx) & 131071] + fYec127[((i + fYec127_idx) - 32768) & 131071];
+			for (int j757 = 0; j757 < 4; j757 = j757 + 1) {
+				fRec2_perm[j757] = fRec2_tmp[vsize + j757];
 			}
-			/* Post code */
-			fYec128_idx_save = vsize;
-			/* Vectorizable loop 222 */
-			/* Pre code */
-			fYec148_idx = (fYec148_idx + fYec148_idx_save) & 262143;
+			/* Vectorizable loop 138 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec148[(i + fYec148_idx) & 262143] = fYec147[(i + fYec147_idx) & 131071] + fYec147[((i + fYec147_idx) - 32768) & 131071];
+				fZec799[i] = 1.0f - fRec0[i];
 			}
-			/* Post code */
-			fYec148_idx_save = vsize;
-			/* Vectorizable loop 223 */
+			/* Vectorizable loop 139 */
 			/* Pre code */
-			fYec129_idx = (fYec129_idx + fYec129_idx_save) & 524287;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec129[(i + fYec129_idx) & 524287] = fYec128[(i + fYec128_idx) & 262143] + fYec128[((i + fYec128_idx) - 65536) & 262143];
+			for (int j758 = 0; j758 < 4; j758 = j758 + 1) {
+				fYec106_tmp[j758] = fYec106_perm[j758];
 			}
-			/* Post code */
-			fYec129_idx_save = vsize;
-			/* Vectorizable loop 224 */
-			/* Pre code */
-			fYec149_idx = (fYec149_idx + fYec149_idx_save) & 524287;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec149[(i + fYec149_idx) & 524287] = fYec148[(i + fYec148_idx) & 262143] + fYec148[((i + fYec148_idx) - 65536) & 262143];
+				fYec106[i] = float(input0[i]) * fRec0[i] + fRec1[i] * fZec799[i];
 			}
 			/* Post code */
-			fYec149_idx_save = vsize;
-			/* Vectorizable loop 225 */
-			/* Pre code */
-			fYec130_idx = (fYec130_idx + fYec130_idx_save) & 1048575;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec130[(i + fYec130_idx) & 1048575] = fYec129[(i + fYec129_idx) & 524287] + fYec129[((i + fYec129_idx) - 131072) & 524287];
+			for (int j759 = 0; j759 < 4; j759 = j759 + 1) {
+				fYec106_perm[j759] = fYec106_tmp[vsize + j759];
 			}
-			/* Post code */
-			fYec130_idx_save = vsize;
-			/* Vectorizable loop 226 */
+			/* Vectorizable loop 140 */
 			/* Pre code */
-			fYec150_idx = (fYec150_idx + fYec150_idx_save) & 1048575;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec150[(i + fYec150_idx) & 1048575] = fYec149[(i + fYec149_idx) & 524287] + fYec149[((i + fYec149_idx) - 131072) & 524287];
+			for (int j774 = 0; j774 < 4; j774 = j774 + 1) {
+				fYec109_tmp[j774] = fYec109_perm[j774];
 			}
-			/* Post code */
-			fYec150_idx_save = vsize;
-			/* Vectorizable loop 227 */
-			/* Pre code */
-			fYec131_idx = (fYec131_idx + fYec131_idx_save) & 2097151;
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				fYec131[(i + fYec131_idx) & 2097151] = fYec130[(i + fYec130_idx) & 1048575] + fYec130[((i + fYec130_idx) - 262144) & 1048575];
+				fYec109[i] = float(input1[i]) * fRec0[i] + fRec2[i] * fZec799[i];
 			}
 			/* Post code */
-			fYec131_idx_save = vsize;
-			/* Vectorizable loop 228 */
-			/* Pre code */
-			fYec151_idx = (fYec151_idx + fYec151_idx_save) & 2097151;
-			/* Compute code */
-			for (int i = 0; i < vsize; i = i + 1) {
-				fYec151[(i + fYec151_idx) & 2097151] = fYec150[(i + fYec150_idx) & 1048575] + fYec150[((i + fYec150_idx) - 262144) & 1048575];
+			for (int j775 = 0; j775 < 4; j775 = j775 + 1) {
+				fYec109_perm[j775] = fYec109_tmp[vsize + j775];
 			}
-			/* Post code */
-			fYec151_idx_save = vsize;
-			/* Vectorizable loop 229 */
+			/* Vectorizable loop 141 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
-				float fElse206 = fYec131[((i + fYec131_idx) - iConst61) & 2097151];
-				float fElse207 = fYec130[((i + fYec130_idx) - iConst63) & 1048575];
-				float fElse208 = fYec129[((i + fYec129_idx) - iConst65) & 524287];
-				float fElse209 = fYec128[((i + fYec128_idx) - iConst67) & 262143];
-				float fElse210 = fYec127[((i + fYec127_idx) - iConst69) & 131071];
-				float fElse211 = fYec126[((i + fYec126_idx) - iConst71) & 65535];
-				float fElse212 = fYec125[((i + fYec125_idx) - iConst73) & 32767];
-				float fElse213 = fYec124[((i + fYec124_idx) - iConst75) & 16383];
-				float fElse214 = fYec123[((i + fYec123_idx) - iConst77) & 8191];
-				float fElse215 = fYec122[((i + fYec122_idx) - iConst79) & 4095];
-				float fElse216 = fYec121[((i + fYec121_idx) - iConst81) & 2047];
-				float fElse217 = fYec120[((i + fYec120_idx) - iConst83) & 1023];
-				float fElse218 = fYec119[((i + fYec119_idx) - iConst85) & 511];
-				float fElse219 = fYec118[((i + fYec118_idx) - iConst87) & 255];
-				float fElse220 = fYec117[((i + fYec117_idx) - iConst89) & 127];
-				float fElse221 = fYec116[((i + fYec116_idx) - iConst91) & 63];
-				float fElse222 = fYec115[i - iConst93];
-				float fElse223 = fYec114[i - iConst95];
-				float fElse224 = fYec112[i];
-				float fElse225 = fYec113[i - iConst96];
-				float fElse226 = fYec151[((i + fYec151_idx) - iConst61) & 2097151];
-				float fElse227 = fYec150[((i + fYec150_idx) - iConst63) & 1048575];
-				float fElse228 = fYec149[((i + fYec149_idx) - iConst65) & 524287];
-				float fElse229 = fYec148[((i + fYec148_idx) - iConst67) & 262143];
-				float fElse230 = fYec147[((i + fYec147_idx) - iConst69) & 131071];
-				float fElse231 = fYec146[((i + fYec146_idx) - iConst71) & 65535];
-				float fElse232 = fYec145[((i + fYec145_idx) - iConst73) & 32767];
-				float fElse233 = fYec144[((i + fYec144_idx) - iConst75) & 16383];
-				float fElse234 = fYec143[((i + fYec143_idx) - iConst77) & 8191];
-				float fElse235 = fYec142[((i + fYec142_idx) - iConst79) & 4095];
-				float fElse236 = fYec141[((i + fYec141_idx) - iConst81) & 2047];
-				float fElse237 = fYec140[((i + fYec140_idx) - iConst83) & 1023];
-				float fElse238 = fYec139[((i + fYec139_idx) - iConst85) & 511];
-				float fElse239 = fYec138[((i + fYec138_idx) - iConst87) & 255];
-				float fElse240 = fYec137[((i + fYec137_idx) - iConst89) & 127];
-				float fElse241 = fYec136[((i + fYec136_idx) - iConst91) & 63];
-				float fElse242 = fYec135[i - iConst93];
-				float fElse243 = fYec134[i - iConst95];
-				float fElse244 = fYec132[i];
-				float fElse245 = fYec133[i - iConst96];
-				fVbargraph27 = FAUSTFLOAT(4.34294462f * std::log(std::max<float>(9.99999996e-13f, fConst23 * (((iConst24) ? fElse206 : 0.0f) + ((iConst62) ? fElse207 : 0.0f) + ((iConst64) ? fElse208 : 0.0f) + ((iConst66) ? fElse209 : 0.0f) + ((iConst68) ? fElse210 : 0.0f) + ((iConst70) ? fElse211 : 0.0f) + ((iConst72) ? fElse212 : 0.0f) + ((iConst74) ? fElse213 : 0.0f) + ((iConst76) ? fElse214 : 0.0f) + ((iConst78) ? fElse215 : 0.0f) + ((iConst80) ? fElse216 : 0.0f) + ((iConst82) ? fElse217 : 0.0f) + ((iConst84) ? fElse218 : 0.0f) + ((iConst86) ? fElse219 : 0.0f) + ((iConst88) ? fElse220 : 0.0f) + ((iConst90) ? fElse221 : 0.0f) + ((iConst92) ? fElse222 : 0.0f) + ((iConst94) ? fElse223 : 0.0f) + ((iConst96) ? fElse224 : 0.0f) + ((iConst97) ? fElse225 : 0.0f) + ((iConst24) ? fElse226 : 0.0f) + ((iConst62) ? fElse227 : 0.0f) + ((iConst64) ? fElse228 : 0.0f) + ((iConst66) ? fElse229 : 0.0f) + ((iConst68) ? fElse230 : 0.0f) + ((iConst70) ? fElse231 : 0.0f) + ((iConst72) ? fElse232 : 0.0f) + ((iConst74) ? fElse233 : 0.0f) + ((iConst76) ? fElse234 : 0.0f) + ((iConst78) ? fElse235 : 0.0f) + ((iConst80) ? fElse236 : 0.0f) + ((iConst82) ? fElse237 : 0.0f) + ((iConst84) ? fElse238 : 0.0f) + ((iConst86) ? fElse239 : 0.0f) + ((iConst88) ? fElse240 : 0.0f) + ((iConst90) ? fElse241 : 0.0f) + ((iConst92) ? fElse242 : 0.0f) + ((iConst94) ? fElse243 : 0.0f) + ((iConst96) ? fElse244 : 0.0f) + ((iConst97) ? fElse245 : 0.0f)))) + -0.690999985f);
 				fZec800[i] = fYec109[i];
 			}
-			/* Recursive loop 230 */
+			/* Recursive loop 142 */
 			/* Pre code */
 			for (int j760 = 0; j760 < 4; j760 = j760 + 1) {
 				fRec602_tmp[j760] = fRec602_perm[j760];
@@ -11576,7 +9846,7 @@ class mydsp : public dsp {
 			for (int j761 = 0; j761 < 4; j761 = j761 + 1) {
 				fRec602_perm[j761] = fRec602_tmp[vsize + j761];
 			}
-			/* Recursive loop 231 */
+			/* Recursive loop 143 */
 			/* Pre code */
 			for (int j804 = 0; j804 < 4; j804 = j804 + 1) {
 				fRec611_tmp[j804] = fRec611_perm[j804];
@@ -11589,13 +9859,13 @@ class mydsp : public dsp {
 			for (int j805 = 0; j805 < 4; j805 = j805 + 1) {
 				fRec611_perm[j805] = fRec611_tmp[vsize + j805];
 			}
-			/* Vectorizable loop 232 */
+			/* Vectorizable loop 144 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fVbargraph26 = FAUSTFLOAT(fRec602[i]);
 				output0[i] = FAUSTFLOAT(fYec106[i]);
 			}
-			/* Vectorizable loop 233 */
+			/* Vectorizable loop 145 */
 			/* Compute code */
 			for (int i = 0; i < vsize; i = i + 1) {
 				fVbargraph28 = FAUSTFLOAT(fRec611[i]);
@@ -11620,10 +9890,205 @@ START_NAMESPACE_DISTRHO
 
 // --------------------------------------------------------------------------------------------------------------------
 
+/**
+   Get the dsp variable of a parameter, or null if the index is invalid.
+   Allows using mydsp directly without the plugin class, as done by the offline renderer (see bench/render.cpp).
+ */
+static inline FAUSTFLOAT* getFaustParameterZone(mydsp* const dsp, const uint32_t index) noexcept
+{
+    switch (index)
+    {
+    case kParameter_global_bypass:
+        return &dsp->fCheckbox0;
+    case kParameter_target:
+        return &dsp->fVslider14;
+    case kParameter_in_gain:
+        return &dsp->fVslider0;
+    case kParameter_phase_l:
+        return &dsp->fCheckbox8;
+    case kParameter_phase_r:
+        return &dsp->fCheckbox9;
+    case kParameter_mono:
+        return &dsp->fCheckbox6;
+    case kParameter_dc_blocker:
+        return &dsp->fCheckbox7;
+    case kParameter_stereo_correct:
+        return &dsp->fCheckbox5;
+    case kParameter_gate_bypass:
+        return &dsp->fCheckbox4;
+    case kParameter_gate_threshold:
+        return &dsp->fVslider4;
+    case kParameter_gate_attack:
+        return &dsp->fVslider1;
+    case kParameter_gate_hold:
+        return &dsp->fVslider3;
+    case kParameter_gate_release:
+        return &dsp->fVslider2;
+    case kParameter_eq_bypass:
+        return &dsp->fCheckbox3;
+    case kParameter_eq_highpass_freq:
+        return &dsp->fVslider5;
+    case kParameter_eq_tilt_gain:
+        return &dsp->fVslider6;
+    case kParameter_eq_side_gain:
+        return &dsp->fVslider7;
+    case kParameter_eq_side_freq:
+        return &dsp->fVslider8;
+    case kParameter_eq_side_bandwidth:
+        return &dsp->fVslider9;
+    case kParameter_leveler_bypass:
+        return &dsp->fCheckbox2;
+    case kParameter_leveler_speed:
+        return &dsp->fVslider11;
+    case kParameter_leveler_brake_threshold:
+        return &dsp->fVslider10;
+    case kParameter_leveler_max_plus:
+        return &dsp->fVslider13;
+    case kParameter_leveler_max_minus:
+        return &dsp->fVslider12;
+    case kParameter_kneecomp_bypass:
+        return &dsp->fCheckbox10;
+    case kParameter_kneecomp_strength:
+        return &dsp->fVslider21;
+    case kParameter_kneecomp_threshold:
+        return &dsp->fVslider22;
+    case kParameter_kneecomp_attack:
+        return &dsp->fVslider19;
+    case kParameter_kneecomp_release:
+        return &dsp->fVslider18;
+    case kParameter_kneecomp_knee:
+        return &dsp->fVslider23;
+    case kParameter_kneecomp_link:
+        return &dsp->fVslider24;
+    case kParameter_kneecomp_fffb:
+        return &dsp->fVslider17;
+    case kParameter_kneecomp_makeup:
+        return &dsp->fVslider16;
+    case kParameter_kneecomp_drywet:
+        return &dsp->fVslider15;
+    case kParameter_mscomp_bypass:
+        return &dsp->fCheckbox1;
+    case kParameter_mscomp_low_strength:
+        return &dsp->fVslider27;
+    case kParameter_mscomp_low_threshold:
+        return &dsp->fVslider35;
+    case kParameter_mscomp_low_attack:
+        return &dsp->fVslider31;
+    case kParameter_mscomp_low_release:
+        return &dsp->fVslider33;
+    case kParameter_mscomp_low_knee:
+        return &dsp->fVslider36;
+    case kParameter_mscomp_low_link:
+        return &dsp->fVslider37;
+    case kParameter_mscomp_low_crossover:
+        return &dsp->fVslider25;
+    case kParameter_mscomp_high_strength:
+        return &dsp->fVslider28;
+    case kParameter_mscomp_high_threshold:
+        return &dsp->fVslider29;
+    case kParameter_mscomp_high_attack:
+        return &dsp->fVslider32;
+    case kParameter_mscomp_high_release:
+        return &dsp->fVslider34;
+    case kParameter_mscomp_high_knee:
+        return &dsp->fVslider30;
+    case kParameter_mscomp_high_link:
+        return &dsp->fVslider38;
+    case kParameter_mscomp_high_crossover:
+        return &dsp->fVslider26;
+    case kParameter_mscomp_output_gain:
+        return &dsp->fVslider20;
+    case kParameter_limiter_bypass:
+        return &dsp->fCheckbox11;
+    case kParameter_limiter_strength:
+        return &dsp->fVslider42;
+    case kParameter_limiter_threshold:
+        return &dsp->fVslider43;
+    case kParameter_limiter_attack:
+        return &dsp->fVslider41;
+    case kParameter_limiter_release:
+        return &dsp->fVslider40;
+    case kParameter_limiter_knee:
+        return &dsp->fVslider44;
+    case kParameter_limiter_fffb:
+        return &dsp->fVslider39;
+    case kParameter_limiter_makeup:
+        return &dsp->fVslider45;
+    case kParameter_brickwall_bypass:
+        return &dsp->fCheckbox12;
+    case kParameter_brickwall_ceiling:
+        return &dsp->fVslider47;
+    case kParameter_brickwall_release:
+        return &dsp->fVslider46;
+    case kParameter_peakmeter_in_l:
+        return &dsp->fVbargraph0;
+    case kParameter_peakmeter_in_r:
+        return &dsp->fVbargraph1;
+    case kParameter_lufs_in:
+        return &dsp->fVbargraph2;
+    case kParameter_leveler_gain:
+        return &dsp->fVbargraph5;
+    case kParameter_lufs_out:
+        return &dsp->fVbargraph27;
+    case kParameter_peakmeter_out_l:
+        return &dsp->fVbargraph26;
+    case kParameter_peakmeter_out_r:
+        return &dsp->fVbargraph28;
+    case kParameter_gate_meter:
+        return &dsp->fVbargraph3;
+    case kParameter_leveler_brake:
+        return &dsp->fVbargraph4;
+    case kParameter_kneecomp_meter_0:
+        return &dsp->fVbargraph6;
+    case kParameter_kneecomp_meter_1:
+        return &dsp->fVbargraph7;
+    case kParameter_msredux11:
+        return &dsp->fVbargraph8;
+    case kParameter_msredux12:
+        return &dsp->fVbargraph16;
+    case kParameter_msredux21:
+        return &dsp->fVbargraph9;
+    case kParameter_msredux22:
+        return &dsp->fVbargraph17;
+    case kParameter_msredux31:
+        return &dsp->fVbargraph10;
+    case kParameter_msredux32:
+        return &dsp->fVbargraph18;
+    case kParameter_msredux41:
+        return &dsp->fVbargraph11;
+    case kParameter_msredux42:
+        return &dsp->fVbargraph19;
+    case kParameter_msredux51:
+        return &dsp->fVbargraph12;
+    case kParameter_msredux52:
+        return &dsp->fVbargraph20;
+    case kParameter_msredux61:
+        return &dsp->fVbargraph13;
+    case kParameter_msredux62:
+        return &dsp->fVbargraph21;
+    case kParameter_msredux71:
+        return &dsp->fVbargraph14;
+    case kParameter_msredux72:
+        return &dsp->fVbargraph22;
+    case kParameter_msredux81:
+        return &dsp->fVbargraph15;
+    case kParameter_msredux82:
+        return &dsp->fVbargraph23;
+    case kParameter_limiter_gain_reduction:
+        return &dsp->fVbargraph24;
+    case kParameter_brickwall_limit:
+        return &dsp->fVbargraph25;
+    default:
+        return nullptr;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 class FaustGeneratedPlugin : public Plugin
 {
 protected:
-    ScopedPointer<mydsp> dsp;
+    std::unique_ptr<mydsp, FaustDspDeleter<mydsp>> dsp;
 
 public:
     FaustGeneratedPlugin(const uint32_t extraParameters = 0,
@@ -11631,8 +10096,9 @@ public:
                          const uint32_t extraStates = 0)
         : Plugin(kParameterCount + extraParameters, kProgramCount + extraPrograms, kStateCount + extraStates)
     {
-        dsp = new mydsp;
-        dsp->init(getSampleRate());
+        // zeroed on demand, see createFaustDsp
+        dsp.reset(createFaustDsp<mydsp>(getSampleRate()));
+        DISTRHO_SAFE_ASSERT_RETURN(dsp != nullptr,);
 
         // passive controls are only updated on first run, make sure they have valid values now
         dsp->fVbargraph0 = 0;
@@ -13600,138 +12066,106 @@ protected:
 
     void sampleRateChanged(const double newSampleRate) override
     {
-        // retrieve parameter info first
-        float params[61] = {
-            dsp->fCheckbox0,
-            dsp->fVslider14,
-            dsp->fVslider0,
-            dsp->fCheckbox8,
-            dsp->fCheckbox9,
-            dsp->fCheckbox6,
-            dsp->fCheckbox7,
-            dsp->fCheckbox5,
-            dsp->fCheckbox4,
-            dsp->fVslider4,
-            dsp->fVslider1,
-            dsp->fVslider3,
-            dsp->fVslider2,
-            dsp->fCheckbox3,
-            dsp->fVslider5,
-            dsp->fVslider6,
-            dsp->fVslider7,
-            dsp->fVslider8,
-            dsp->fVslider9,
-            dsp->fCheckbox2,
-            dsp->fVslider11,
-            dsp->fVslider10,
-            dsp->fVslider13,
-            dsp->fVslider12,
-            dsp->fCheckbox10,
-            dsp->fVslider21,
-            dsp->fVslider22,
-            dsp->fVslider19,
-            dsp->fVslider18,
-            dsp->fVslider23,
-            dsp->fVslider24,
-            dsp->fVslider17,
-            dsp->fVslider16,
-            dsp->fVslider15,
-            dsp->fCheckbox1,
-            dsp->fVslider27,
-            dsp->fVslider35,
-            dsp->fVslider31,
-            dsp->fVslider33,
-            dsp->fVslider36,
-            dsp->fVslider37,
-            dsp->fVslider25,
-            dsp->fVslider28,
-            dsp->fVslider29,
-            dsp->fVslider32,
-            dsp->fVslider34,
-            dsp->fVslider30,
-            dsp->fVslider38,
-            dsp->fVslider26,
-            dsp->fVslider20,
-            dsp->fCheckbox11,
-            dsp->fVslider42,
-            dsp->fVslider43,
-            dsp->fVslider41,
-            dsp->fVslider40,
-            dsp->fVslider44,
-            dsp->fVslider39,
-            dsp->fVslider45,
-            dsp->fCheckbox12,
-            dsp->fVslider47,
-            dsp->fVslider46,
-            
-        };
-
-        // tell dsp to change sample rate
-        dsp->init(newSampleRate);
+        // a new dsp instance is cheaper than clearing the current one, its state starts zeroed on demand
+        mydsp* const newDsp = createFaustDsp<mydsp>(newSampleRate);
+        DISTRHO_SAFE_ASSERT_RETURN(newDsp != nullptr,);
 
-        // set parameters back, which have been reset in the dsp
-        dsp->fCheckbox0 = params[0];
-        dsp->fVslider14 = params[1];
-        dsp->fVslider0 = params[2];
-        dsp->fCheckbox8 = params[3];
-        dsp->fCheckbox9 = params[4];
-        dsp->fCheckbox6 = params[5];
-        dsp->fCheckbox7 = params[6];
-        dsp->fCheckbox5 = params[7];
-        dsp->fCheckbox4 = params[8];
-        dsp->fVslider4 = params[9];
-        dsp->fVslider1 = params[10];
-        dsp->fVslider3 = params[11];
-        dsp->fVslider2 = params[12];
-        dsp->fCheckbox3 = params[13];
-        dsp->fVslider5 = params[14];
-        dsp->fVslider6 = params[15];
-        dsp->fVslider7 = params[16];
-        dsp->fVslider8 = params[17];
-        dsp->fVslider9 = params[18];
-        dsp->fCheckbox2 = params[19];
-        dsp->fVslider11 = params[20];
-        dsp->fVslider10 = params[21];
-        dsp->fVslider13 = params[22];
-        dsp->fVslider12 = params[23];
-        dsp->fCheckbox10 = params[24];
-        dsp->fVslider21 = params[25];
-        dsp->fVslider22 = params[26];
-        dsp->fVslider19 = params[27];
-        dsp->fVslider18 = params[28];
-        dsp->fVslider23 = params[29];
-        dsp->fVslider24 = params[30];
-        dsp->fVslider17 = params[31];
-        dsp->fVslider16 = params[32];
-        dsp->fVslider15 = params[33];
-        dsp->fCheckbox1 = params[34];
-        dsp->fVslider27 = params[35];
-        dsp->fVslider35 = params[36];
-        dsp->fVslider31 = params[37];
-        dsp->fVslider33 = params[38];
-        dsp->fVslider36 = params[39];
-        dsp->fVslider37 = params[40];
-        dsp->fVslider25 = params[41];
-        dsp->fVslider28 = params[42];
-        dsp->fVslider29 = params[43];
-        dsp->fVslider32 = params[44];
-        dsp->fVslider34 = params[45];
-        dsp->fVslider30 = params[46];
-        dsp->fVslider38 = params[47];
-        dsp->fVslider26 = params[48];
-        dsp->fVslider20 = params[49];
-        dsp->fCheckbox11 = params[50];
-        dsp->fVslider42 = params[51];
-        dsp->fVslider43 = params[52];
-        dsp->fVslider41 = params[53];
-        dsp->fVslider40 = params[54];
-        dsp->fVslider44 = params[55];
-        dsp->fVslider39 = params[56];
-        dsp->fVslider45 = params[57];
-        dsp->fCheckbox12 = params[58];
-        dsp->fVslider47 = params[59];
-        dsp->fVslider46 = params[60];
+        // set parameters on the new dsp, which starts with defaults
+        newDsp->fCheckbox0 = dsp->fCheckbox0;
+        newDsp->fVslider14 = dsp->fVslider14;
+        newDsp->fVslider0 = dsp->fVslider0;
+        newDsp->fCheckbox8 = dsp->fCheckbox8;
+        newDsp->fCheckbox9 = dsp->fCheckbox9;
+        newDsp->fCheckbox6 = dsp->fCheckbox6;
+        newDsp->fCheckbox7 = dsp->fCheckbox7;
+        newDsp->fCheckbox5 = dsp->fCheckbox5;
+        newDsp->fCheckbox4 = dsp->fCheckbox4;
+        newDsp->fVslider4 = dsp->fVslider4;
+        newDsp->fVslider1 = dsp->fVslider1;
+        newDsp->fVslider3 = dsp->fVslider3;
+        newDsp->fVslider2 = dsp->fVslider2;
+        newDsp->fCheckbox3 = dsp->fCheckbox3;
+        newDsp->fVslider5 = dsp->fVslider5;
+        newDsp->fVslider6 = dsp->fVslider6;
+        newDsp->fVslider7 = dsp->fVslider7;
+        newDsp->fVslider8 = dsp->fVslider8;
+        newDsp->fVslider9 = dsp->fVslider9;
+        newDsp->fCheckbox2 = dsp->fCheckbox2;
+        newDsp->fVslider11 = dsp->fVslider11;
+        newDsp->fVslider10 = dsp->fVslider10;
+        newDsp->fVslider13 = dsp->fVslider13;
+        newDsp->fVslider12 = dsp->fVslider12;
+        newDsp->fCheckbox10 = dsp->fCheckbox10;
+        newDsp->fVslider21 = dsp->fVslider21;
+        newDsp->fVslider22 = dsp->fVslider22;
+        newDsp->fVslider19 = dsp->fVslider19;
+        newDsp->fVslider18 = dsp->fVslider18;
+        newDsp->fVslider23 = dsp->fVslider23;
+        newDsp->fVslider24 = dsp->fVslider24;
+        newDsp->fVslider17 = dsp->fVslider17;
+        newDsp->fVslider16 = dsp->fVslider16;
+        newDsp->fVslider15 = dsp->fVslider15;
+        newDsp->fCheckbox1 = dsp->fCheckbox1;
+        newDsp->fVslider27 = dsp->fVslider27;
+        newDsp->fVslider35 = dsp->fVslider35;
+        newDsp->fVslider31 = dsp->fVslider31;
+        newDsp->fVslider33 = dsp->fVslider33;
+        newDsp->fVslider36 = dsp->fVslider36;
+        newDsp->fVslider37 = dsp->fVslider37;
+        newDsp->fVslider25 = dsp->fVslider25;
+        newDsp->fVslider28 = dsp->fVslider28;
+        newDsp->fVslider29 = dsp->fVslider29;
+        newDsp->fVslider32 = dsp->fVslider32;
+        newDsp->fVslider34 = dsp->fVslider34;
+        newDsp->fVslider30 = dsp->fVslider30;
+        newDsp->fVslider38 = dsp->fVslider38;
+        newDsp->fVslider26 = dsp->fVslider26;
+        newDsp->fVslider20 = dsp->fVslider20;
+        newDsp->fCheckbox11 = dsp->fCheckbox11;
+        newDsp->fVslider42 = dsp->fVslider42;
+        newDsp->fVslider43 = dsp->fVslider43;
+        newDsp->fVslider41 = dsp->fVslider41;
+        newDsp->fVslider40 = dsp->fVslider40;
+        newDsp->fVslider44 = dsp->fVslider44;
+        newDsp->fVslider39 = dsp->fVslider39;
+        newDsp->fVslider45 = dsp->fVslider45;
+        newDsp->fCheckbox12 = dsp->fCheckbox12;
+        newDsp->fVslider47 = dsp->fVslider47;
+        newDsp->fVslider46 = dsp->fVslider46;
         
+        // passive controls keep their last values until next run
+        newDsp->fVbargraph0 = dsp->fVbargraph0;
+        newDsp->fVbargraph1 = dsp->fVbargraph1;
+        newDsp->fVbargraph2 = dsp->fVbargraph2;
+        newDsp->fVbargraph5 = dsp->fVbargraph5;
+        newDsp->fVbargraph27 = dsp->fVbargraph27;
+        newDsp->fVbargraph26 = dsp->fVbargraph26;
+        newDsp->fVbargraph28 = dsp->fVbargraph28;
+        newDsp->fVbargraph3 = dsp->fVbargraph3;
+        newDsp->fVbargraph4 = dsp->fVbargraph4;
+        newDsp->fVbargraph6 = dsp->fVbargraph6;
+        newDsp->fVbargraph7 = dsp->fVbargraph7;
+        newDsp->fVbargraph8 = dsp->fVbargraph8;
+        newDsp->fVbargraph16 = dsp->fVbargraph16;
+        newDsp->fVbargraph9 = dsp->fVbargraph9;
+        newDsp->fVbargraph17 = dsp->fVbargraph17;
+        newDsp->fVbargraph10 = dsp->fVbargraph10;
+        newDsp->fVbargraph18 = dsp->fVbargraph18;
+        newDsp->fVbargraph11 = dsp->fVbargraph11;
+        newDsp->fVbargraph19 = dsp->fVbargraph19;
+        newDsp->fVbargraph12 = dsp->fVbargraph12;
+        newDsp->fVbargraph20 = dsp->fVbargraph20;
+        newDsp->fVbargraph13 = dsp->fVbargraph13;
+        newDsp->fVbargraph21 = dsp->fVbargraph21;
+        newDsp->fVbargraph14 = dsp->fVbargraph14;
+        newDsp->fVbargraph22 = dsp->fVbargraph22;
+        newDsp->fVbargraph15 = dsp->fVbargraph15;
+        newDsp->fVbargraph23 = dsp->fVbargraph23;
+        newDsp->fVbargraph24 = dsp->fVbargraph24;
+        newDsp->fVbargraph25 = dsp->fVbargraph25;
+        
+
+        dsp.reset(newDsp);
     }
 
     // ----------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,86 @@
+{% block HeaderDescription %}
+//------------------------------------------------------------------------------
+// This file was generated using the Faust compiler (https://faust.grame.fr),
+// and the Faust post-processor (https://github.com/jpcima/faustpp).
+//
+// Source: {{file_name}}
+// Name: {{name}}
+// Description: {{description}}
+// Author: {{author}}
+// Copyright: {{copyright}}
+// License: {{license}}
+// Version: {{version}}
+//------------------------------------------------------------------------------
+{% endblock %}
+
+{% block HeaderPrologue %}
+{% if not (stage is defined) %}
+{{fail("`stage` is undefined.")}}
+{% endif %}
+{% endblock %}
+
+// One part of the master_me chain for the pipelined build, see pipeline/{{stage}}.dsp.
+// Must be included after Plugin.cpp, it reuses the faust declarations from there and maps its parameters to the full dsp.
+
+#pragma once
+
+// keep this stage mydsp apart from the full one
+#undef FAUSTPP_BEGIN_NAMESPACE
+#undef FAUSTPP_END_NAMESPACE
+#define FAUSTPP_BEGIN_NAMESPACE START_NAMESPACE_DISTRHO namespace pipeline_{{stage}} {
+#define FAUSTPP_END_NAMESPACE } END_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+{% block ImplementationFaustCode %}
+{{class_code}}
+{% endblock %}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+#undef FAUSTPP_BEGIN_NAMESPACE
+#undef FAUSTPP_END_NAMESPACE
+#define FAUSTPP_BEGIN_NAMESPACE START_NAMESPACE_DISTRHO
+#define FAUSTPP_END_NAMESPACE END_NAMESPACE_DISTRHO
+
+START_NAMESPACE_DISTRHO
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/**
+   Copy the current parameter values of the full dsp into this stage.
+   Parameters of the other stage are not touched.
+ */
+static inline void copyFaustControls(mydsp* const full, pipeline_{{stage}}::mydsp* const stage) noexcept
+{
+    {% for p in active %}stage->{{p.var}} = *getFaustParameterZone(full, kParameter_{{p.meta.symbol}});
+    {% endfor %}
+}
+
+/**
+   Copy the meter values of this stage into the full dsp, where the plugin reads them from.
+ */
+static inline void copyFaustMeters(pipeline_{{stage}}::mydsp* const stage, mydsp* const full) noexcept
+{
+    {% for p in passive %}*getFaustParameterZone(full, kParameter_{{p.meta.symbol}}) = stage->{{p.var}};
+    {% endfor %}
+}
+
+/**
+   Get the dsp variable of a parameter in this stage, or null if the parameter belongs to the other one.
+ */
+static inline FAUSTFLOAT* getFaustParameterZone(pipeline_{{stage}}::mydsp* const stage, const uint32_t index) noexcept
+{
+    switch (index)
+    {
+    {% for p in active + passive %}case kParameter_{{p.meta.symbol}}:
+        return &stage->{{p.var}};
+    {% endfor %}
+    default:
+        return nullptr;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+END_NAMESPACE_DISTRHO
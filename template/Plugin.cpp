@@ -14,7 +14,9 @@
 {% endblock %}
 
 #include "DistrhoPlugin.hpp"
-#include "extra/ScopedPointer.hpp"
+#include "utils/ZeroPages.hpp"
+
+#include <memory>
 
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -77,10 +79,28 @@ START_NAMESPACE_DISTRHO
 
 // --------------------------------------------------------------------------------------------------------------------
 
+/**
+   Get the dsp variable of a parameter, or null if the index is invalid.
+   Allows using mydsp directly without the plugin class, as done by the offline renderer (see bench/render.cpp).
+ */
+static inline FAUSTFLOAT* getFaustParameterZone(mydsp* const dsp, const uint32_t index) noexcept
+{
+    switch (index)
+    {
+    {% for p in active + passive %}case kParameter_{{p.meta.symbol|default("" ~ loop.index)}}:
+        return &dsp->{{p.var}};
+    {% endfor %}
+    default:
+        return nullptr;
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 class FaustGeneratedPlugin : public Plugin
 {
 protected:
-    ScopedPointer<mydsp> dsp;
+    std::unique_ptr<mydsp, FaustDspDeleter<mydsp>> dsp;
 
 public:
     FaustGeneratedPlugin(const uint32_t extraParameters = 0,
@@ -88,8 +108,9 @@ public:
                          const uint32_t extraStates = 0)
         : Plugin(kParameterCount + extraParameters, kProgramCount + extraPrograms, kStateCount + extraStates)
     {
-        dsp = new mydsp;
-        dsp->init(getSampleRate());
+        // zeroed on demand, see createFaustDsp
+        dsp.reset(createFaustDsp<mydsp>(getSampleRate()));
+        DISTRHO_SAFE_ASSERT_RETURN(dsp != nullptr,);
 
         // passive controls are only updated on first run, make sure they have valid values now
         {% for p in passive %}dsp->{{p.var}} = {{p.init}};
@@ -262,18 +283,18 @@ protected:
 
     void sampleRateChanged(const double newSampleRate) override
     {
-        // retrieve parameter info first
-        float params[{{ active|length }}] = {
-            {% for p in active %}dsp->{{p.var}},
-            {% endfor %}
-        };
-
-        // tell dsp to change sample rate
-        dsp->init(newSampleRate);
+        // a new dsp instance is cheaper than clearing the current one, its state starts zeroed on demand
+        mydsp* const newDsp = createFaustDsp<mydsp>(newSampleRate);
+        DISTRHO_SAFE_ASSERT_RETURN(newDsp != nullptr,);
 
-        // set parameters back, which have been reset in the dsp
-        {% for p in active %}dsp->{{p.var}} = params[{{ loop.index0 }}];
+        // set parameters on the new dsp, which starts with defaults
+        {% for p in active %}newDsp->{{p.var}} = dsp->{{p.var}};
         {% endfor %}
+        // passive controls keep their last values until next run
+        {% for p in passive %}newDsp->{{p.var}} = dsp->{{p.var}};
+        {% endfor %}
+
+        dsp.reset(newDsp);
     }
 
     // ----------------------------------------------------------------------------------------------------------------
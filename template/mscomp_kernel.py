@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+# Copyright 2022-2024 Filipe Coelho <falktx@falktx.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+# Post-processing of the faustpp output, run by `make pregen`: replaces the 16 gain computers of the 8-band mscomp
+# with plugin/dsp/MscompGainKernel.hpp, behind MASTER_ME_MSCOMP_KERNEL.
+#
+# The gain computers are spread over the single per-sample loop of the mscomp, each band followed by what uses
+# its gain. The statements using them are moved after the last one, so the kernel can run once per sample with
+# all 16 levels. With MASTER_ME_MSCOMP_KERNEL off, the result is the faust code in that order.
+# Every pattern is checked, anything unexpected in the faust output fails instead of producing wrong code.
+#
+# usage: mscomp_kernel.py <Plugin.cpp from faustpp> <output>
+
+import re, sys
+src, dst = sys.argv[1], sys.argv[2]
+L = open(src).read().split('\n')
+assert not any('MscompGainKernel' in l for l in L), 'already patched'
+
+first = next(n for n, l in enumerate(L) if 'mscomp_linear2db(std::fabs' in l)
+start = max(n for n in range(first) if re.search(r'for \(int i = 0; i < vsize', L[n]))
+depth = 0
+for n in range(start, len(L)):
+    depth += L[n].count('{') - L[n].count('}')
+    if depth == 0:
+        end = n
+        break
+body = L[start + 1:end]
+
+stmt_re = re.compile(r'^(\s*)(?:(float|int) )?(\w+)(\[[^=]*\])?\s*=\s*(.*);\s*$')
+idx_re = re.compile(r'(\w+)\[([^\[\]]*)\]')
+stmts = []
+for line in body:
+    m = stmt_re.match(line)
+    assert m, line
+    name, idx, rhs = m.group(3), m.group(4), m.group(5)
+    reads = set()
+    for a, i in idx_re.findall(rhs):
+        if i.strip() == 'i' or '_idx' in i:
+            reads.add(a)
+    # scalars without index
+    rhs_noidx = idx_re.sub('', rhs)
+    for w in re.findall(r'\b[a-zA-Z_]\w*\b', rhs_noidx):
+        reads.add(w)
+    ring = idx is not None and '_idx' in idx
+    stmts.append(dict(line=line, name=name, idx=idx, rhs=rhs, reads=reads, ring=ring))
+written = set(s['name'] for s in stmts)
+for s in stmts:
+    s['reads'] &= written
+
+# the 16 gain computer blocks, 9 statements each
+K = []
+for n, s in enumerate(stmts):
+    if s['rhs'].startswith('mscomp_linear2db(std::fabs'):
+        b = stmts[n:n + 9]
+        lv = b[0]['name']
+        m1 = re.fullmatch(r'\(%s\[i\] > (\w+)\) \+ \(%s\[i\] > (\w+)\)' % (lv, lv), b[1]['rhs'])
+        m2 = re.fullmatch(r'%s\[i\] - (\w+)' % lv, b[2]['rhs'])
+        m4 = re.fullmatch(r'(\w+) \* mydsp_faustpower2_f\((\w+) \+ %s\[i\]\)' % b[2]['name'], b[4]['rhs'])
+        m6 = re.fullmatch(r'0\.0f - (\w+) \* std::max<float>\(0\.0f, \(\(%s\[i\] == 0\) \? 0\.0f : %s\)\)' % (b[1]['name'], b[5]['name']), b[6]['rhs'])
+        st = b[8]['name']
+        m7 = re.fullmatch(r'\(\(%s\[i\] > %s\[i - 1\]\) \? (\w+) : (\w+)\)' % (b[6]['name'], st), b[7]['rhs'])
+        m8 = re.fullmatch(r'{g}\[i\] \* \(1\.0f - {c}\[i\]\) \+ {s}\[i - 1\] \* {c}\[i\]'.format(g=b[6]['name'], c=b[7]['name'], s=st), b[8]['rhs'])
+        assert b[3]['rhs'] == b[2]['name'] + '[i]'
+        assert b[5]['rhs'] == '((%s[i] == 1) ? %s : %s)' % (b[1]['name'], b[4]['name'], b[3]['name'])
+        assert all((m1, m2, m4, m6, m7, m8)), [x['line'] for x in b]
+        level = b[0]['rhs'][len('mscomp_linear2db('):-1]
+        K.append(dict(pos=n, state=st, level=level, levelname=lv,
+                      params=(m2.group(1), m4.group(2), m1.group(1), m1.group(2), m4.group(1), m6.group(1), m7.group(1), m7.group(2))))
+assert len(K) == 16
+kpos = set(k['pos'] + j for k in K for j in range(9))
+states = set(k['state'] for k in K)
+internal = set(stmts[p]['name'] for p in kpos)
+
+# statements depending on the gain computers in the same sample
+tainted = set()
+tnames = set(states)
+for n, s in enumerate(stmts):
+    if n in kpos:
+        continue
+    if s['reads'] & (tnames | (internal - states)):
+        assert not (s['reads'] & (internal - states)), s['line']
+        tainted.add(n)
+        tnames.add(s['name'])
+
+last = max(kpos)
+moved = sorted(n for n in tainted if n < last)
+stay = [n for n in range(len(stmts)) if n not in tainted or n > last]
+order = [n for n in stay if n <= last] + moved + [n for n in stay if n > last]
+assert sorted(order) == list(range(len(stmts)))
+
+# write-after-read hazards: a moved statement reading something written by a statement it now follows
+for t in moved:
+    for u in range(t + 1, last + 1):
+        if u in tainted:
+            continue
+        su, st_ = stmts[u], stmts[t]
+        if su['name'] in st_['reads'] or (su['ring'] and su['name'] in re.findall(r'\w+', st_['rhs'])):
+            raise SystemExit('hazard: %s / %s' % (st_['line'], su['line']))
+        if su['name'] in re.findall(r'\b\w+\b', idx_re.sub('', st_['rhs'])):
+            raise SystemExit('scalar hazard: %s / %s' % (st_['line'], su['line']))
+
+# size of the faust vectors, for the level and gain buffers
+vec = int(re.search(r'float fZec\d+\[(\d+)\];', '\n'.join(L)).group(1))
+
+# pairs: min of both channel gains, then the link of each channel towards it
+pairs = []
+for n in sorted(tainted):
+    m = re.fullmatch(r'std::min<float>\((\w+)\[i\], (\w+)\[i\]\)', stmts[n]['rhs'])
+    if m and m.group(1) in states and m.group(2) in states:
+        pairs.append(dict(min=n, lanes=(m.group(1), m.group(2)), name=stmts[n]['name']))
+assert len(pairs) == 8
+links = {}
+for p, pair in enumerate(pairs):
+    for c, st in enumerate(pair['lanes']):
+        cand = [n for n in tainted if re.fullmatch(r'{s}\[i\] \+ (\w+) \* \({m}\[i\] - {s}\[i\]\)'.format(s=st, m=pair['name']), stmts[n]['rhs'])]
+        assert len(cand) == 1, st
+        link = re.fullmatch(r'\w+\[i\] \+ (\w+) .*', stmts[cand[0]]['rhs']).group(1)
+        pair.setdefault('link', link)
+        assert pair['link'] == link
+        links[cand[0]] = c * 8 + p
+kstate = {k['state']: k for k in K}
+lane_of = {}
+for p, pair in enumerate(pairs):
+    a, b = (kstate[s] for s in pair['lanes'])
+    assert a['params'] == b['params'], (a['params'], b['params'])
+    lane_of[pair['lanes'][0]] = p
+    lane_of[pair['lanes'][1]] = 8 + p
+# every other use of the states is one of the above
+for n in tainted:
+    uses = stmts[n]['reads'] & states
+    assert not uses or n in links or any(pp['min'] == n for pp in pairs), stmts[n]['line']
+
+ind = re.match(r'\s*', body[0]).group(0)
+out = []
+kblock_at = {k['pos']: k for k in K}
+mins = set(pp['min'] for pp in pairs)
+for n in order:
+    if n in kpos and n not in kblock_at:
+        continue
+    if n in kblock_at:
+        k = kblock_at[n]
+        out.append('#if MASTER_ME_MSCOMP_KERNEL')
+        out.append('%sfMscompLevels[i][%d] = %s;' % (ind, lane_of[k['state']], k['level']))
+        out.append('#else')
+        out += [stmts[n + j]['line'] for j in range(9)]
+        out.append('#endif')
+        if n + 8 == last:
+            # all 16 levels of this sample are in
+            out.append('#if MASTER_ME_MSCOMP_KERNEL')
+            out.append('%sfMscompKernel.process(fMscompLevels[i], fMscompGains[i]);' % ind)
+            out.append('#endif')
+        continue
+    if n in mins:
+        out.append('#if ! MASTER_ME_MSCOMP_KERNEL')
+        out.append(stmts[n]['line'])
+        out.append('#endif')
+        continue
+    if n in links:
+        out.append('#if MASTER_ME_MSCOMP_KERNEL')
+        out.append('%s%s[i] = fMscompGains[i][%d];' % (ind, stmts[n]['name'], links[n]))
+        out.append('#else')
+        out.append(stmts[n]['line'])
+        out.append('#endif')
+        continue
+    out.append(stmts[n]['line'])
+
+L[start + 1:end] = out
+
+# buffers only the replaced code uses
+unused = set(stmts[n]['name'] for n in kpos | mins if stmts[n]['idx'] is not None)
+for name in sorted(unused):
+    decl = [n for n, l in enumerate(L) if re.fullmatch(r'\s*(?:(?:float|int) %s\[\d+\]|float\* %s = &%s_tmp\[\d+\]);' % (name, name, name), l)]
+    assert len(decl) == 1, name
+    L[decl[0]:decl[0] + 1] = ['#if ! MASTER_ME_MSCOMP_KERNEL', L[decl[0]], '#endif']
+
+# parameters once per block, before the vector loop
+vloop = next(n for n, l in enumerate(L) if re.search(r'for \(int vindex = 0;', l))
+vind = re.match(r'\s*', L[vloop]).group(0)
+setup = ['#if MASTER_ME_MSCOMP_KERNEL']
+for p, pair in enumerate(pairs):
+    prm = kstate[pair['lanes'][0]]['params']
+    setup.append('%sfMscompKernel.setBand(%d, %s, %s);' % (vind, p, ', '.join(prm), pair['link']))
+setup.append('%salignas(32) float fMscompLevels[%d][16];' % (vind, vec))
+setup.append('%salignas(32) float fMscompGains[%d][16];' % (vind, vec))
+setup.append('#endif')
+L[vloop:vloop] = setup
+
+inc = next(n for n, l in enumerate(L) if l == '#include "dsp/FastMath.hpp"')
+L.insert(inc + 1, '#include "dsp/MscompGainKernel.hpp"')
+
+anchor = next(n for n, l in enumerate(L) if re.fullmatch(r'\s*float %s_perm\[\d+\];' % K[0]['state'], l))
+mind = re.match(r'\s*', L[anchor]).group(0)
+L[anchor + 1:anchor + 1] = ['#if MASTER_ME_MSCOMP_KERNEL', '%sMscompGainKernel fMscompKernel;' % mind, '#endif']
+
+clear = next(n for n, l in enumerate(L) if 'void instanceClear()' in l)
+cind = re.match(r'\s*', L[clear + 1]).group(0)
+L[clear + 1:clear + 1] = ['#if MASTER_ME_MSCOMP_KERNEL', '%sfMscompKernel.reset();' % cind, '#endif']
+
+open(dst, 'w').write('\n'.join(L))
+print('moved %d statements after the kernel, %d tainted in total' % (len(moved), len(tainted)))